@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_async.h
+ */
+
+#ifndef ADCS_ASYNC_H
+#define ADCS_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include "adcs_types.h"
+
+#ifndef ADCS_SERVICE_PRIORITY
+#define ADCS_SERVICE_PRIORITY 3
+#endif
+#ifndef ADCS_SERVICE_STACK_SIZE
+#define ADCS_SERVICE_STACK_SIZE 256
+#endif
+#define ADCS_REQUEST_QUEUE_LEN 8
+
+typedef enum ADCS_requestType {
+    ADCS_REQUEST_TELECOMMAND = 0,
+    ADCS_REQUEST_TELEMETRY = 1
+} ADCS_requestType;
+
+typedef struct adcs_request adcs_request;
+typedef void (*adcs_request_callback)(adcs_request *request);
+
+/*
+ * A request is owned by the submitter and must stay valid until it completes. Set callback
+ * and/or notify (and context) before submitting; the remaining fields are filled in by
+ * adcs_submit_telecommand/adcs_submit_telemetry and the service task. The callback runs
+ * before done is set; once done is set the service task no longer touches the request, so
+ * the submitter can free or reuse it straight away.
+ */
+struct adcs_request {
+    ADCS_requestType type;
+    uint8_t TM_ID;
+    uint8_t *data;   // telecommand: command including TC ID, telemetry: reply buffer
+    uint32_t length;
+
+    adcs_request_callback callback; // runs on the service task, keep it short
+    TaskHandle_t notify;            // given a task notification on completion
+    void *context;
+
+    volatile bool done;
+    ADCS_returnState result;
+};
+
+ADCS_returnState adcs_async_init(void);
+ADCS_returnState adcs_submit_telecommand(adcs_request *request, uint8_t *command, uint32_t length,
+                                         TickType_t wait);
+ADCS_returnState adcs_submit_telemetry(adcs_request *request, uint8_t TM_ID, uint8_t *reply, uint32_t length,
+                                       TickType_t wait);
+ADCS_returnState adcs_request_wait(adcs_request *request, TickType_t timeout);
+
+#endif /* ADCS_ASYNC_H */
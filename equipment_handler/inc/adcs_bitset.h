@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_bitset.h
+ */
+
+#ifndef ADCS_BITSET_H
+#define ADCS_BITSET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "adcs_cursor.h"
+
+/*
+ * Packed flag sets: flag n is bit n % 32 of word[n / 32], so a set of bits flags takes
+ * ADCS_BITSET_WORDS(bits) words. The flag sets in adcs_handler.h wrap the words in a struct and name
+ * their bits with an enum; the operations here take the words and the number of flags. Bits past the
+ * last flag are kept clear, so whole words can be compared.
+ */
+#define ADCS_BITSET_WORDS(bits) (((bits) + 31) / 32)
+
+static inline bool adcs_bitset_test(const uint32_t *set, uint32_t bit) { return (set[bit / 32] >> (bit % 32)) & 1; }
+
+static inline void adcs_bitset_assign(uint32_t *set, uint32_t bit, bool value) {
+    set[bit / 32] = (set[bit / 32] & ~(1u << (bit % 32))) | ((uint32_t)value << (bit % 32));
+}
+
+static inline bool adcs_bitset_any(const uint32_t *set, uint32_t bits) {
+    uint32_t any = 0;
+    for (uint32_t i = 0; i < ADCS_BITSET_WORDS(bits); i++) {
+        any |= set[i];
+    }
+    return any != 0;
+}
+
+static inline bool adcs_bitset_all(const uint32_t *set, uint32_t bits) {
+    for (uint32_t i = 0; i < bits / 32; i++) {
+        if (set[i] != UINT32_MAX) {
+            return false;
+        }
+    }
+    uint32_t tail = (1u << (bits % 32)) - 1;
+    return (bits % 32 == 0) || (set[bits / 32] & tail) == tail;
+}
+
+// Flags that differ between two snapshots into changed, returning whether any did
+static inline bool adcs_bitset_diff(const uint32_t *before, const uint32_t *after, uint32_t *changed, uint32_t bits) {
+    uint32_t any = 0;
+    for (uint32_t i = 0; i < ADCS_BITSET_WORDS(bits); i++) {
+        changed[i] = before[i] ^ after[i];
+        any |= changed[i];
+    }
+    return any != 0;
+}
+
+// count (at most 8) flags from first as the low bits of the result
+static inline uint8_t adcs_bitset_bits(const uint32_t *set, uint32_t first, uint8_t count) {
+    uint32_t shift = first % 32;
+    uint32_t value = set[first / 32] >> shift;
+    if (shift + count > 32) {
+        value |= set[first / 32 + 1] << (32 - shift);
+    }
+    return value & ((1u << count) - 1);
+}
+
+static inline void adcs_bitset_assign_bits(uint32_t *set, uint32_t first, uint8_t value, uint8_t count) {
+    uint32_t shift = first % 32;
+    uint32_t mask = (1u << count) - 1;
+    uint32_t bits = value & mask;
+    set[first / 32] = (set[first / 32] & ~(mask << shift)) | (bits << shift);
+    if (shift + count > 32) {
+        set[first / 32 + 1] = (set[first / 32 + 1] & ~(mask >> (32 - shift))) | (bits >> (32 - shift));
+    }
+}
+
+/*
+ * Reads count flags from the frame into flags first.. of set, a byte's worth per step. The rest of the
+ * last word is cleared, so a set read in runs from flag 0 up holds no stale bits.
+ */
+static inline void adcs_get_bitset(adcs_reader *reader, uint32_t *set, uint32_t first, uint32_t count) {
+    while (count > 0) {
+        uint8_t step = (count < 8) ? count : 8;
+        adcs_bitset_assign_bits(set, first, adcs_get_bits(reader, step), step);
+        first += step;
+        count -= step;
+    }
+    if (first % 32 != 0) {
+        set[first / 32] &= (1u << (first % 32)) - 1;
+    }
+}
+
+static inline void adcs_put_bitset(adcs_writer *writer, const uint32_t *set, uint32_t first, uint32_t count) {
+    while (count > 0) {
+        uint8_t step = (count < 8) ? count : 8;
+        adcs_put_bits(writer, adcs_bitset_bits(set, first, step), step);
+        first += step;
+        count -= step;
+    }
+}
+
+#endif /* ADCS_BITSET_H */
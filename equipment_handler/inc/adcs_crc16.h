@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_crc16.h
+ */
+
+#ifndef ADCS_CRC16_H
+#define ADCS_CRC16_H
+
+#include <stdint.h>
+
+#define ADCS_CRC16_INIT 0xFFFF
+
+uint16_t adcs_crc16_update(uint16_t crc, const uint8_t *data, uint32_t length);
+uint16_t adcs_crc16_update_bytewise(uint16_t crc, const uint8_t *data, uint32_t length);
+uint16_t adcs_crc16(const uint8_t *data, uint32_t length);
+
+#endif /* ADCS_CRC16_H */
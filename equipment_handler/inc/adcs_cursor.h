@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_cursor.h
+ */
+
+#ifndef ADCS_CURSOR_H
+#define ADCS_CURSOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Little-endian cursors over a TC/TM frame. Every get/put moves the cursor past its value, so a
+ * frame is read or written in wire order without offsets or host struct layout. Bit fields are
+ * taken LSB first from the current byte; the next byte-sized value starts at the following byte.
+ *
+ * An access that would run past len reads zero or writes nothing and latches overrun, so a frame
+ * needs one check at the end: the handlers return ADCS_INCORRECT_LENGTH rather than send or decode
+ * a frame that overran. The functions are inline: on a local cursor over a buffer of constant
+ * size, the compiler resolves every position and bounds check at compile time.
+ */
+typedef struct {
+    const uint8_t *buf;
+    uint32_t len;
+    uint32_t pos; // next byte
+    uint8_t bit;  // next bit within buf[pos], bit fields only
+    bool overrun;
+} adcs_reader;
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t len;
+    uint32_t pos; // next byte
+    uint8_t bit;  // next bit within buf[pos], bit fields only
+    bool overrun;
+} adcs_writer;
+
+static inline adcs_reader adcs_reader_init(const uint8_t *buf, uint32_t len) {
+    adcs_reader reader = {buf, len, 0, 0, false};
+    return reader;
+}
+
+static inline adcs_writer adcs_writer_init(uint8_t *buf, uint32_t len) {
+    adcs_writer writer = {buf, len, 0, 0, false};
+    return writer;
+}
+
+// Claims the next count bytes, starting at the byte after a partly read one
+static inline const uint8_t *adcs_reader_take(adcs_reader *reader, uint32_t count) {
+    uint32_t pos = reader->pos + (reader->bit != 0);
+    if (reader->overrun || count > reader->len || pos > reader->len - count) {
+        reader->overrun = true;
+        return NULL;
+    }
+    reader->pos = pos + count;
+    reader->bit = 0;
+    return &reader->buf[pos];
+}
+
+static inline uint8_t *adcs_writer_take(adcs_writer *writer, uint32_t count) {
+    uint32_t pos = writer->pos + (writer->bit != 0);
+    if (writer->overrun || count > writer->len || pos > writer->len - count) {
+        writer->overrun = true;
+        return NULL;
+    }
+    writer->pos = pos + count;
+    writer->bit = 0;
+    return &writer->buf[pos];
+}
+
+// Claims the next count bits, returning the bit position of the first
+static inline uint32_t adcs_cursor_take_bits(uint32_t len, uint32_t *pos, uint8_t *bit, bool *overrun,
+                                             uint8_t count) {
+    uint32_t first = *pos * 8 + *bit;
+    if (*overrun || count > 8 || first + count > len * 8) {
+        *overrun = true;
+        return UINT32_MAX;
+    }
+    *pos = (first + count) / 8;
+    *bit = (first + count) % 8;
+    return first;
+}
+
+/********************************* reads *********************************/
+
+static inline void adcs_get_skip(adcs_reader *reader, uint32_t count) { (void)adcs_reader_take(reader, count); }
+
+static inline uint8_t adcs_get_u8(adcs_reader *reader) {
+    const uint8_t *p = adcs_reader_take(reader, 1);
+    return (p != NULL) ? p[0] : 0;
+}
+
+static inline uint16_t adcs_get_u16(adcs_reader *reader) {
+    const uint8_t *p = adcs_reader_take(reader, 2);
+    return (p != NULL) ? (uint16_t)(p[0] | (p[1] << 8)) : 0;
+}
+
+static inline int16_t adcs_get_i16(adcs_reader *reader) { return (int16_t)adcs_get_u16(reader); }
+
+static inline uint32_t adcs_get_u32(adcs_reader *reader) {
+    const uint8_t *p = adcs_reader_take(reader, 4);
+    if (p == NULL) {
+        return 0;
+    }
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline int32_t adcs_get_i32(adcs_reader *reader) { return (int32_t)adcs_get_u32(reader); }
+
+static inline float adcs_get_f32(adcs_reader *reader) {
+    uint32_t bits = adcs_get_u32(reader);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline double adcs_get_f64(adcs_reader *reader) {
+    uint64_t bits = adcs_get_u32(reader);
+    bits |= (uint64_t)adcs_get_u32(reader) << 32;
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline void adcs_get_bytes(adcs_reader *reader, uint8_t *dst, uint32_t count) {
+    const uint8_t *p = adcs_reader_take(reader, count);
+    if (p != NULL) {
+        memcpy(dst, p, count);
+    }
+}
+
+// count (at most 8) bits, LSB first
+static inline uint8_t adcs_get_bits(adcs_reader *reader, uint8_t count) {
+    uint32_t first = adcs_cursor_take_bits(reader->len, &reader->pos, &reader->bit, &reader->overrun, count);
+    if (first == UINT32_MAX) {
+        return 0;
+    }
+    uint32_t window = reader->buf[first / 8];
+    if ((first % 8) + count > 8) {
+        window |= (uint32_t)reader->buf[first / 8 + 1] << 8;
+    }
+    return (window >> (first % 8)) & ((1u << count) - 1);
+}
+
+static inline bool adcs_get_flag(adcs_reader *reader) { return adcs_get_bits(reader, 1) != 0; }
+
+static inline void adcs_get_skip_bits(adcs_reader *reader, uint8_t count) { (void)adcs_get_bits(reader, count); }
+
+/********************************* writes *********************************/
+
+// Leaves count bytes as they are
+static inline void adcs_put_skip(adcs_writer *writer, uint32_t count) { (void)adcs_writer_take(writer, count); }
+
+static inline void adcs_put_u8(adcs_writer *writer, uint8_t value) {
+    uint8_t *p = adcs_writer_take(writer, 1);
+    if (p != NULL) {
+        p[0] = value;
+    }
+}
+
+static inline void adcs_put_u16(adcs_writer *writer, uint16_t value) {
+    uint8_t *p = adcs_writer_take(writer, 2);
+    if (p != NULL) {
+        p[0] = value;
+        p[1] = value >> 8;
+    }
+}
+
+static inline void adcs_put_i16(adcs_writer *writer, int16_t value) { adcs_put_u16(writer, (uint16_t)value); }
+
+static inline void adcs_put_u32(adcs_writer *writer, uint32_t value) {
+    uint8_t *p = adcs_writer_take(writer, 4);
+    if (p != NULL) {
+        p[0] = value;
+        p[1] = value >> 8;
+        p[2] = value >> 16;
+        p[3] = value >> 24;
+    }
+}
+
+static inline void adcs_put_i32(adcs_writer *writer, int32_t value) { adcs_put_u32(writer, (uint32_t)value); }
+
+static inline void adcs_put_f32(adcs_writer *writer, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    adcs_put_u32(writer, bits);
+}
+
+static inline void adcs_put_f64(adcs_writer *writer, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    adcs_put_u32(writer, (uint32_t)bits);
+    adcs_put_u32(writer, (uint32_t)(bits >> 32));
+}
+
+static inline void adcs_put_bytes(adcs_writer *writer, const uint8_t *src, uint32_t count) {
+    uint8_t *p = adcs_writer_take(writer, count);
+    if (p != NULL) {
+        memcpy(p, src, count);
+    }
+}
+
+// Low count (at most 8) bits of value, LSB first, leaving the other bits of the bytes as they are
+static inline void adcs_put_bits(adcs_writer *writer, uint8_t value, uint8_t count) {
+    uint32_t first = adcs_cursor_take_bits(writer->len, &writer->pos, &writer->bit, &writer->overrun, count);
+    if (first == UINT32_MAX) {
+        return;
+    }
+    uint32_t mask = ((1u << count) - 1) << (first % 8);
+    uint32_t bits = ((uint32_t)value << (first % 8)) & mask;
+    writer->buf[first / 8] = (writer->buf[first / 8] & ~mask) | bits;
+    if ((first % 8) + count > 8) {
+        writer->buf[first / 8 + 1] = (writer->buf[first / 8 + 1] & ~(mask >> 8)) | (bits >> 8);
+    }
+}
+
+static inline void adcs_put_flag(adcs_writer *writer, bool value) { adcs_put_bits(writer, value, 1); }
+
+static inline void adcs_put_skip_bits(adcs_writer *writer, uint8_t count) {
+    (void)adcs_cursor_take_bits(writer->len, &writer->pos, &writer->bit, &writer->overrun, count);
+}
+
+#endif /* ADCS_CURSOR_H */
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_deadline.h
+ */
+
+#ifndef ADCS_DEADLINE_H
+#define ADCS_DEADLINE_H
+
+#include <stdint.h>
+
+#define ADCS_DEADLINE_MARGIN_MS 10 // least slack on top of the wire time of a transaction
+
+void adcs_deadline_observe(uint8_t id, uint32_t rtt_ms);
+void adcs_deadline_expired(uint8_t id);
+uint32_t adcs_deadline_budget_ms(uint8_t id, uint32_t wire_bytes);
+void adcs_deadline_reset(void);
+
+#endif /* ADCS_DEADLINE_H */
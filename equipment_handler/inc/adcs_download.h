@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_download.h
+ */
+
+#ifndef ADCS_DOWNLOAD_H
+#define ADCS_DOWNLOAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "adcs_types.h"
+
+#define ADCS_DOWNLOAD_PATH_MAX 64   // destination path, the state file adds ADCS_DOWNLOAD_STATE_EXT
+#define ADCS_DOWNLOAD_STATE_EXT ".dl"
+#define ADCS_DOWNLOAD_MAX_PASSES 8  // bursts per block before giving up for this run
+#define ADCS_DOWNLOAD_LOAD_TIMEOUT_MS 2000 // ADCS copying a block from its SD card
+#define ADCS_DOWNLOAD_POLL_BACKOFF_MS {5, 10, 20, 50, 100} // between block status polls, the last entry repeats
+
+// Task writing a finished block out while the next one is burst, it counts towards REDCONF_TASK_COUNT
+#ifndef ADCS_DOWNLOAD_WRITER_PRIORITY
+#define ADCS_DOWNLOAD_WRITER_PRIORITY 2
+#endif
+#ifndef ADCS_DOWNLOAD_WRITER_STACK_SIZE
+#define ADCS_DOWNLOAD_WRITER_STACK_SIZE 512
+#endif
+
+// One entry of the ADCS file list, as returned by ADCS_get_file_info
+typedef struct {
+    uint8_t type;
+    uint8_t counter;
+    uint32_t size;
+    uint32_t time;
+    uint16_t crc16;
+} adcs_file_info;
+
+ADCS_returnState adcs_download_init(void);
+ADCS_returnState adcs_download_file(const adcs_file_info *file, const char *path);
+ADCS_returnState adcs_download_progress(const adcs_file_info *file, const char *path, uint32_t *received);
+ADCS_returnState adcs_download_discard(const char *path);
+
+#endif /* ADCS_DOWNLOAD_H */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_fields.h
+ */
+
+#ifndef ADCS_FIELDS_H
+#define ADCS_FIELDS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "adcs_types.h"
+
+// Wire format of a field and the type of the member it is decoded into
+typedef enum {
+    ADCS_FIELD_U8 = 0,     // uint8_t  -> uint8_t
+    ADCS_FIELD_U16 = 1,    // uint16_t -> uint16_t
+    ADCS_FIELD_I16 = 2,    // int16_t  -> int16_t
+    ADCS_FIELD_U32 = 3,    // uint32_t -> uint32_t
+    ADCS_FIELD_I32 = 4,    // int32_t  -> int32_t
+    ADCS_FIELD_F32 = 5,    // float    -> float
+    ADCS_FIELD_F64 = 6,    // double   -> double
+    ADCS_FIELD_U8_F = 7,   // uint8_t  -> float, raw * scale
+    ADCS_FIELD_U16_F = 8,  // uint16_t -> float, raw * scale
+    ADCS_FIELD_I16_F = 9,  // int16_t  -> float, raw * scale
+    ADCS_FIELD_I32_F = 10, // int32_t  -> float, raw * scale
+    ADCS_FIELD_BITS = 11,  // count bits from bit -> one uint8_t (enums packed in a byte)
+    ADCS_FIELD_FLAGS = 12  // count bits from bit -> flags first.. of a flag set (adcs_bitset.h), in order
+} adcs_field_type;
+
+/*
+ * One field of a TC or TM frame: count consecutive little-endian values starting at byte wire,
+ * held in count consecutive members starting dest bytes into the struct.
+ */
+typedef struct {
+    uint16_t wire;
+    uint16_t dest;
+    uint8_t type;    // adcs_field_type
+    uint8_t count;   // values, or bits for ADCS_FIELD_BITS and ADCS_FIELD_FLAGS
+    uint8_t bit;     // first bit within byte wire, bit fields only
+    uint8_t first;   // first flag of the set, ADCS_FIELD_FLAGS only
+    float scale;     // scaled types only
+    float inv_scale; // 1 / scale, folded at compile time so encoding multiplies instead of dividing
+} adcs_field;
+
+#define ADCS_FIELD(wire, type, count, scale, strct, member)                                                       \
+    { (wire), (uint16_t)offsetof(strct, member), (type), (count), 0, 0, (scale), 1.0f / ((scale) ? (scale) : 1) }
+#define ADCS_BITS(wire, bit, width, strct, member)                                                                \
+    { (wire), (uint16_t)offsetof(strct, member), ADCS_FIELD_BITS, (width), (bit), 0, 0, 0 }
+#define ADCS_FLAGS(wire, bit, count, strct, member, first)                                                        \
+    { (wire), (uint16_t)offsetof(strct, member), ADCS_FIELD_FLAGS, (count), (bit), (first), 0, 0 }
+#define ADCS_FIELD_COUNT(fields) (sizeof(fields) / sizeof((fields)[0]))
+
+// Fails to compile when cond is false; name makes the error point at the broken assumption
+#define ADCS_STATIC_ASSERT(cond, name) typedef char adcs_static_assert_##name[(cond) ? 1 : -1]
+
+ADCS_returnState adcs_fields_decode(const adcs_field *fields, uint32_t count, const uint8_t *frame,
+                                    uint32_t length, void *out);
+ADCS_returnState adcs_fields_encode(const adcs_field *fields, uint32_t count, const void *in, uint8_t *frame,
+                                    uint32_t length);
+
+#endif /* ADCS_FIELDS_H */
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_file_index.h
+ */
+
+#ifndef ADCS_FILE_INDEX_H
+#define ADCS_FILE_INDEX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "adcs_download.h"
+#include "adcs_types.h"
+
+#define ADCS_FILE_INDEX_MAX 64 // files kept, the ADCS lists newest first so the oldest drop off
+
+ADCS_returnState adcs_file_index_refresh(void);
+uint32_t adcs_file_index_list(adcs_file_info *files, uint32_t max);
+bool adcs_file_index_find(uint8_t type, uint8_t counter, adcs_file_info *file);
+void adcs_file_index_invalidate(void);
+void adcs_file_index_forget(uint8_t type, uint8_t counter, bool all);
+
+#endif /* ADCS_FILE_INDEX_H */
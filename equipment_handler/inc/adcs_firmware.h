@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_firmware.h
+ */
+
+#ifndef ADCS_FIRMWARE_H
+#define ADCS_FIRMWARE_H
+
+#include <stdint.h>
+
+#include "adcs_types.h"
+
+#define ADCS_FIRMWARE_PATH_MAX 64 // source path, the journal adds ADCS_FIRMWARE_JOURNAL_EXT
+#define ADCS_FIRMWARE_JOURNAL_EXT ".fw"
+#define ADCS_FIRMWARE_POLL_BACKOFF_MS {20, 50, 100, 200, 500} // between status polls, the last entry repeats
+#define ADCS_FIRMWARE_BOOT_TIMEOUT_MS 10000  // ADCS coming back up after a reset or program switch
+#define ADCS_FIRMWARE_INFO_TIMEOUT_MS 10000  // bootloader reading a program and its CRC
+#define ADCS_FIRMWARE_COPY_TIMEOUT_MS 60000  // bootloader erasing and writing internal flash
+
+// Steps of a firmware update, in order; the journal holds the one to do next
+typedef enum {
+    ADCS_FIRMWARE_UPLOAD = 0, // uploading the program to its slot
+    ADCS_FIRMWARE_BOOTLOADER, // resetting the ADCS into the bootloader
+    ADCS_FIRMWARE_VERIFY,     // checking the slot against the file
+    ADCS_FIRMWARE_COPY,       // copying the slot to internal flash
+    ADCS_FIRMWARE_BOOT,       // running the internal flash program
+    ADCS_FIRMWARE_DONE
+} adcs_firmware_step;
+
+ADCS_returnState adcs_firmware_update(const char *path, uint8_t program);
+ADCS_returnState adcs_firmware_progress(const char *path, adcs_firmware_step *step, uint32_t *uploaded);
+ADCS_returnState adcs_firmware_discard(const char *path);
+
+#endif /* ADCS_FIRMWARE_H */
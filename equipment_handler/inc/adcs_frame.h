@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_frame.h
+ */
+
+#ifndef ADCS_FRAME_H
+#define ADCS_FRAME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Worst-case size of an encoded frame whose body (ID + payload) is len bytes
+#define ADCS_FRAME_ENCODED_MAX(len) (4 + 2 * (len))
+
+typedef enum {
+    ADCS_FRAME_INCOMPLETE = 0, // need more bytes
+    ADCS_FRAME_COMPLETE = 1,   // ESC EOM seen, frame is in the parser
+    ADCS_FRAME_OVERFLOW = 2,   // payload longer than the destination buffer
+    ADCS_FRAME_SPLIT = 3       // split parser: payload buffer full, call adcs_frame_parser_set_tail
+} ADCS_frameState;
+
+/*
+ * Streaming parser for UART frames: ESC SOM <id> <payload> ESC EOM, where any 0x1F inside
+ * id/payload is sent as ESC ESC. Bytes are fed as they arrive, and a new ESC SOM always
+ * restarts the frame so the parser resynchronises after garbage or a truncated frame.
+ */
+typedef struct {
+    uint8_t state;
+    bool have_id;
+    uint8_t id;
+    uint8_t *payload;
+    uint32_t capacity;
+    uint32_t length; // payload bytes received, including those stored in or dropped past the tail
+
+    // Split parsing: once payload is full the caller picks where the rest of this frame goes
+    bool split;
+    bool split_pending;
+    uint8_t *tail;
+    uint32_t tail_capacity;
+
+    bool skip; // the rest of the current frame is counted but not stored, see adcs_frame_parser_skip
+} adcs_frame_parser;
+
+void adcs_frame_parser_init(adcs_frame_parser *parser, uint8_t *payload, uint32_t capacity);
+void adcs_frame_parser_split(adcs_frame_parser *parser);
+void adcs_frame_parser_set_tail(adcs_frame_parser *parser, uint8_t *tail, uint32_t capacity);
+void adcs_frame_parser_skip(adcs_frame_parser *parser);
+ADCS_frameState adcs_frame_parse(adcs_frame_parser *parser, const uint8_t *data, uint32_t len,
+                                 uint32_t *consumed);
+uint32_t adcs_frame_encode(uint8_t *frame, const uint8_t *body, uint32_t length);
+
+#endif /* ADCS_FRAME_H */
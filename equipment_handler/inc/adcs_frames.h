@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_frames.h
+ * @brief
+ *      Generated by tools/adcs_gen.py from tools/adcs_frames.json, do not edit.
+ */
+
+#ifndef ADCS_FRAMES_H
+#define ADCS_FRAMES_H
+
+#include "adcs_fields.h"
+
+// Bytes after the ID of each frame
+
+// Telecommands
+#define RESET_LEN 1
+#define SET_CURRENT_UNIX_TIME_LEN 6
+#define SET_CACHE_EN_STATE_LEN 1
+#define RESET_LOG_POINTER_LEN 0
+#define ADVANCE_LOG_POINTER_LEN 0
+#define RESET_BOOT_REGISTERS_LEN 0
+#define CLEAR_ERR_FLAGS_LEN 0
+#define DEPLOY_MAGNETOMETER_BOOM_LEN 1
+#define SET_SRAM_SCRUB_PARAM_LEN 2
+#define SET_UNIX_TIME_SAVE_LEN 2
+#define ADCS_RUN_MODE_LEN 1
+#define SET_POWER_CONTROL_LEN 3
+#define CLEAR_LATCHED_ERRS_LEN 1
+#define SET_ATT_CONTROL_MODE_LEN 3
+#define SET_ATT_ESTIMATE_MODE_LEN 1
+#define SET_ATT_ANGLE_LEN 6
+#define SET_MAGNETORQUER_OUTPUT_LEN 6
+#define SET_WHEEL_SPEED_LEN 6
+#define TRIGGER_ADCS_LOOP_LEN 0
+#define TRIGGER_ADCS_LOOP_SIM_LEN 127
+#define SET_MTQ_CONFIG_LEN 3
+#define SET_WHEEL_CONFIG_LEN 4
+#define SET_RATE_GYRO_CONFIG_LEN 10
+#define SET_CSS_CONFIG_LEN 21
+#define SET_CUBESENSE_CONFIG_LEN 112
+#define SET_MTM_CONFIG_LEN 30
+#define SET_ESTIMATE_PARAM_LEN 31
+#define SET_ASGP4_PARAM_LEN 30
+#define SET_USERCODED_PARAM_LEN 96
+#define SET_SYSTEM_CONFIG_LEN 173
+#define ASGP4_RUN_MODE_LEN 1
+#define ASGP4_TRIGGER_LEN 0
+#define FORMAT_SD_CARD_LEN 1
+#define SET_INERTIAL_POINT_LEN 6
+#define SET_MTM2_CONFIG_LEN 30
+#define SET_STAR_TRACK_CONFIG_LEN 53
+#define SET_DETUMBLE_PARAM_LEN 14
+#define SET_YWHEEL_CTRL_PARAM_LEN 20
+#define SET_RWHEEL_CTRL_PARAM_LEN 13
+#define SET_MOMENT_INERTIA_MAT_LEN 24
+#define SET_SGP4_ORBIT_PARAMS_LEN 64
+#define SET_TRACK_CTRL_LEN 13
+#define SET_TRACK_CTRLER_TARGET_REF_LEN 12
+#define SET_MTM_OP_MODE_LEN 1
+#define CNV2JPG_LEN 3
+#define SAVE_CONFIG_LEN 0
+#define SAVE_ORBIT_PARAMS_LEN 0
+#define SAVE_IMG_LEN 2
+#define SET_BOOT_INDEX_LEN 1
+#define RUN_SELECTED_PROGRAM_LEN 0
+#define READ_PROGRAM_INFO_LEN 1
+#define COPY_PROGRAM_INTERNAL_FLASH_LEN 2
+#define SET_SD_LOG1_CONFIG_LEN 13
+#define SET_SD_LOG2_CONFIG_LEN 13
+#define SET_UART_LOG_CONFIG_LEN 12
+#define ERASE_FILE_LEN 3
+#define LOAD_FILE_DOWNLOAD_BLOCK_LEN 8
+#define ADVANCE_FILE_LIST_READ_POINTER_LEN 0
+#define INITIATE_FILE_UPLOAD_LEN 2
+#define FILE_UPLOAD_PACKET_LEN 22
+#define FINALIZE_UPLOAD_BLOCK_LEN 7
+#define RESET_UPLOAD_BLOCK_LEN 0
+#define RESET_FILE_LIST_READ_POINTER_LEN 0
+#define INITIATE_DOWNLOAD_BURST_LEN 2
+#define SET_HOLE_MAP_LEN 16
+
+// Telemetry
+#define NODE_IDENTIFICATION_LEN 8
+#define BOOT_RUNNING_STAT_LEN 6
+#define BOOT_IDX_STAT_LEN 2
+#define GET_CACHE_EN_STATE_LEN 1
+#define GET_BOOTLOADER_STATE_LEN 6
+#define JPG_CNV_PROGRESS_LEN 3
+#define GET_SRAM_SCRUB_PARAM_LEN 2
+#define CUBEACP_STATE_FLAGS_LEN 1
+#define GET_CURRENT_UNIX_TIME_LEN 6
+#define LAST_LOGGED_EVENT_LEN 6
+#define SRAM_LATCHUP_COUNT_LEN 6
+#define EDAC_ERR_COUNT_LEN 6
+#define COMMS_STAT_LEN 6
+#define GET_UNIX_TIME_SAVE_LEN 2
+#define SATELLITE_POSITION_LLH_LEN 6
+#define ADCS_STATE_LEN 54
+#define ADCS_MEASUREMENTS_LEN 72
+#define ACTUATOR_LEN 12
+#define ESTIMATION_LEN 42
+#define RAW_SENSOR_MEASUREMENTS_LEN 34
+#define POWER_TEMP_LEN 38
+#define ADCS_EXE_TIMES_LEN 8
+#define GET_POWER_CONTROL_LEN 3
+#define GET_ATT_ANGLE_LEN 6
+#define GET_TRACK_CTRLER_TARGET_REF_LEN 12
+#define GET_CUBESENSE_CONFIG_LEN 112
+#define GET_FULL_CONFIG_LEN 504
+#define GET_SGP4_ORBIT_PARAMS_LEN 64
+#define RAW_GPS_MEASUREMENTS_LEN 36
+#define RAW_STAR_TRACKER_LEN 54
+#define MTM2_MEASUREMENTS_LEN 6
+#define ACP_EXE_STATE_LEN 3
+#define GET_SYSTEM_CONFIG_LEN 173
+#define ASGP4_TLEs_LEN 33
+#define GET_PROGRAM_INFO_LEN 8
+#define COPY_INTERNAL_FLASH_PROGRESS_LEN 1
+#define IMG_CAPTURE_SAVE_OP_STAT_LEN 2
+#define SD_FORMAT_PROGRESS_LEN 1
+#define GET_SD_LOG1_CONFIG_LEN 13
+#define GET_SD_LOG2_CONFIG_LEN 13
+#define GET_UART_LOG_CONFIG_LEN 12
+#define GET_INERTIAL_POINT_LEN 6
+#define LAST_TC_ACK_LEN 4
+#define FILE_DL_BUFFER_LEN 22
+#define DL_BLOCK_STAT_LEN 5
+#define FILE_INFO_LEN 12
+#define INIT_UPLOAD_STAT_LEN 1
+#define FINIALIZE_UPLOAD_STAT_LEN 1
+#define UPLOAD_CRC16_LEN 2
+#define GET_HOLE_MAP_LEN 16
+
+// Field tables of the structured frames, for adcs_fields_decode and adcs_fields_encode
+extern const adcs_field adcs_state_fields[];
+#define ADCS_STATE_FIELD_COUNT 15
+extern const adcs_field adcs_state_raw_fields[];
+#define ADCS_STATE_RAW_FIELD_COUNT 12
+extern const adcs_field adcs_llh_fields[];
+#define ADCS_LLH_FIELD_COUNT 2
+extern const adcs_field adcs_measures_fields[];
+#define ADCS_MEASURES_FIELD_COUNT 5
+extern const adcs_field adcs_measures_raw_fields[];
+#define ADCS_MEASURES_RAW_FIELD_COUNT 1
+extern const adcs_field adcs_actuator_fields[];
+#define ADCS_ACTUATOR_FIELD_COUNT 2
+extern const adcs_field adcs_estimate_fields[];
+#define ADCS_ESTIMATE_FIELD_COUNT 5
+extern const adcs_field adcs_estimate_raw_fields[];
+#define ADCS_ESTIMATE_RAW_FIELD_COUNT 1
+extern const adcs_field adcs_asgp4_fields[];
+#define ADCS_ASGP4_FIELD_COUNT 1
+extern const adcs_field adcs_raw_sensor_fields[];
+#define ADCS_RAW_SENSOR_FIELD_COUNT 7
+extern const adcs_field adcs_raw_gps_fields[];
+#define ADCS_RAW_GPS_FIELD_COUNT 11
+extern const adcs_field adcs_star_track_fields[];
+#define ADCS_STAR_TRACK_FIELD_COUNT 17
+extern const adcs_field adcs_xyz16_fields[];
+#define ADCS_XYZ16_FIELD_COUNT 1
+extern const adcs_field adcs_pwr_temp_fields[];
+#define ADCS_PWR_TEMP_FIELD_COUNT 8
+extern const adcs_field adcs_pwr_temp_raw_fields[];
+#define ADCS_PWR_TEMP_RAW_FIELD_COUNT 3
+extern const adcs_field adcs_att_angle_fields[];
+#define ADCS_ATT_ANGLE_FIELD_COUNT 1
+extern const adcs_field adcs_track_ref_fields[];
+#define ADCS_TRACK_REF_FIELD_COUNT 1
+extern const adcs_field adcs_iner_ref_fields[];
+#define ADCS_INER_REF_FIELD_COUNT 1
+extern const adcs_field adcs_sgp4_fields[];
+#define ADCS_SGP4_FIELD_COUNT 1
+extern const adcs_field adcs_sys_config_fields[];
+#define ADCS_SYS_CONFIG_FIELD_COUNT 27
+extern const adcs_field adcs_cubesense_fields[];
+#define ADCS_CUBESENSE_FIELD_COUNT 12
+extern const adcs_field adcs_mtq_fields[];
+#define ADCS_MTQ_FIELD_COUNT 1
+extern const adcs_field adcs_rate_gyro_fields[];
+#define ADCS_RATE_GYRO_FIELD_COUNT 3
+extern const adcs_field adcs_css_fields[];
+#define ADCS_CSS_FIELD_COUNT 3
+extern const adcs_field adcs_mtm_fields[];
+#define ADCS_MTM_FIELD_COUNT 7
+extern const adcs_field adcs_star_tracker_fields[];
+#define ADCS_STAR_TRACKER_FIELD_COUNT 10
+extern const adcs_field adcs_detumble_fields[];
+#define ADCS_DETUMBLE_FIELD_COUNT 3
+extern const adcs_field adcs_ywheel_fields[];
+#define ADCS_YWHEEL_FIELD_COUNT 1
+extern const adcs_field adcs_rwheel_fields[];
+#define ADCS_RWHEEL_FIELD_COUNT 3
+extern const adcs_field adcs_tracking_fields[];
+#define ADCS_TRACKING_FIELD_COUNT 2
+extern const adcs_field adcs_moi_fields[];
+#define ADCS_MOI_FIELD_COUNT 1
+extern const adcs_field adcs_estimation_fields[];
+#define ADCS_ESTIMATION_FIELD_COUNT 6
+extern const adcs_field adcs_asgp4_setting_fields[];
+#define ADCS_ASGP4_SETTING_FIELD_COUNT 10
+extern const adcs_field adcs_usercoded_fields[];
+#define ADCS_USERCODED_FIELD_COUNT 1
+extern const adcs_field adcs_full_config_fields[];
+#define ADCS_FULL_CONFIG_FIELD_COUNT 71
+
+// Scales of the counts in adcs_state_raw: engineering value = count * scale
+#define ADCS_STATE_EST_ANGLE_SCALE 0.01f        // deg
+#define ADCS_STATE_EST_ANGULAR_RATE_SCALE 0.01f // deg/s
+#define ADCS_STATE_ECI_POS_SCALE 0.25f          // km
+#define ADCS_STATE_ECI_VEL_SCALE 0.25f          // m/s
+#define ADCS_STATE_LONGLATALT_X_SCALE 0.01f     // deg
+#define ADCS_STATE_LONGLATALT_Y_SCALE 0.01f     // deg
+#define ADCS_STATE_LONGLATALT_Z_SCALE 0.01f     // km
+
+// Scales of the counts in adcs_measures_raw: engineering value = count * scale
+#define ADCS_MEASURES_MAGNETIC_FIELD_SCALE 0.01f // uT
+#define ADCS_MEASURES_COARSE_SUN_SCALE 0.0001f
+#define ADCS_MEASURES_SUN_SCALE 0.0001f
+#define ADCS_MEASURES_NADIR_SCALE 0.0001f
+#define ADCS_MEASURES_ANGULAR_RATE_SCALE 0.01f // deg/s
+#define ADCS_MEASURES_WHEEL_SPEED_SCALE 1.0f   // rpm
+#define ADCS_MEASURES_STAR1B_SCALE 0.0001f
+#define ADCS_MEASURES_STAR1O_SCALE 0.0001f
+#define ADCS_MEASURES_STAR2B_SCALE 0.0001f
+#define ADCS_MEASURES_STAR2O_SCALE 0.0001f
+#define ADCS_MEASURES_STAR3B_SCALE 0.0001f
+#define ADCS_MEASURES_STAR3O_SCALE 0.0001f
+
+// Scales of the counts in adcs_estimate_raw: engineering value = count * scale
+#define ADCS_ESTIMATE_IGRF_MAGNETIC_FIELD_SCALE 0.01f // uT
+#define ADCS_ESTIMATE_SUN_SCALE 0.0001f
+#define ADCS_ESTIMATE_GYRO_BIAS_SCALE 0.001f // deg/s
+#define ADCS_ESTIMATE_INNOVATION_SCALE 0.0001f
+#define ADCS_ESTIMATE_QUATERNION_ERR_SCALE 0.0001f
+#define ADCS_ESTIMATE_QUATERNION_COVAR_SCALE 0.001f
+#define ADCS_ESTIMATE_ANGULAR_RATE_COVAR_SCALE 0.001f
+
+// Scales of the counts in adcs_pwr_temp_raw: engineering value = count * scale
+#define ADCS_PWR_TEMP_CUBESENSE1_3V3_I_SCALE 0.1f          // mA
+#define ADCS_PWR_TEMP_CUBESENSE1_CAMSRAM_I_SCALE 0.1f      // mA
+#define ADCS_PWR_TEMP_CUBESENSE2_3V3_I_SCALE 0.1f          // mA
+#define ADCS_PWR_TEMP_CUBESENSE2_CAMSRAM_I_SCALE 0.1f      // mA
+#define ADCS_PWR_TEMP_CUBECONTROL_3V3_I_SCALE 0.48828125f  // mA
+#define ADCS_PWR_TEMP_CUBECONTROL_5V_I_SCALE 0.48828125f   // mA
+#define ADCS_PWR_TEMP_CUBECONTROL_VBAT_I_SCALE 0.48828125f // mA
+#define ADCS_PWR_TEMP_WHEEL1_I_SCALE 0.01f                 // mA
+#define ADCS_PWR_TEMP_WHEEL2_I_SCALE 0.01f                 // mA
+#define ADCS_PWR_TEMP_WHEEL3_I_SCALE 0.01f                 // mA
+#define ADCS_PWR_TEMP_CUBESTAR_I_SCALE 0.01f               // mA
+#define ADCS_PWR_TEMP_MAGNETORQUER_I_SCALE 0.1f            // mA
+#define ADCS_PWR_TEMP_CUBESTAR_TEMP_SCALE 0.01f            // C
+#define ADCS_PWR_TEMP_MCU_TEMP_SCALE 1.0f                  // C
+#define ADCS_PWR_TEMP_MTM_TEMP_SCALE 0.1f                  // C
+#define ADCS_PWR_TEMP_MTM2_TEMP_SCALE 0.1f                 // C
+
+#endif /* ADCS_FRAMES_H */
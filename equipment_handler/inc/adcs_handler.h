@@ -23,6 +23,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "adcs_bitset.h"
 #include "adcs_types.h"
 
 // Structs
@@ -50,6 +51,12 @@ typedef struct {
     int32_t z;
 } xyz32;
 
+typedef struct {
+    int16_t x;  // longitude
+    int16_t y;  // latitude
+    uint16_t z; // altitude
+} llh16;
+
 typedef struct {
     int32_t pos;
     int16_t vel;
@@ -86,12 +93,173 @@ typedef struct {
     xyzu8 vel_std_dev;
 } sim_sensor_data;
 
+// Flag sets (adcs_bitset.h), named in frame order. Test a flag with adcs_bitset_test(set.word, name).
+
+// Table 149, ADCS state bits 12-47, 48-51 and 54-65
+typedef enum {
+    ADCS_STATE_CUBECONTROL_SIGNAL_EN = 0,
+    ADCS_STATE_CUBECONTROL_MOTOR_EN = 1,
+    ADCS_STATE_CUBESENSE1_EN = 2,
+    ADCS_STATE_CUBESENSE2_EN = 3,
+    ADCS_STATE_CUBEWHEEL1_EN = 4,
+    ADCS_STATE_CUBEWHEEL2_EN = 5,
+    ADCS_STATE_CUBEWHEEL3_EN = 6,
+    ADCS_STATE_CUBESTAR_EN = 7,
+    ADCS_STATE_GPS_RECEIVER_EN = 8,
+    ADCS_STATE_GPS_LNA_POWER_EN = 9,
+    ADCS_STATE_MOTOR_DRIVER_EN = 10,
+    ADCS_STATE_SUN_ABOVE_HORIZON = 11,
+    ADCS_STATE_CUBESENSE1_COMMS_ERR = 12,
+    ADCS_STATE_CUBESENSE2_COMMS_ERR = 13,
+    ADCS_STATE_CUBECONTROL_SIGNAL_COMMS_ERR = 14,
+    ADCS_STATE_CUBECONTROL_MOTOR_COMMS_ERR = 15,
+    ADCS_STATE_CUBEWHEEL1_COMMS_ERR = 16,
+    ADCS_STATE_CUBEWHEEL2_COMMS_ERR = 17,
+    ADCS_STATE_CUBEWHEEL3_COMMS_ERR = 18,
+    ADCS_STATE_CUBESTAR_COMMS_ERR = 19,
+    ADCS_STATE_MAGNETOMETER_RANGE_ERR = 20,
+    ADCS_STATE_CAM1_SRAM_OVERCURRENT = 21,
+    ADCS_STATE_CAM1_3V3_OVERCURRENT = 22,
+    ADCS_STATE_CAM1_SENSOR_BUSY_ERR = 23,
+    ADCS_STATE_CAM1_SENSOR_DETECTION_ERR = 24,
+    ADCS_STATE_SUN_SENSOR_RANGE_ERR = 25,
+    ADCS_STATE_CAM2_SRAM_OVERCURRENT = 26,
+    ADCS_STATE_CAM2_3V3_OVERCURRENT = 27,
+    ADCS_STATE_CAM2_SENSOR_BUSY_ERR = 28,
+    ADCS_STATE_CAM2_SENSOR_DETECTION_ERR = 29,
+    ADCS_STATE_NADIR_SENSOR_RANGE_ERR = 30,
+    ADCS_STATE_RATE_SENSOR_RANGE_ERR = 31,
+    ADCS_STATE_WHEEL_SPEED_RANGE_ERR = 32,
+    ADCS_STATE_COARSE_SUN_SENSOR_ERR = 33,
+    ADCS_STATE_STAR_TRACKER_MATCH_ERR = 34,
+    ADCS_STATE_STAR_TRACKER_OVERCURRENT = 35,
+    ADCS_STATE_ORBIT_PARAMS_INVALID = 36,
+    ADCS_STATE_CONFIG_INVALID = 37,
+    ADCS_STATE_CTRL_MODE_CHANGE_NOT_ALLOWED = 38,
+    ADCS_STATE_ESTIMATOR_CHANGE_NOT_ALLOWED = 39,
+    ADCS_STATE_MAG_FIELD_MODEL_MISMATCH = 40,
+    ADCS_STATE_NODE_RECOVERY_ERR = 41,
+    ADCS_STATE_CUBESENSE1_RUNTIME_ERR = 42,
+    ADCS_STATE_CUBESENSE2_RUNTIME_ERR = 43,
+    ADCS_STATE_CUBECONTROL_SIGNAL_RUNTIME_ERR = 44,
+    ADCS_STATE_CUBECONTROL_MOTOR_RUNTIME_ERR = 45,
+    ADCS_STATE_CUBEWHEEL1_RUNTIME_ERR = 46,
+    ADCS_STATE_CUBEWHEEL2_RUNTIME_ERR = 47,
+    ADCS_STATE_CUBEWHEEL3_RUNTIME_ERR = 48,
+    ADCS_STATE_CUBESTAR_RUNTIME_ERR = 49,
+    ADCS_STATE_MAGNETOMETER_ERR = 50,
+    ADCS_STATE_RATE_SENSOR_FAILURE = 51,
+
+    ADCS_STATE_FLAG_COUNT = 52
+} adcs_state_flag;
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_STATE_FLAG_COUNT)];
+} adcs_state_flags;
+
+// Table 69, BootLoader state
+typedef enum {
+    ADCS_BOOT_SRAM1_ERR = 0,
+    ADCS_BOOT_SRAM2_ERR = 1,
+    ADCS_BOOT_SRAM_LATCH_NOT_RECOVERED = 2,
+    ADCS_BOOT_SRAM_LATCH_RECOVERED = 3,
+    ADCS_BOOT_SD_INITIAL_ERR = 4,
+    ADCS_BOOT_SD_READ_ERR = 5,
+    ADCS_BOOT_SD_WRITE_ERR = 6,
+    ADCS_BOOT_EXTERNAL_FLASH_ERR = 7,
+    ADCS_BOOT_INTERNAL_FLASH_ERR = 8,
+    ADCS_BOOT_EEPROM_ERR = 9,
+    ADCS_BOOT_BAD_BOOT_REG = 10,
+    ADCS_BOOT_COMMS_RADIO_ERR = 11,
+
+    ADCS_BOOT_FLAG_COUNT = 16 // the last 4 are reserved
+} adcs_boot_flag;
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_BOOT_FLAG_COUNT)];
+} adcs_boot_flags;
+
+// Table 101, CubeACP state
+typedef enum {
+    ADCS_ACP_CONFIG_LOAD_ERR = 0,
+    ADCS_ACP_ORBIT_PARAMS_LOAD_ERR = 1,
+    ADCS_ACP_SYSTEM_CONFIG_LOAD_ERR = 2,
+    ADCS_ACP_SD_INITIAL_ERR = 3,
+    ADCS_ACP_SD_READ_ERR = 4,
+    ADCS_ACP_SD_WRITE_ERR = 5,
+
+    ADCS_ACP_FLAG_COUNT = 6
+} adcs_acp_flag;
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_ACP_FLAG_COUNT)];
+} adcs_acp_flags;
+
+// Table 37, communication status bits 32-37: byte 4 of the frame, after the TC and TM counters.
+// Decoded by adcs_decode_comms_stat for both ADCS_get_comms_stat and the I2C read check
+typedef enum {
+    ADCS_COMMS_TC_BUFFER_OVERRUN = 0,
+    ADCS_COMMS_I2C_TM_ERR = 1,
+    ADCS_COMMS_UART_PROTOCOL_ERR = 2,
+    ADCS_COMMS_UART_INCOMPLETE_MSG = 3,
+    ADCS_COMMS_I2C_TC_BUFFER_OVERRUN = 4,
+    ADCS_COMMS_CAN_TC_BUFFER_OVERRUN = 5,
+
+    ADCS_COMMS_FLAG_COUNT = 6
+} adcs_comms_flag;
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_COMMS_FLAG_COUNT)];
+} adcs_comms_flags;
+
+// Table 159, CubeStar
+typedef enum {
+    ADCS_STAR_CAPTURE_OK = 0,
+    ADCS_STAR_DETECTION_OK = 1,
+    ADCS_STAR_IDENTIFICATION_OK = 2,
+    ADCS_STAR_ATTITUDE_OK = 3,
+    ADCS_STAR_PROCESSING_TIME_ERR = 4,
+    ADCS_STAR_TRACKING_EN = 5,
+    ADCS_STAR_PREDICTION_EN = 6,
+    ADCS_STAR_COMMS_ERR = 7,
+
+    ADCS_STAR_FLAG_COUNT = 8
+} adcs_star_flag;
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_STAR_FLAG_COUNT)];
+} adcs_star_flags;
+
+// Table 200, sensor selection and automatic transitions of the estimator
+typedef enum {
+    ADCS_ESTIMATION_USE_SUN_SENSOR = 0,
+    ADCS_ESTIMATION_USE_NADIR_SENSOR = 1,
+    ADCS_ESTIMATION_USE_CSS = 2,
+    ADCS_ESTIMATION_USE_STAR_TRACKER = 3,
+    ADCS_ESTIMATION_NADIR_TERMINATOR_CHECK = 4,
+    ADCS_ESTIMATION_AUTO_MTM_RECOVERY = 5,
+    ADCS_ESTIMATION_AUTO_TRANSITION = 6,
+
+    ADCS_ESTIMATION_FLAG_COUNT = 7
+} adcs_estimation_flag;
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_ESTIMATION_FLAG_COUNT)];
+} adcs_estimation_flags;
+
+// Table 211, telemetry frames selected for a log: one flag per frame, in the order of the manual
+#define ADCS_LOG_SELECT_COUNT 80
+
+typedef struct {
+    uint32_t word[ADCS_BITSET_WORDS(ADCS_LOG_SELECT_COUNT)];
+} adcs_log_select;
+
 typedef struct {
     uint8_t att_estimate_mode;
     uint8_t att_ctrl_mode;
     uint8_t run_mode;
     uint8_t ASGP4_mode;
-    uint8_t flags_arr[52];
+    adcs_state_flags flags;
     uint8_t MTM_sample_mode;
     xyz est_angle; // est: estimated
     xyz16 est_quaternion;
@@ -102,6 +270,23 @@ typedef struct {
     xyz16 ecef_pos;
 } adcs_state;
 
+// The _raw structs hold the counts as sent, scale them with the ADCS_*_SCALE constants in adcs_frames.h
+typedef struct {
+    uint8_t att_estimate_mode;
+    uint8_t att_ctrl_mode;
+    uint8_t run_mode;
+    uint8_t ASGP4_mode;
+    adcs_state_flags flags;
+    uint8_t MTM_sample_mode;
+    xyz16 est_angle;
+    xyz16 est_quaternion;
+    xyz16 est_angular_rate;
+    xyz16 ECI_pos;
+    xyz16 ECI_vel;
+    llh16 longlatalt;
+    xyz16 ecef_pos;
+} adcs_state_raw;
+
 typedef struct {
     xyz magnetic_field;
     xyz coarse_sun;
@@ -117,6 +302,21 @@ typedef struct {
     xyz star3o;
 } adcs_measures;
 
+typedef struct {
+    xyz16 magnetic_field;
+    xyz16 coarse_sun;
+    xyz16 sun;
+    xyz16 nadir;
+    xyz16 angular_rate;
+    xyz16 wheel_speed;
+    xyz16 star1b;
+    xyz16 star1o;
+    xyz16 star2b;
+    xyz16 star2o;
+    xyz16 star3b;
+    xyz16 star3o;
+} adcs_measures_raw;
+
 typedef struct {
     xyz magnetorquer;
     xyz wheel_speed;
@@ -132,6 +332,16 @@ typedef struct {
     xyz angular_rate_covar;
 } adcs_estimate;
 
+typedef struct {
+    xyz16 igrf_magnetic_field;
+    xyz16 sun;
+    xyz16 gyro_bias;
+    xyz16 innovation;
+    xyz16 quaternion_err;
+    xyz16 quaternion_covar;
+    xyz16 angular_rate_covar;
+} adcs_estimate_raw;
+
 typedef struct {
     float epoch;
     float inclination;
@@ -189,7 +399,7 @@ typedef struct {
     uint8_t identified_stars;
     uint8_t identification_mode; // Table 147
     uint8_t img_dark_val;
-    uint8_t flags_arr[8];
+    adcs_star_flags flags;
     uint16_t sample_T;
     star_data star1;
     star_data star2;
@@ -221,6 +431,26 @@ typedef struct {
     xyz16 rate_sensor_temp;
 } adcs_pwr_temp;
 
+typedef struct {
+    uint16_t cubesense1_3v3_I;
+    uint16_t cubesense1_camSram_I;
+    uint16_t cubesense2_3v3_I;
+    uint16_t cubesense2_camSram_I;
+    uint16_t cubecontrol_3v3_I;
+    uint16_t cubecontrol_5v_I;
+    uint16_t cubecontrol_vBat_I;
+    uint16_t wheel1_I;
+    uint16_t wheel2_I;
+    uint16_t wheel3_I;
+    uint16_t cubestar_I;
+    uint16_t magnetorquer_I;
+    int16_t cubestar_temp;
+    int16_t MCU_temp;
+    int16_t MTM_temp;
+    int16_t MTM2_temp;
+    xyz16 rate_sensor_temp;
+} adcs_pwr_temp_raw;
+
 typedef struct {
     double inclination;
     double ECC;   // eccentricity [deg]
@@ -402,7 +632,7 @@ typedef struct {
     float nadir_sensor_noise;
     float MTM_noise;
     float star_track_noise;
-    uint8_t select_arr[8];
+    adcs_estimation_flags select;
     uint8_t MTM_mode;
     uint8_t MTM_select;
     uint8_t cam_sample_period;
@@ -473,6 +703,7 @@ void get_3x3(float *matrix, uint8_t *address, float coef);
 
 // send_telecommand
 ADCS_returnState adcs_telecommand(uint8_t *command, uint32_t length);
+ADCS_returnState adcs_telecommands(uint8_t *commands, uint32_t length, uint32_t count);
 ADCS_returnState adcs_telemetry(uint8_t TM_ID, uint8_t *reply, uint32_t length);
 
 // Common Telecommands
@@ -487,11 +718,12 @@ ADCS_returnState ADCS_load_file_download_block(uint8_t file_type, uint8_t counte
 ADCS_returnState ADCS_advance_file_list_read_pointer(void);
 ADCS_returnState ADCS_initiate_file_upload(uint8_t file_dest, uint8_t block_size);
 ADCS_returnState ADCS_file_upload_packet(uint16_t packet_number, char *file_bytes);
+ADCS_returnState ADCS_file_upload_packets(const uint8_t *block, const uint16_t *packet_numbers, uint32_t count);
 ADCS_returnState ADCS_finalize_upload_block(uint8_t file_dest, uint32_t offset, uint16_t block_length);
 ADCS_returnState ADCS_reset_upload_block(void);
 ADCS_returnState ADCS_reset_file_list_read_pointer(void);
 ADCS_returnState ADCS_initiate_download_burst(uint8_t msg_length, bool ignore_hole_map);
-void ADCS_receive_download_burst(uint8_t *hole_map, uint8_t *image_bytes, uint16_t length_bytes);
+ADCS_returnState ADCS_receive_download_burst(uint8_t *hole_map, uint8_t *image_bytes, uint16_t length_bytes);
 
 // Common Telemetry
 ADCS_returnState ADCS_get_node_identification(
@@ -527,7 +759,9 @@ ADCS_returnState ADCS_get_EDAC_err_count(uint16_t* single_sram,
                                          uint16_t* double_sram,
                                          uint16_t* multi_sram);
 ADCS_returnState ADCS_get_comms_stat(uint16_t* TC_num, uint16_t* TM_num,
-                                     uint8_t* flags_arr);
+                                     adcs_comms_flags* flags);
+ADCS_returnState adcs_decode_comms_stat(const uint8_t *telemetry, uint32_t length, uint16_t *TC_num,
+                                        uint16_t *TM_num, adcs_comms_flags *flags);
 
 // Common Config Msgs
 ADCS_returnState ADCS_set_cache_en_state(bool en_state);
@@ -549,7 +783,7 @@ ADCS_returnState ADCS_read_program_info(uint8_t index);
 ADCS_returnState ADCS_copy_program_internal_flash(uint8_t index, uint8_t overwrite_flag);
 
 // BootLoader Telemetries
-ADCS_returnState ADCS_get_bootloader_state(uint16_t *uptime, uint8_t *flags_arr);
+ADCS_returnState ADCS_get_bootloader_state(uint16_t *uptime, adcs_boot_flags *flags);
 ADCS_returnState ADCS_get_program_info(uint8_t *index, bool *busy, uint32_t *file_size, uint16_t *crc16_checksum);
 ADCS_returnState ADCS_copy_internal_flash_progress(bool *busy, bool *err);
 
@@ -573,9 +807,10 @@ ADCS_returnState ADCS_save_orbit_params(void);
 
 // ACP Telemetry
 ADCS_returnState ADCS_get_current_state(adcs_state *data);
+ADCS_returnState ADCS_get_current_state_raw(adcs_state_raw *data);
 
 ADCS_returnState ADCS_get_jpg_cnv_progress(uint8_t *percentage, uint8_t *result, uint8_t *file_counter);
-ADCS_returnState ADCS_get_cubeACP_state(uint8_t *flags_arr);
+ADCS_returnState ADCS_get_cubeACP_state(adcs_acp_flags *flags);
 ADCS_returnState ADCS_get_sat_pos_LLH(xyz *target);
 ADCS_returnState ADCS_get_execution_times(uint16_t *adcs_update, uint16_t *sensor_comms, uint16_t *sgp4_propag,
                                           uint16_t *igrf_model);
@@ -583,19 +818,17 @@ ADCS_returnState ADCS_get_ACP_loop_stat(uint16_t *time, uint8_t *execution_point
 ADCS_returnState ADCS_get_img_save_progress(uint8_t *percentage, uint8_t *status);
 
 ADCS_returnState ADCS_get_measurements(adcs_measures *measurements);
+ADCS_returnState ADCS_get_measurements_raw(adcs_measures_raw *measurements);
 ADCS_returnState ADCS_get_actuator(adcs_actuator *commands);
 ADCS_returnState ADCS_get_estimation(adcs_estimate *data);
+ADCS_returnState ADCS_get_estimation_raw(adcs_estimate_raw *data);
 ADCS_returnState ADCS_get_ASGP4(bool *complete, uint8_t *err, adcs_asgp4 *asgp4);
-void get_cam_sensor(cam_sensor *cam, uint8_t *address);
 ADCS_returnState ADCS_get_raw_sensor(adcs_raw_sensor *measurements);
-void get_ecef(ecef *coordinate, uint8_t *address);
 ADCS_returnState ADCS_get_raw_GPS(adcs_raw_gps *measurements);
-void get_star_data(star_data *coordinate, uint8_t *address, uint8_t i);
 ADCS_returnState ADCS_get_star_tracker(adcs_star_track *measurements);
 ADCS_returnState ADCS_get_MTM2_measurements(xyz16 *Mag);
-void get_current(float *measurement, uint16_t raw, float coef);
-void get_temp(float *measurement, int16_t raw, float coef);
 ADCS_returnState ADCS_get_power_temp(adcs_pwr_temp *measurements);
+ADCS_returnState ADCS_get_power_temp_raw(adcs_pwr_temp_raw *measurements);
 
 // ACP Config Msgs
 ADCS_returnState ADCS_set_power_control(uint8_t *control);
@@ -604,8 +837,8 @@ ADCS_returnState ADCS_set_attitude_angle(xyz att_angle);
 ADCS_returnState ADCS_get_attitude_angle(xyz *att_angle);
 ADCS_returnState ADCS_set_track_controller(xyz target);
 ADCS_returnState ADCS_get_track_controller(xyz *target);
-ADCS_returnState ADCS_set_log_config(uint8_t **flags_arr, uint16_t period, uint8_t dest, uint8_t log);
-ADCS_returnState ADCS_get_log_config(uint8_t **flags_arr, uint16_t *period, uint8_t *dest, uint8_t log);
+ADCS_returnState ADCS_set_log_config(adcs_log_select select, uint16_t period, uint8_t dest, uint8_t log);
+ADCS_returnState ADCS_get_log_config(adcs_log_select *select, uint16_t *period, uint8_t *dest, uint8_t log);
 ADCS_returnState ADCS_set_inertial_ref(xyz iner_ref);
 ADCS_returnState ADCS_get_inertial_ref(xyz *iner_ref);
 
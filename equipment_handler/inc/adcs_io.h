@@ -16,10 +16,36 @@
 #define ADCS_IO_H
 
 #include <stdint.h>
+#include "adcs_transport.h"
 #include "adcs_types.h"
 
 #define ADCS_I2C_ADDR 0x57
 #define UART_TIMEOUT_MS 300
+#ifndef ADCS_UART_BAUD
+#define ADCS_UART_BAUD 115200
+#endif
+
+// Longest a single I2C transfer (up to a 504 byte frame) may take
+#ifndef ADCS_I2C_TIMEOUT_MS
+#define ADCS_I2C_TIMEOUT_MS 100
+#endif
+
+// I2C telecommand acknowledge polling: delay before each poll (the last entry repeats) and overall deadline
+#ifndef ADCS_I2C_ACK_BACKOFF_MS
+#define ADCS_I2C_ACK_BACKOFF_MS {1, 2, 5, 10, 20}
+#endif
+#ifndef ADCS_I2C_ACK_TIMEOUT_MS
+#define ADCS_I2C_ACK_TIMEOUT_MS 500
+#endif
+
+// Largest frames on the link, including the TC ID (set unit configuration / download block)
+#define ADCS_MAX_TC_LEN 174
+#define ADCS_MAX_TM_LEN 504
+
+// Transport selected by init_adcs_io, can be changed at runtime with adcs_select_transport
+#ifndef ADCS_DEFAULT_TRANSPORT
+#define ADCS_DEFAULT_TRANSPORT ADCS_TRANSPORT_UART
+#endif
 
 void init_adcs_io();
 
@@ -27,11 +53,17 @@ void init_adcs_io();
 ADCS_returnState send_uart_telecommand(uint8_t *command, uint32_t length);
 ADCS_returnState send_i2c_telecommand(uint8_t *command, uint32_t length);
 
+// sends several telecommands over uart without waiting for each acknowledge in turn
+ADCS_returnState send_uart_telecommands(uint8_t *commands, uint32_t length, uint32_t count);
+
 // request telemetry over uart/i2c, and return acknowledgment
 ADCS_returnState request_uart_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length);
 ADCS_returnState request_i2c_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length);
 
 // receive downloaded packets over uart
-ADCS_returnState receive_uart_packet(uint8_t *hole_map, uint8_t *image_bytes);
+ADCS_returnState receive_uart_packet(uint8_t *hole_map, uint8_t *image_bytes, uint32_t length_bytes, bool *added);
+
+extern const adcs_transport adcs_uart_transport;
+extern const adcs_transport adcs_i2c_transport;
 
 #endif /* ADCS_IO_H */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_lane.h
+ */
+
+#ifndef ADCS_LANE_H
+#define ADCS_LANE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+#include <os_semphr.h>
+
+#include "adcs_types.h"
+
+// Lower value wins the link when several lanes are waiting
+typedef enum ADCS_lane {
+    ADCS_LANE_REALTIME = 0, // state, measurement and everything else short
+    ADCS_LANE_BULK = 1,     // file transfer and whole configuration frames
+    ADCS_LANE_COUNT
+} ADCS_lane;
+
+/*
+ * Replaces a plain mutex on a link: whenever the owner releases, the link is handed straight
+ * to a waiter of the highest priority lane, so a run of bulk frames can delay a real-time
+ * request by at most one frame. There is no priority inheritance.
+ */
+typedef struct {
+    bool busy;
+    uint8_t waiting[ADCS_LANE_COUNT];
+    SemaphoreHandle_t handover[ADCS_LANE_COUNT];
+} adcs_lane_arbiter;
+
+ADCS_returnState adcs_lane_init(adcs_lane_arbiter *arbiter);
+bool adcs_lane_acquire(adcs_lane_arbiter *arbiter, ADCS_lane lane, TickType_t timeout);
+void adcs_lane_release(adcs_lane_arbiter *arbiter);
+ADCS_lane adcs_lane_of(uint8_t id);
+
+#endif /* ADCS_LANE_H */
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_ring.h
+ */
+
+#ifndef ADCS_RING_H
+#define ADCS_RING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Single-producer/single-consumer byte ring. head is only written by the producer
+ * (an ISR or a DMA channel) and tail only by the consumer, so no locking is needed.
+ * Both are free-running and wrapped with the mask on access, which keeps a full
+ * ring distinguishable from an empty one.
+ */
+typedef struct {
+    uint8_t *buf;
+    uint32_t mask; // size - 1, size must be a power of two
+    volatile uint32_t head;
+    volatile uint32_t tail;
+} adcs_ring;
+
+void adcs_ring_init(adcs_ring *ring, uint8_t *buf, uint32_t size);
+
+// producer side
+bool adcs_ring_put(adcs_ring *ring, uint8_t byte);
+void adcs_ring_produced(adcs_ring *ring, uint32_t count);
+
+// consumer side
+uint32_t adcs_ring_count(const adcs_ring *ring);
+uint32_t adcs_ring_peek(const adcs_ring *ring, const uint8_t **data);
+uint32_t adcs_ring_read(adcs_ring *ring, uint8_t *dst, uint32_t count);
+void adcs_ring_flush(adcs_ring *ring);
+
+#endif /* ADCS_RING_H */
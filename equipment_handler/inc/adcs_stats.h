@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_stats.h
+ */
+
+#ifndef ADCS_STATS_H
+#define ADCS_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Round-trip histogram: bucket 0 counts < 1 ms, bucket b counts [2^(b-1), 2^b) ms,
+// the last bucket everything from 512 ms up (UART_TIMEOUT_MS lands in bucket 9)
+#define ADCS_STATS_BUCKETS 11
+
+typedef struct {
+    uint32_t calls;
+    uint32_t timeouts;
+    uint32_t bytes_sent;     // on the wire, including framing and stuffing
+    uint32_t bytes_received; // on the wire, including framing and stuffing
+    uint16_t rtt_hist[ADCS_STATS_BUCKETS]; // saturates at UINT16_MAX
+} adcs_id_stats;
+
+void adcs_stats_record(uint8_t id, uint32_t sent, uint32_t received, uint32_t rtt_ms, bool timed_out);
+void adcs_stats_get(uint8_t id, adcs_id_stats *stats);
+void adcs_stats_reset(void);
+
+#endif /* ADCS_STATS_H */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_transport.h
+ */
+
+#ifndef ADCS_TRANSPORT_H
+#define ADCS_TRANSPORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "adcs_types.h"
+
+#define ADCS_TC_WINDOW 8 // most telecommands send_telecommands takes at once
+
+typedef enum ADCS_transportId {
+    ADCS_TRANSPORT_UART = 0,
+    ADCS_TRANSPORT_I2C = 1,
+    ADCS_TRANSPORT_LOOPBACK = 2,
+
+    ADCS_TRANSPORT_COUNT
+} ADCS_transportId;
+
+/*
+ * One bus to the CubeADCS. Operations a bus cannot perform are left NULL and
+ * report ADCS_INVALID_PARAMETERS when called through the handler.
+ */
+typedef struct adcs_transport {
+    const char *name;
+    ADCS_returnState (*send_telecommand)(uint8_t *command, uint32_t length);
+    // count telecommands of length bytes back to back, without a round trip per acknowledge
+    ADCS_returnState (*send_telecommands)(uint8_t *commands, uint32_t length, uint32_t count);
+    ADCS_returnState (*request_telemetry)(uint8_t TM_ID, uint8_t *telemetry, uint32_t length);
+    // added is set when the packet filled a hole, so the caller can count down without rescanning the map
+    ADCS_returnState (*receive_packet)(uint8_t *hole_map, uint8_t *image_bytes, uint32_t length_bytes, bool *added);
+} adcs_transport;
+
+extern const adcs_transport adcs_loopback_transport;
+
+void adcs_register_transport(ADCS_transportId id, const adcs_transport *transport);
+const adcs_transport *adcs_get_transport(ADCS_transportId id);
+ADCS_returnState adcs_select_transport(ADCS_transportId id);
+const adcs_transport *adcs_active_transport(void);
+
+#endif /* ADCS_TRANSPORT_H */
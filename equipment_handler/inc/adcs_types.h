@@ -19,10 +19,17 @@
 #define ADCS_Telecommand 0;
 #define ADCS_TC_TR_Mask 0x80;
 
-#define ADCS_MAGIC_NUMBER 0x5A;
-#define ADCS_ESC_CHAR 0x1F;
-#define ADCS_SOM 0x7F;
-#define ADCS_EOM 0xFF;
+#define ADCS_MAGIC_NUMBER 0x5A
+#define ADCS_ESC_CHAR 0x1F
+#define ADCS_SOM 0x7F
+#define ADCS_EOM 0xFF
+
+// File download blocks: up to 1024 packets of 20 bytes, tracked by a 1024 bit hole map
+// that is exchanged with the ADCS as 8 maps of 16 bytes
+#define ADCS_DL_PACKET_LEN 20
+#define ADCS_DL_BLOCK_PACKETS 1024
+#define ADCS_DL_BLOCK_LEN (ADCS_DL_BLOCK_PACKETS * ADCS_DL_PACKET_LEN)
+#define ADCS_HOLE_MAP_LEN (ADCS_DL_BLOCK_PACKETS / 8)
 
 typedef enum ADCS_returnState {
     ADCS_OK = 0,
@@ -33,7 +40,9 @@ typedef enum ADCS_returnState {
     ADCS_MALLOC_FAILED = 5,
     ADCS_UART_FAILED = 6,
 
-    IS_STUBBED_A = 7 // Used for stubbed ADCS in hardware interface
+    IS_STUBBED_A = 7, // Used for stubbed ADCS in hardware interface
+    ADCS_FS_FAILED = 8, // OBC filesystem error while saving a transfer
+    ADCS_BUSY = 9       // another transfer of the same kind is running
 } ADCS_returnState;
 
 typedef enum Common_Telecommand_IDs {
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_upload.h
+ */
+
+#ifndef ADCS_UPLOAD_H
+#define ADCS_UPLOAD_H
+
+#include <stdint.h>
+
+#include "adcs_types.h"
+
+// Block size field of Initiate File Upload in kB, the blocks themselves are ADCS_DL_BLOCK_LEN
+#ifndef ADCS_UPLOAD_INIT_BLOCK_SIZE
+#define ADCS_UPLOAD_INIT_BLOCK_SIZE (ADCS_DL_BLOCK_LEN / 1024)
+#endif
+
+#define ADCS_UPLOAD_MAX_PASSES 8                         // sends of the missing packets per block
+#define ADCS_UPLOAD_POLL_BACKOFF_MS {5, 10, 20, 50, 100} // between status polls, the last entry repeats
+#define ADCS_UPLOAD_INIT_TIMEOUT_MS 10000                // ADCS preparing the destination, may erase a slot
+#define ADCS_UPLOAD_FINALIZE_TIMEOUT_MS 5000             // ADCS writing a block to flash or SD
+
+// Called after each block is written on the ADCS with the file offset uploaded up to
+typedef ADCS_returnState (*adcs_upload_checkpoint)(void *context, uint32_t offset);
+
+ADCS_returnState adcs_upload_file(const char *path, uint8_t file_dest);
+ADCS_returnState adcs_upload_file_from(const char *path, uint8_t file_dest, uint32_t offset,
+                                       adcs_upload_checkpoint checkpoint, void *context);
+
+#endif /* ADCS_UPLOAD_H */
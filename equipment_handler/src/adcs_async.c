@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_async.c
+ */
+
+#include "adcs_async.h"
+
+#include <stddef.h>
+#include <os_queue.h>
+
+#include "adcs_handler.h"
+
+static QueueHandle_t request_queue;
+
+/**
+ * @brief
+ *      Service task: owns the ADCS link and runs queued requests back to back
+ * @details
+ *      Completion is signalled as soon as the reply is in the caller's buffer, so the
+ *      submitter decodes it on its own task while the next request is already on the wire.
+ *      Once done is set the submitter may free or reuse the request, so the callback runs
+ *      before it and the task to notify is copied out first.
+ */
+static void adcs_service_task(void *pvParameters) {
+    (void)pvParameters;
+    adcs_request *request;
+
+    for (;;) {
+        if (xQueueReceive(request_queue, &request, portMAX_DELAY) != pdPASS) {
+            continue;
+        }
+
+        if (request->type == ADCS_REQUEST_TELEMETRY) {
+            request->result = adcs_telemetry(request->TM_ID, request->data, request->length);
+        } else {
+            request->result = adcs_telecommand(request->data, request->length);
+        }
+
+        adcs_request_callback callback = request->callback;
+        TaskHandle_t notify = request->notify;
+        if (callback != NULL) {
+            callback(request);
+        }
+
+        // The critical section orders the result before done for a waiter on another task
+        taskENTER_CRITICAL();
+        request->done = true;
+        taskEXIT_CRITICAL();
+
+        if (notify != NULL) {
+            xTaskNotifyGive(notify);
+        }
+    }
+}
+
+/**
+ * @brief
+ *      Create the request queue and the ADCS service task
+ * @return
+ *      ADCS_MALLOC_FAILED if either could not be created
+ */
+ADCS_returnState adcs_async_init(void) {
+    request_queue = xQueueCreate(ADCS_REQUEST_QUEUE_LEN, sizeof(adcs_request *));
+    if (request_queue == NULL) {
+        return ADCS_MALLOC_FAILED;
+    }
+    if (xTaskCreate(adcs_service_task, "adcs_service", ADCS_SERVICE_STACK_SIZE, NULL, ADCS_SERVICE_PRIORITY,
+                    NULL) != pdPASS) {
+        return ADCS_MALLOC_FAILED;
+    }
+    return ADCS_OK;
+}
+
+static ADCS_returnState adcs_submit(adcs_request *request, TickType_t wait) {
+    request->done = false;
+    request->result = ADCS_OK;
+    if (xQueueSendToBack(request_queue, &request, wait) != pdPASS) {
+        return ADCS_UART_FAILED;
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Queue a telecommand without waiting for the reply
+ * @param request
+ *      Request storage, must remain valid until completion
+ * @param command
+ *      Telecommand frame including the TC ID
+ * @param length
+ *      Length of the command (in bytes)
+ * @param wait
+ *      Ticks to wait for space in the request queue
+ * @return
+ *      ADCS_OK once queued, ADCS_UART_FAILED if the queue stayed full
+ */
+ADCS_returnState adcs_submit_telecommand(adcs_request *request, uint8_t *command, uint32_t length,
+                                         TickType_t wait) {
+    request->type = ADCS_REQUEST_TELECOMMAND;
+    request->data = command;
+    request->length = length;
+    return adcs_submit(request, wait);
+}
+
+/**
+ * @brief
+ *      Queue a telemetry request without waiting for the reply
+ * @param request
+ *      Request storage, must remain valid until completion
+ * @param TM_ID
+ *      Telemetry ID byte
+ * @param reply
+ *      Buffer the telemetry is received into
+ * @param length
+ *      Length of the telemetry (in bytes)
+ * @param wait
+ *      Ticks to wait for space in the request queue
+ * @return
+ *      ADCS_OK once queued, ADCS_UART_FAILED if the queue stayed full
+ */
+ADCS_returnState adcs_submit_telemetry(adcs_request *request, uint8_t TM_ID, uint8_t *reply, uint32_t length,
+                                       TickType_t wait) {
+    request->type = ADCS_REQUEST_TELEMETRY;
+    request->TM_ID = TM_ID;
+    request->data = reply;
+    request->length = length;
+    return adcs_submit(request, wait);
+}
+
+/**
+ * @brief
+ *      Block until a request submitted with notify set to the calling task completes
+ * @details
+ *      Each completion gives one notification, so a task can have several requests
+ *      outstanding and wait on them in any order.
+ * @return
+ *      Result of the request, or ADCS_UART_FAILED on timeout
+ */
+ADCS_returnState adcs_request_wait(adcs_request *request, TickType_t timeout) {
+    TickType_t start = xTaskGetTickCount();
+
+    while (!request->done) {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (elapsed >= timeout) {
+            return ADCS_UART_FAILED;
+        }
+        ulTaskNotifyTake(pdFALSE, timeout - elapsed);
+    }
+    return request->result;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_deadline.c
+ * @brief
+ *      Per TC/TM ID transaction deadlines from a smoothed round-trip estimate
+ *      (srtt + 4 * rttvar, as used for TCP retransmission timeouts).
+ *
+ *      Callers serialise on the link mutex, so the estimator needs no locking of its own.
+ */
+
+#include "adcs_deadline.h"
+#include "adcs_io.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+static bool sampled[256];
+static uint32_t srtt_x8[256];   // smoothed RTT in ms, scaled by 8
+static uint32_t rttvar_x4[256]; // RTT mean deviation in ms, scaled by 4
+
+/**
+ * @brief
+ *      Time to clock bytes over the UART (8N1), rounded up
+ */
+static uint32_t wire_time_ms(uint32_t bytes) { return (bytes * 10 * 1000 + ADCS_UART_BAUD - 1) / ADCS_UART_BAUD; }
+
+/**
+ * @brief
+ *      Feed a completed transaction into the estimate for its ID
+ */
+void adcs_deadline_observe(uint8_t id, uint32_t rtt_ms) {
+    if (!sampled[id]) {
+        sampled[id] = true;
+        srtt_x8[id] = rtt_ms * 8;
+        rttvar_x4[id] = rtt_ms * 2;
+        return;
+    }
+    int32_t err = (int32_t)rtt_ms - (int32_t)(srtt_x8[id] >> 3);
+    srtt_x8[id] += err;
+    rttvar_x4[id] += (err < 0 ? -err : err) - (int32_t)(rttvar_x4[id] >> 2);
+}
+
+/**
+ * @brief
+ *      A transaction for id ran out of time: widen its budget so a slower ADCS is re-learnt
+ */
+void adcs_deadline_expired(uint8_t id) {
+    if (sampled[id]) {
+        rttvar_x4[id] = (rttvar_x4[id] < UART_TIMEOUT_MS) ? rttvar_x4[id] * 2 + 1 : UART_TIMEOUT_MS;
+    }
+}
+
+/**
+ * @brief
+ *      Time allowed for one whole transaction, from the first byte sent to the last received
+ * @param id
+ *      TC/TM ID of the transaction
+ * @param wire_bytes
+ *      Bytes sent plus bytes expected back
+ * @return
+ *      The wire time plus UART_TIMEOUT_MS until id has been seen, afterwards
+ *      srtt + 4 * rttvar kept within [wire time + ADCS_DEADLINE_MARGIN_MS, wire time + UART_TIMEOUT_MS]
+ */
+uint32_t adcs_deadline_budget_ms(uint8_t id, uint32_t wire_bytes) {
+    uint32_t wire = wire_time_ms(wire_bytes);
+    uint32_t ceiling = wire + UART_TIMEOUT_MS;
+
+    if (!sampled[id]) {
+        return ceiling;
+    }
+    uint32_t budget = (srtt_x8[id] >> 3) + rttvar_x4[id];
+    if (budget < wire + ADCS_DEADLINE_MARGIN_MS) {
+        budget = wire + ADCS_DEADLINE_MARGIN_MS;
+    }
+    return (budget < ceiling) ? budget : ceiling;
+}
+
+void adcs_deadline_reset(void) {
+    memset(sampled, 0, sizeof(sampled));
+    memset(srtt_x8, 0, sizeof(srtt_x8));
+    memset(rttvar_x4, 0, sizeof(rttvar_x4));
+}
@@ -0,0 +1,568 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_download.c
+ * @brief
+ *      Block by block download of a CubeADCS file to the OBC filesystem, resumable.
+ *
+ *      After every burst the packets received so far are written into place in the
+ *      destination file, followed by a small state file holding the file identity, the
+ *      block in progress and its hole map. A later call with the same file picks up from
+ *      there, reloading the block on the ADCS (it may have been reset) and only asking
+ *      for the packets still missing.
+ *
+ *      Blocks are pipelined over two buffers: once a block is complete in memory the ADCS
+ *      is told to load the next one from its SD card and the finished block is handed to a
+ *      writer task, so its write and fsync overlap both the load and the burst of the next
+ *      block. The writer takes one write at a time, data before the state that describes
+ *      it, and every other filesystem access waits for it, so the saved state never gets
+ *      ahead of the file. If the writer task or the second buffer cannot be had, the same
+ *      writes run on the caller in the same order. One download runs at a time, under
+ *      download_mutex.
+ *
+ *      Each block is checked against the CRC in its download status and the whole file
+ *      against the CRC in the file list. Packets are folded into both CRCs in order as the
+ *      bursts bring them in, so neither check reads the data back.
+ */
+
+#include "adcs_download.h"
+#include "adcs_crc16.h"
+#include "adcs_handler.h"
+#include "adcs_transport.h"
+
+#include "FreeRTOS.h"
+#include "os_queue.h"
+#include "os_semphr.h"
+#include "os_task.h"
+#include "redposix.h"
+#include <string.h>
+
+#define DOWNLOAD_MAGIC 0x41444C32 // "ADL2"
+
+static const uint16_t download_backoff_ms[] = ADCS_DOWNLOAD_POLL_BACKOFF_MS;
+
+/*
+ * Reliance Edge commits a write together with its fsync as one transaction, so the state
+ * file always holds either the previous or the new state, never a mix.
+ */
+typedef struct {
+    uint32_t magic;
+    adcs_file_info file;
+    uint32_t offset;                     // start of the block in progress, all before it is on disk
+    uint16_t file_crc;                   // CRC of the file up to offset
+    uint8_t hole_map[ADCS_HOLE_MAP_LEN]; // packets of that block already on disk
+} download_state;
+
+// CRCs over the packets of the block in progress that are in memory with none missing before them
+typedef struct {
+    uint16_t block;   // from ADCS_CRC16_INIT, compared with the block download status
+    uint16_t file;    // continued from download_state.file_crc
+    uint32_t packets; // packets folded in so far
+} block_crc;
+
+// A write for the writer task: the data, if any, then the state that describes it
+typedef struct {
+    int32_t fd;
+    const char *spath;
+    const uint8_t *data; // NULL to only save the state
+    uint32_t offset;
+    uint16_t length;
+    download_state st;
+} download_write;
+
+// The destination of one download and the write it has in flight, at most one
+typedef struct {
+    int32_t fd;
+    const char *spath;
+    bool async;          // the writer task is running, otherwise writes run on the caller
+    bool busy;           // a write was queued and its result not taken yet
+    const uint8_t *data; // buffer the write in flight reads from
+} download_out;
+
+static SemaphoreHandle_t download_mutex; // held by the download in progress
+static QueueHandle_t write_queue;        // download_write, to the writer task
+static QueueHandle_t result_queue;       // ADCS_returnState of each write, back from it
+static bool writer_running;              // write_queue, result_queue and the writer task exist
+
+static bool state_path(const char *path, char *state) {
+    size_t len = strlen(path);
+    if (len > ADCS_DOWNLOAD_PATH_MAX) {
+        return false;
+    }
+    memcpy(state, path, len);
+    memcpy(state + len, ADCS_DOWNLOAD_STATE_EXT, sizeof(ADCS_DOWNLOAD_STATE_EXT));
+    return true;
+}
+
+static bool same_file(const adcs_file_info *a, const adcs_file_info *b) {
+    return a->type == b->type && a->counter == b->counter && a->size == b->size && a->time == b->time &&
+           a->crc16 == b->crc16;
+}
+
+static bool hole_map_empty(const uint8_t *hole_map) {
+    for (int i = 0; i < ADCS_HOLE_MAP_LEN; i++) {
+        if (hole_map[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool hole_map_test(const uint8_t *hole_map, uint32_t packet) {
+    return (hole_map[packet / 8] >> (packet % 8)) & 1;
+}
+
+static uint32_t hole_map_count(const uint8_t *hole_map) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < ADCS_DL_BLOCK_PACKETS; i++) {
+        count += hole_map_test(hole_map, i);
+    }
+    return count;
+}
+
+/**
+ * @brief
+ *      Fold the packets that arrived since the last call into the CRCs, up to the first hole
+ */
+static void block_crc_fold(block_crc *crc, const uint8_t *hole_map, const uint8_t *block, uint16_t length) {
+    uint32_t packets = (length + ADCS_DL_PACKET_LEN - 1) / ADCS_DL_PACKET_LEN;
+
+    while (crc->packets < packets && hole_map_test(hole_map, crc->packets)) {
+        uint32_t pos = crc->packets * ADCS_DL_PACKET_LEN;
+        uint32_t len = (length - pos < ADCS_DL_PACKET_LEN) ? length - pos : ADCS_DL_PACKET_LEN;
+
+        crc->block = adcs_crc16_update(crc->block, block + pos, len);
+        crc->file = adcs_crc16_update(crc->file, block + pos, len);
+        crc->packets++;
+    }
+}
+
+/**
+ * @brief
+ *      Read a saved state, false if there is none or it is not a state file
+ */
+static bool state_load(const char *spath, download_state *st) {
+    int32_t fd = red_open(spath, RED_O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = (red_read(fd, st, sizeof(*st)) == sizeof(*st)) && st->magic == DOWNLOAD_MAGIC;
+    red_close(fd);
+    return ok;
+}
+
+static ADCS_returnState state_save(const char *spath, const download_state *st) {
+    int32_t fd = red_open(spath, RED_O_WRONLY | RED_O_CREAT | RED_O_TRUNC);
+    if (fd < 0) {
+        return ADCS_FS_FAILED;
+    }
+    bool ok = (red_write(fd, st, sizeof(*st)) == sizeof(*st)) && red_fsync(fd) == 0;
+    red_close(fd);
+    return ok ? ADCS_OK : ADCS_FS_FAILED;
+}
+
+static bool file_write(int32_t fd, uint32_t offset, const uint8_t *data, uint32_t length) {
+    return red_lseek(fd, offset, RED_SEEK_SET) == (int64_t)offset &&
+           red_write(fd, data, length) == (int32_t)length && red_fsync(fd) == 0;
+}
+
+static bool file_read(int32_t fd, uint32_t offset, uint8_t *data, uint32_t length) {
+    return red_lseek(fd, offset, RED_SEEK_SET) == (int64_t)offset && red_read(fd, data, length) >= 0;
+}
+
+static ADCS_returnState write_run(const download_write *write) {
+    if (write->data != NULL && !file_write(write->fd, write->offset, write->data, write->length)) {
+        return ADCS_FS_FAILED;
+    }
+    return state_save(write->spath, &write->st);
+}
+
+static void download_writer_task(void *pvParameters) {
+    (void)pvParameters;
+    download_write write;
+
+    for (;;) {
+        if (xQueueReceive(write_queue, &write, portMAX_DELAY) != pdPASS) {
+            continue;
+        }
+        ADCS_returnState result = write_run(&write);
+        xQueueSendToBack(result_queue, &result, portMAX_DELAY);
+    }
+}
+
+/**
+ * @brief
+ *      Create the download mutex, the writer task and its queues, once before any download
+ * @details
+ *      If the writer task or its queues cannot be created downloads still run, writing on
+ *      the caller.
+ * @return
+ *      ADCS_MALLOC_FAILED if the mutex could not be created
+ */
+ADCS_returnState adcs_download_init(void) {
+    download_mutex = xSemaphoreCreateMutex();
+    if (download_mutex == NULL) {
+        return ADCS_MALLOC_FAILED;
+    }
+    write_queue = xQueueCreate(1, sizeof(download_write));
+    result_queue = xQueueCreate(1, sizeof(ADCS_returnState));
+    writer_running = write_queue != NULL && result_queue != NULL &&
+                     xTaskCreate(download_writer_task, "adcs_dl_writer", ADCS_DOWNLOAD_WRITER_STACK_SIZE, NULL,
+                                 ADCS_DOWNLOAD_WRITER_PRIORITY, NULL) == pdPASS;
+    return ADCS_OK;
+}
+
+// Wait for the write in flight, if any, and take its result
+static ADCS_returnState write_wait(download_out *out) {
+    ADCS_returnState result = ADCS_OK;
+
+    if (out->busy) {
+        xQueueReceive(result_queue, &result, portMAX_DELAY);
+        out->busy = false;
+    }
+    return result;
+}
+
+/**
+ * @brief
+ *      Queue data for offset followed by a copy of st, once the write before it is done
+ * @details
+ *      data must stay untouched until the write is waited for. Without the writer task the
+ *      write runs here.
+ * @return
+ *      The result of the write before it, or of this one if it ran here
+ */
+static ADCS_returnState write_start(download_out *out, const uint8_t *data, uint32_t offset, uint16_t length,
+                                    const download_state *st) {
+    ADCS_returnState state = write_wait(out);
+    if (state != ADCS_OK) {
+        return state;
+    }
+    download_write write = {
+        .fd = out->fd, .spath = out->spath, .data = data, .offset = offset, .length = length, .st = *st};
+    if (!out->async) {
+        return write_run(&write);
+    }
+    xQueueSendToBack(write_queue, &write, portMAX_DELAY);
+    out->busy = true;
+    out->data = data;
+    return ADCS_OK;
+}
+
+static ADCS_returnState write_now(download_out *out, const uint8_t *data, uint32_t offset, uint16_t length,
+                                  const download_state *st) {
+    ADCS_returnState state = write_start(out, data, offset, length, st);
+    return (state == ADCS_OK) ? write_wait(out) : state;
+}
+
+static uint16_t block_length(const adcs_file_info *file, uint32_t offset) {
+    uint32_t remaining = file->size - offset;
+    return (remaining < ADCS_DL_BLOCK_LEN) ? remaining : ADCS_DL_BLOCK_LEN;
+}
+
+/**
+ * @brief
+ *      Wait for a block load started with ADCS_load_file_download_block to finish
+ * @details
+ *      The status is checked once straight away, the load may already have finished, then
+ *      polled backing off.
+ */
+static ADCS_returnState block_load_wait(uint16_t length, uint16_t *crc16) {
+    uint32_t waited = 0;
+    uint32_t step = 0;
+
+    for (;;) {
+        bool ready, param_err;
+        uint16_t loaded;
+
+        ADCS_returnState state = ADCS_get_file_download_block_stat(&ready, &param_err, crc16, &loaded);
+        if (state != ADCS_OK) {
+            return state;
+        }
+        if (param_err) {
+            return ADCS_INVALID_PARAMETERS;
+        }
+        if (ready) {
+            return (loaded == length) ? ADCS_OK : ADCS_INCORRECT_LENGTH;
+        }
+        if (waited >= ADCS_DOWNLOAD_LOAD_TIMEOUT_MS) {
+            return ADCS_UART_FAILED;
+        }
+        vTaskDelay(pdMS_TO_TICKS(download_backoff_ms[step]));
+        waited += download_backoff_ms[step];
+        if (step + 1 < sizeof(download_backoff_ms) / sizeof(download_backoff_ms[0])) {
+            step++;
+        }
+    }
+}
+
+static ADCS_returnState hole_map_send(const uint8_t *hole_map) {
+    for (uint8_t num = 1; num <= ADCS_HOLE_MAP_LEN / 16; num++) {
+        ADCS_returnState state = ADCS_set_hole_map((uint8_t *)&hole_map[(num - 1) * 16], num);
+        if (state != ADCS_OK) {
+            return state;
+        }
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Burst the block at st->offset until every packet is in memory and its CRC matches
+ * @details
+ *      Passes that end with holes save what arrived; the complete block is left in block
+ *      for block_commit. A block that arrives whole with the wrong CRC is fetched again.
+ *      block must not be the buffer of the write still in flight, if any.
+ * @param loading
+ *      The load of this block was already started, only wait for it
+ * @param file_crc
+ *      Set to the file CRC up to the end of this block
+ */
+static ADCS_returnState block_burst(download_out *out, download_state *st, uint8_t *block, uint16_t length,
+                                    bool loading, uint16_t *file_crc) {
+    block_crc crc = {.block = ADCS_CRC16_INIT, .file = st->file_crc, .packets = 0};
+    uint16_t expected;
+    ADCS_returnState state;
+
+    // Packets kept from an earlier run are read back so the block is completed in memory
+    if (!hole_map_empty(st->hole_map)) {
+        state = write_wait(out);
+        if (state != ADCS_OK) {
+            return state;
+        }
+        if (!file_read(out->fd, st->offset, block, length)) {
+            return ADCS_FS_FAILED;
+        }
+    }
+    if (!loading) {
+        state = ADCS_load_file_download_block(st->file.type, st->file.counter, st->offset, length);
+        if (state != ADCS_OK) {
+            return state;
+        }
+    }
+    state = block_load_wait(length, &expected);
+    if (state != ADCS_OK) {
+        return state;
+    }
+
+    for (int pass = 0; pass < ADCS_DOWNLOAD_MAX_PASSES; pass++) {
+        bool fresh = hole_map_empty(st->hole_map);
+        if (!fresh) {
+            state = hole_map_send(st->hole_map);
+            if (state != ADCS_OK) {
+                return state;
+            }
+        }
+        state = ADCS_initiate_download_burst(ADCS_DL_PACKET_LEN, fresh);
+        if (state != ADCS_OK) {
+            return state;
+        }
+
+        // ADCS_UART_FAILED: the burst ended with holes, keep what did arrive
+        state = ADCS_receive_download_burst(st->hole_map, block, length);
+        if (state != ADCS_OK && state != ADCS_UART_FAILED) {
+            return state;
+        }
+        block_crc_fold(&crc, st->hole_map, block, length);
+        if (state == ADCS_OK) {
+            if (crc.block == expected) {
+                *file_crc = crc.file;
+                return ADCS_OK;
+            }
+            // Corrupted on the way in, the burst has no per packet check: start the block over
+            memset(st->hole_map, 0, sizeof(st->hole_map));
+            crc = (block_crc){.block = ADCS_CRC16_INIT, .file = st->file_crc, .packets = 0};
+            state = ADCS_CRC_ERROR;
+        }
+        // Finished before the next pass bursts into block again
+        ADCS_returnState written = write_now(out, (state == ADCS_CRC_ERROR) ? NULL : block, st->offset, length, st);
+        if (written != ADCS_OK) {
+            return written;
+        }
+    }
+    return state;
+}
+
+/**
+ * @brief
+ *      Move on to the next block and queue the complete one to be written with that state
+ * @details
+ *      The state on disk only moves on once the block is there. A failed write is returned
+ *      by the next write_start or write_wait.
+ */
+static ADCS_returnState block_commit(download_out *out, download_state *st, const uint8_t *block,
+                                     uint16_t length, uint16_t file_crc) {
+    uint32_t offset = st->offset;
+
+    st->offset += length;
+    st->file_crc = file_crc;
+    memset(st->hole_map, 0, sizeof(st->hole_map));
+    return write_start(out, block, offset, length, st);
+}
+
+// adcs_download_file with download_mutex held
+static ADCS_returnState download_run(const adcs_file_info *file, const char *path) {
+    char spath[ADCS_DOWNLOAD_PATH_MAX + sizeof(ADCS_DOWNLOAD_STATE_EXT)];
+    download_state st;
+
+    const adcs_transport *transport = adcs_active_transport();
+    if (!state_path(path, spath) || transport == NULL || transport->receive_packet == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    bool resume = state_load(spath, &st) && same_file(&st.file, file);
+    if (!resume) {
+        memset(&st, 0, sizeof(st));
+        st.magic = DOWNLOAD_MAGIC;
+        st.file = *file;
+        st.file_crc = ADCS_CRC16_INIT;
+    }
+
+    int32_t fd = red_open(path, RED_O_RDWR | RED_O_CREAT | (resume ? 0 : RED_O_TRUNC));
+    if (fd < 0) {
+        return ADCS_FS_FAILED;
+    }
+    uint8_t *blocks[2];
+    blocks[0] = (uint8_t *)pvPortMalloc(ADCS_DL_BLOCK_LEN);
+    if (blocks[0] == NULL) {
+        red_close(fd);
+        return ADCS_MALLOC_FAILED;
+    }
+    blocks[1] = (uint8_t *)pvPortMalloc(ADCS_DL_BLOCK_LEN);
+    if (blocks[1] == NULL) {
+        blocks[1] = blocks[0]; // each block is then written out before the next burst
+    }
+    download_out out = {.fd = fd, .spath = spath, .async = writer_running, .busy = false, .data = NULL};
+
+    ADCS_returnState state = resume ? ADCS_OK : state_save(spath, &st);
+    bool loading = false;
+    for (uint32_t n = 0; state == ADCS_OK && st.offset < file->size; n++) {
+        uint8_t *block = blocks[n % 2];
+        uint16_t length = block_length(file, st.offset);
+        uint16_t file_crc = st.file_crc;
+
+        if (out.busy && out.data == block) {
+            state = write_wait(&out);
+            if (state != ADCS_OK) {
+                break;
+            }
+        }
+        state = block_burst(&out, &st, block, length, loading, &file_crc);
+        if (state != ADCS_OK) {
+            break;
+        }
+
+        // The ADCS is done with this block, have it load the next one while this one goes to disk.
+        // A failed load is not fatal here, the next block_burst starts it again.
+        uint32_t next = st.offset + length;
+        loading = next < file->size &&
+                  ADCS_load_file_download_block(file->type, file->counter, next, block_length(file, next)) == ADCS_OK;
+        state = block_commit(&out, &st, block, length, file_crc);
+    }
+
+    ADCS_returnState written = write_wait(&out);
+    if (state == ADCS_OK) {
+        state = written;
+    }
+    if (blocks[1] != blocks[0]) {
+        vPortFree(blocks[1]);
+    }
+    vPortFree(blocks[0]);
+    red_close(fd);
+    if (state == ADCS_OK && st.file_crc != file->crc16) {
+        // Every block matched, so the file changed on the ADCS part way through: start over next time
+        state = ADCS_CRC_ERROR;
+    }
+    // A failed last write also leaves st.offset at the end, but its block is not on disk
+    if (state == ADCS_OK || (state == ADCS_CRC_ERROR && st.offset == file->size)) {
+        red_unlink(spath);
+    }
+    return state;
+}
+
+/**
+ * @brief
+ *      Download a file from the ADCS to path, continuing an earlier interrupted download of it
+ * @details
+ *      A saved state is only used if it describes the same file (type, counter, size, time
+ *      and CRC), otherwise the download starts over. The ADCS only streams the blocks over
+ *      UART, so the active transport must be able to receive a download burst.
+ * @param file
+ *      File list entry of the file, see ADCS_get_file_info
+ * @param path
+ *      Destination on the OBC filesystem, at most ADCS_DOWNLOAD_PATH_MAX characters
+ * @return
+ *      ADCS_OK once the whole file is on disk and matches its CRC. ADCS_CRC_ERROR if a block
+ *      kept failing its CRC, or the finished file does not match and calling again starts
+ *      over. ADCS_INVALID_PARAMETERS, before anything is opened, if the path is too long or
+ *      the active transport cannot receive a burst or adcs_download_init has not run. ADCS_BUSY
+ *      while another download runs. On any other result the progress made is saved and calling
+ *      again resumes.
+ */
+ADCS_returnState adcs_download_file(const adcs_file_info *file, const char *path) {
+    if (download_mutex == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    if (xSemaphoreTake(download_mutex, 0) != pdTRUE) {
+        return ADCS_BUSY;
+    }
+    ADCS_returnState state = download_run(file, path);
+    xSemaphoreGive(download_mutex);
+    return state;
+}
+
+/**
+ * @brief
+ *      How much of a file an interrupted download has already saved
+ * @param received
+ *      Bytes on disk, 0 if there is no saved download of this file
+ */
+ADCS_returnState adcs_download_progress(const adcs_file_info *file, const char *path, uint32_t *received) {
+    char spath[ADCS_DOWNLOAD_PATH_MAX + sizeof(ADCS_DOWNLOAD_STATE_EXT)];
+    download_state st;
+
+    *received = 0;
+    if (!state_path(path, spath)) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    if (state_load(spath, &st) && same_file(&st.file, file)) {
+        uint32_t in_block = hole_map_count(st.hole_map) * ADCS_DL_PACKET_LEN;
+        *received = st.offset + in_block;
+        if (*received > file->size) {
+            *received = file->size;
+        }
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Drop an interrupted download: its state file and the partial file
+ * @return
+ *      ADCS_INVALID_PARAMETERS if the path is too long or adcs_download_init has not run,
+ *      ADCS_BUSY, leaving both files, while a download runs
+ */
+ADCS_returnState adcs_download_discard(const char *path) {
+    char spath[ADCS_DOWNLOAD_PATH_MAX + sizeof(ADCS_DOWNLOAD_STATE_EXT)];
+
+    if (!state_path(path, spath) || download_mutex == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    if (xSemaphoreTake(download_mutex, 0) != pdTRUE) {
+        return ADCS_BUSY;
+    }
+    red_unlink(spath);
+    red_unlink(path);
+    xSemaphoreGive(download_mutex);
+    return ADCS_OK;
+}
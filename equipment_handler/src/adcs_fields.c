@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_fields.c
+ * @brief
+ *      Table-driven frame packing. Each structured TC/TM frame is described by a constant array
+ *      of adcs_field (generated into adcs_frames.c from tools/adcs_frames.json), so one loop does
+ *      the byte assembly, sign extension and scaling in both directions for all of them.
+ */
+
+#include "adcs_fields.h"
+
+#include "adcs_bitset.h"
+
+// Bytes per value on the wire, indexed by adcs_field_type (0 for the bit fields)
+static const uint8_t field_width[] = {1, 2, 2, 4, 4, 4, 8, 1, 2, 2, 4, 0, 0};
+
+// Nearest raw value to value * inv_scale, saturated to [min, max]
+static int32_t to_raw(float value, float inv_scale, int32_t min, int32_t max) {
+    float raw = value * inv_scale;
+    if (raw != raw) { // NaN
+        return 0;
+    }
+    if (raw <= min) {
+        return min;
+    }
+    if (raw >= max) {
+        return max;
+    }
+    return (int32_t)((raw >= 0) ? raw + 0.5f : raw - 0.5f);
+}
+
+static uint32_t field_end(const adcs_field *field) {
+    if (field->type == ADCS_FIELD_BITS || field->type == ADCS_FIELD_FLAGS) {
+        return field->wire + (field->bit + field->count + 7) / 8;
+    }
+    return field->wire + (uint32_t)field_width[field->type] * field->count;
+}
+
+/**
+ * @brief
+ * 		Decodes a telemetry frame into a struct as described by a field table.
+ * @param fields
+ * 		the field table of the frame
+ * @param count
+ * 		number of entries in fields
+ * @param frame
+ * 		the telemetry frame
+ * @param length
+ * 		length of the frame
+ * @param out
+ * 		the struct the field offsets refer to
+ * @return
+ * 		ADCS_INCORRECT_LENGTH if a field runs past the frame, otherwise ADCS_OK
+ */
+ADCS_returnState adcs_fields_decode(const adcs_field *fields, uint32_t count, const uint8_t *frame,
+                                    uint32_t length, void *out) {
+    for (uint32_t i = 0; i < count; i++) {
+        const adcs_field *field = &fields[i];
+        if (field->type > ADCS_FIELD_FLAGS || field_end(field) > length) {
+            return ADCS_INCORRECT_LENGTH;
+        }
+
+        adcs_reader tm = adcs_reader_init(frame, length);
+        uint8_t *dest = (uint8_t *)out + field->dest;
+
+        adcs_get_skip(&tm, field->wire);
+        if (field->type == ADCS_FIELD_BITS || field->type == ADCS_FIELD_FLAGS) {
+            adcs_get_skip_bits(&tm, field->bit);
+            if (field->type == ADCS_FIELD_BITS) {
+                *dest = adcs_get_bits(&tm, field->count);
+            } else {
+                adcs_get_bitset(&tm, (uint32_t *)dest, field->first, field->count);
+            }
+            continue;
+        }
+
+        for (uint8_t k = 0; k < field->count; k++) {
+            switch (field->type) {
+            case ADCS_FIELD_U8:
+                dest[k] = adcs_get_u8(&tm);
+                break;
+            case ADCS_FIELD_U16:
+                ((uint16_t *)dest)[k] = adcs_get_u16(&tm);
+                break;
+            case ADCS_FIELD_I16:
+                ((int16_t *)dest)[k] = adcs_get_i16(&tm);
+                break;
+            case ADCS_FIELD_U32:
+                ((uint32_t *)dest)[k] = adcs_get_u32(&tm);
+                break;
+            case ADCS_FIELD_I32:
+                ((int32_t *)dest)[k] = adcs_get_i32(&tm);
+                break;
+            case ADCS_FIELD_F32:
+                ((float *)dest)[k] = adcs_get_f32(&tm);
+                break;
+            case ADCS_FIELD_F64:
+                ((double *)dest)[k] = adcs_get_f64(&tm);
+                break;
+            case ADCS_FIELD_U8_F:
+                ((float *)dest)[k] = field->scale * adcs_get_u8(&tm);
+                break;
+            case ADCS_FIELD_U16_F:
+                ((float *)dest)[k] = field->scale * adcs_get_u16(&tm);
+                break;
+            case ADCS_FIELD_I16_F:
+                ((float *)dest)[k] = field->scale * adcs_get_i16(&tm);
+                break;
+            case ADCS_FIELD_I32_F:
+                ((float *)dest)[k] = field->scale * adcs_get_i32(&tm);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ * 		Encodes a struct into a telecommand frame as described by a field table.
+ * @attention
+ * 		Bit fields are merged into the bytes they share, so frame must be zeroed
+ * 		beforehand. Scaled values are rounded to the nearest raw value and saturated
+ * 		to the range of the wire type.
+ * @param fields
+ * 		the field table of the frame
+ * @param count
+ * 		number of entries in fields
+ * @param in
+ * 		the struct the field offsets refer to
+ * @param frame
+ * 		the telecommand parameters, without the ID
+ * @param length
+ * 		length of the frame
+ * @return
+ * 		ADCS_INCORRECT_LENGTH if a field runs past the frame, otherwise ADCS_OK
+ */
+ADCS_returnState adcs_fields_encode(const adcs_field *fields, uint32_t count, const void *in, uint8_t *frame,
+                                    uint32_t length) {
+    for (uint32_t i = 0; i < count; i++) {
+        const adcs_field *field = &fields[i];
+        if (field->type > ADCS_FIELD_FLAGS || field_end(field) > length) {
+            return ADCS_INCORRECT_LENGTH;
+        }
+
+        adcs_writer tc = adcs_writer_init(frame, length);
+        const uint8_t *src = (const uint8_t *)in + field->dest;
+
+        adcs_put_skip(&tc, field->wire);
+        if (field->type == ADCS_FIELD_BITS || field->type == ADCS_FIELD_FLAGS) {
+            adcs_put_skip_bits(&tc, field->bit);
+            if (field->type == ADCS_FIELD_BITS) {
+                adcs_put_bits(&tc, *src, field->count);
+            } else {
+                adcs_put_bitset(&tc, (const uint32_t *)src, field->first, field->count);
+            }
+            continue;
+        }
+
+        for (uint8_t k = 0; k < field->count; k++) {
+            switch (field->type) {
+            case ADCS_FIELD_U8:
+                adcs_put_u8(&tc, src[k]);
+                break;
+            case ADCS_FIELD_U16:
+                adcs_put_u16(&tc, ((const uint16_t *)src)[k]);
+                break;
+            case ADCS_FIELD_I16:
+                adcs_put_i16(&tc, ((const int16_t *)src)[k]);
+                break;
+            case ADCS_FIELD_U32:
+                adcs_put_u32(&tc, ((const uint32_t *)src)[k]);
+                break;
+            case ADCS_FIELD_I32:
+                adcs_put_i32(&tc, ((const int32_t *)src)[k]);
+                break;
+            case ADCS_FIELD_F32:
+                adcs_put_f32(&tc, ((const float *)src)[k]);
+                break;
+            case ADCS_FIELD_F64:
+                adcs_put_f64(&tc, ((const double *)src)[k]);
+                break;
+            case ADCS_FIELD_U8_F:
+                adcs_put_u8(&tc, to_raw(((const float *)src)[k], field->inv_scale, 0, UINT8_MAX));
+                break;
+            case ADCS_FIELD_U16_F:
+                adcs_put_u16(&tc, to_raw(((const float *)src)[k], field->inv_scale, 0, UINT16_MAX));
+                break;
+            case ADCS_FIELD_I16_F:
+                adcs_put_i16(&tc, to_raw(((const float *)src)[k], field->inv_scale, INT16_MIN, INT16_MAX));
+                break;
+            case ADCS_FIELD_I32_F:
+                adcs_put_i32(&tc, to_raw(((const float *)src)[k], field->inv_scale, INT32_MIN, INT32_MAX));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return ADCS_OK;
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_file_index.c
+ * @brief
+ *      Copy of the CubeADCS SD card file list in RAM, brought up to date incrementally.
+ *
+ *      The ADCS lists its files newest first, so files it created since the last refresh
+ *      are at the head of the list. A refresh walks the list only until it meets an entry
+ *      it already holds unchanged; the rest of the list is the rest of the index. Files
+ *      that were not met before that entry are gone and dropped.
+ *
+ *      Erasing a file or formatting the card removes the entries here too. Operations that
+ *      add files elsewhere than at the head, like a finished image save, invalidate the
+ *      index and the next refresh walks the whole list.
+ *
+ *      Refreshing walks the ADCS file list read pointer, so only one task should refresh;
+ *      lookups and invalidation are safe from any task.
+ */
+
+#include "adcs_file_index.h"
+#include "adcs_handler.h"
+
+#include "FreeRTOS.h"
+#include "os_task.h"
+#include <string.h>
+
+static adcs_file_info files[ADCS_FILE_INDEX_MAX];
+static uint32_t file_count;
+static bool walk_all = true; // nothing is known until the list has been walked once
+static uint32_t changes;     // bumped by every invalidation or erase, to notice one during a refresh
+
+// Entries read by a refresh ahead of the first known one, kept off the stack
+static adcs_file_info fresh[ADCS_FILE_INDEX_MAX];
+
+static bool same_entry(const adcs_file_info *a, const adcs_file_info *b) {
+    return a->type == b->type && a->counter == b->counter && a->size == b->size && a->time == b->time &&
+           a->crc16 == b->crc16;
+}
+
+/**
+ * @brief
+ *      Position of an unchanged entry in the index, file_count if there is none
+ */
+static uint32_t index_of(const adcs_file_info *file) {
+    uint32_t i = 0;
+    while (i < file_count && !same_entry(&files[i], file)) {
+        i++;
+    }
+    return i;
+}
+
+/**
+ * @brief
+ *      Bring the index up to date with the ADCS file list
+ * @details
+ *      Costs two round trips per new or changed file plus one, or per file if the index
+ *      was invalidated.
+ */
+ADCS_returnState adcs_file_index_refresh(void) {
+    taskENTER_CRITICAL();
+    bool all = walk_all;
+    uint32_t start_changes = changes;
+    taskEXIT_CRITICAL();
+
+    ADCS_returnState state = ADCS_reset_file_list_read_pointer();
+    uint32_t count = 0;
+    bool met_known = false;
+    adcs_file_info known;
+
+    while (state == ADCS_OK && count < ADCS_FILE_INDEX_MAX) {
+        adcs_file_info file;
+        bool updating;
+
+        state = ADCS_get_file_info(&file.type, &updating, &file.counter, &file.size, &file.time, &file.crc16);
+        if (state != ADCS_OK || file.type == 0) {
+            break; // end of the list
+        }
+        // One still being written is not known yet however it compares
+        if (!all && !updating) {
+            taskENTER_CRITICAL();
+            met_known = index_of(&file) < file_count;
+            taskEXIT_CRITICAL();
+            if (met_known) {
+                known = file;
+                break;
+            }
+        }
+        fresh[count++] = file;
+        state = ADCS_advance_file_list_read_pointer();
+    }
+    if (state != ADCS_OK) {
+        return state;
+    }
+
+    taskENTER_CRITICAL();
+    uint32_t kept = 0;
+    if (met_known) {
+        // The entry could have been forgotten meanwhile, then there is nothing to keep
+        uint32_t from = index_of(&known);
+        kept = file_count - from;
+        if (kept > ADCS_FILE_INDEX_MAX - count) {
+            kept = ADCS_FILE_INDEX_MAX - count;
+        }
+        memmove(&files[count], &files[from], kept * sizeof(files[0]));
+    }
+    memcpy(files, fresh, count * sizeof(files[0]));
+    file_count = count + kept;
+    walk_all = (changes != start_changes); // what was read may predate an erase, check it all next time
+    taskEXIT_CRITICAL();
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Copy out the indexed files, newest first
+ * @return
+ *      Number of entries copied, at most max
+ */
+uint32_t adcs_file_index_list(adcs_file_info *out, uint32_t max) {
+    taskENTER_CRITICAL();
+    uint32_t count = (file_count < max) ? file_count : max;
+    memcpy(out, files, count * sizeof(files[0]));
+    taskEXIT_CRITICAL();
+    return count;
+}
+
+/**
+ * @brief
+ *      Look up a file by type and counter
+ * @return
+ *      false if it is not in the index
+ */
+bool adcs_file_index_find(uint8_t type, uint8_t counter, adcs_file_info *file) {
+    bool found = false;
+
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0; i < file_count && !found; i++) {
+        if (files[i].type == type && files[i].counter == counter) {
+            *file = files[i];
+            found = true;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return found;
+}
+
+/**
+ * @brief
+ *      Have the next refresh walk the whole ADCS file list
+ */
+void adcs_file_index_invalidate(void) {
+    taskENTER_CRITICAL();
+    walk_all = true;
+    changes++;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief
+ *      Drop files the ADCS has erased, with the arguments of ADCS_erase_file
+ * @param all
+ *      Drop every file, as after erase all or a format
+ */
+void adcs_file_index_forget(uint8_t type, uint8_t counter, bool all) {
+    taskENTER_CRITICAL();
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < file_count; i++) {
+        if (!all && (files[i].type != type || files[i].counter != counter)) {
+            files[kept++] = files[i];
+        }
+    }
+    file_count = kept;
+    changes++;
+    taskEXIT_CRITICAL();
+}
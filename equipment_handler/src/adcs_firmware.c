@@ -0,0 +1,392 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_firmware.c
+ * @brief
+ *      Journaled firmware update of the ADCS, from upload to running the new program.
+ *
+ *      The program file is uploaded to an EEPROM or external flash slot, checked there by
+ *      the bootloader, copied into internal flash, checked again and booted. A journal next
+ *      to the file holds the step to do next and how far the upload got; it is saved after
+ *      every upload block and every step, so after a reset of the OBC a later call carries
+ *      on from there. A reset of the ADCS is noticed by the step that needs the bootloader,
+ *      which resets into it again, or by the upload when the ADCS no longer takes its blocks.
+ *
+ *      Program indexes are as in Table 66 (0 bootloader, 1 internal flash, 2 EEPROM, 3-9
+ *      external flash 1-7), which for the slots used here is also their upload destination.
+ */
+
+#include "adcs_firmware.h"
+#include "adcs_crc16.h"
+#include "adcs_handler.h"
+#include "adcs_upload.h"
+
+#include "FreeRTOS.h"
+#include "os_task.h"
+#include "redposix.h"
+#include <string.h>
+
+#define FIRMWARE_MAGIC 0x41465731 // "AFW1"
+#define BOOTLOADER_PROGRAM 0
+#define INTERNAL_FLASH_PROGRAM 1
+#define FIRST_SLOT 2 // EEPROM
+#define LAST_SLOT 9  // external flash program 7
+
+// Written in one Reliance Edge transaction like the download state, see adcs_download.c
+typedef struct {
+    uint32_t magic;
+    uint8_t program;   // slot the file goes to
+    uint8_t step;      // adcs_firmware_step to do next
+    uint16_t crc16;    // of the file, with size to tell it apart from another
+    uint32_t size;
+    uint32_t uploaded; // upload offset, every block before it is written on the ADCS
+} firmware_journal;
+
+typedef struct {
+    const char *jpath;
+    firmware_journal *journal;
+} upload_context;
+
+static const uint16_t firmware_backoff_ms[] = ADCS_FIRMWARE_POLL_BACKOFF_MS;
+
+static bool journal_path(const char *path, char *jpath) {
+    size_t len = strlen(path);
+    if (len > ADCS_FIRMWARE_PATH_MAX) {
+        return false;
+    }
+    memcpy(jpath, path, len);
+    memcpy(jpath + len, ADCS_FIRMWARE_JOURNAL_EXT, sizeof(ADCS_FIRMWARE_JOURNAL_EXT));
+    return true;
+}
+
+static bool journal_load(const char *jpath, firmware_journal *jn) {
+    int32_t fd = red_open(jpath, RED_O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = (red_read(fd, jn, sizeof(*jn)) == sizeof(*jn)) && jn->magic == FIRMWARE_MAGIC;
+    red_close(fd);
+    return ok;
+}
+
+static ADCS_returnState journal_save(const char *jpath, const firmware_journal *jn) {
+    int32_t fd = red_open(jpath, RED_O_WRONLY | RED_O_CREAT | RED_O_TRUNC);
+    if (fd < 0) {
+        return ADCS_FS_FAILED;
+    }
+    bool ok = (red_write(fd, jn, sizeof(*jn)) == sizeof(*jn)) && red_fsync(fd) == 0;
+    red_close(fd);
+    return ok ? ADCS_OK : ADCS_FS_FAILED;
+}
+
+static ADCS_returnState upload_checkpoint(void *context, uint32_t offset) {
+    upload_context *ctx = context;
+    ctx->journal->uploaded = offset;
+    return journal_save(ctx->jpath, ctx->journal);
+}
+
+/**
+ * @brief
+ *      Size and CRC of the program file, as the bootloader reports them for a slot
+ */
+static ADCS_returnState file_identify(const char *path, uint32_t *size, uint16_t *crc16) {
+    int32_t fd = red_open(path, RED_O_RDONLY);
+    if (fd < 0) {
+        return ADCS_FS_FAILED;
+    }
+    uint8_t *buffer = (uint8_t *)pvPortMalloc(ADCS_DL_BLOCK_LEN);
+    if (buffer == NULL) {
+        red_close(fd);
+        return ADCS_MALLOC_FAILED;
+    }
+
+    int32_t n;
+    *size = 0;
+    *crc16 = ADCS_CRC16_INIT;
+    while ((n = red_read(fd, buffer, ADCS_DL_BLOCK_LEN)) > 0) {
+        *crc16 = adcs_crc16_update(*crc16, buffer, n);
+        *size += n;
+    }
+
+    vPortFree(buffer);
+    red_close(fd);
+    return (n == 0) ? ADCS_OK : ADCS_FS_FAILED;
+}
+
+/**
+ * @brief
+ *      Sleep until the next status poll, backing off the longer an operation takes
+ * @return
+ *      false once timeout_ms has been waited and there should be no further poll
+ */
+static bool backoff(uint32_t *waited, uint32_t *step, uint32_t timeout_ms) {
+    if (*waited >= timeout_ms) {
+        return false;
+    }
+    vTaskDelay(pdMS_TO_TICKS(firmware_backoff_ms[*step]));
+    *waited += firmware_backoff_ms[*step];
+    if (*step + 1 < sizeof(firmware_backoff_ms) / sizeof(firmware_backoff_ms[0])) {
+        (*step)++;
+    }
+    return true;
+}
+
+/**
+ * @brief
+ *      Wait for the ADCS to be running program, after a reset or a program switch
+ * @details
+ *      Polls that go unanswered while the ADCS boots are part of the wait.
+ */
+static ADCS_returnState boot_wait(uint8_t program) {
+    uint32_t waited = 0;
+    uint32_t step = 0;
+
+    do {
+        uint8_t running, boot_stat;
+        if (ADCS_get_boot_index(&running, &boot_stat) == ADCS_OK && running == program) {
+            return ADCS_OK;
+        }
+    } while (backoff(&waited, &step, ADCS_FIRMWARE_BOOT_TIMEOUT_MS));
+    return ADCS_UART_FAILED;
+}
+
+/**
+ * @brief
+ *      Have the ADCS run the bootloader, resetting it unless it already does
+ */
+static ADCS_returnState bootloader_enter(void) {
+    uint8_t running, boot_stat;
+    if (ADCS_get_boot_index(&running, &boot_stat) == ADCS_OK && running == BOOTLOADER_PROGRAM) {
+        return ADCS_OK;
+    }
+
+    // The acknowledge may be cut off by the reset itself, boot_wait tells whether it happened
+    ADCS_returnState state = ADCS_reset();
+    if (state != ADCS_OK && state != ADCS_UART_FAILED) {
+        return state;
+    }
+    return boot_wait(BOOTLOADER_PROGRAM);
+}
+
+/**
+ * @brief
+ *      Have the bootloader read a program and check it against the file
+ * @return
+ *      ADCS_CRC_ERROR if its size or CRC differ
+ */
+static ADCS_returnState program_check(uint8_t program, const firmware_journal *jn) {
+    ADCS_returnState state = ADCS_read_program_info(program);
+    uint32_t waited = 0;
+    uint32_t step = 0;
+
+    while (state == ADCS_OK) {
+        uint8_t index;
+        bool busy;
+        uint32_t size;
+        uint16_t crc16;
+
+        state = ADCS_get_program_info(&index, &busy, &size, &crc16);
+        if (state == ADCS_OK && !busy && index == program) {
+            return (size == jn->size && crc16 == jn->crc16) ? ADCS_OK : ADCS_CRC_ERROR;
+        }
+        if (state == ADCS_OK && !backoff(&waited, &step, ADCS_FIRMWARE_INFO_TIMEOUT_MS)) {
+            state = ADCS_UART_FAILED;
+        }
+    }
+    return state;
+}
+
+static ADCS_returnState firmware_upload(const char *path, const char *jpath, firmware_journal *jn) {
+    upload_context ctx = {.jpath = jpath, .journal = jn};
+    ADCS_returnState state = adcs_upload_file_from(path, jn->program, jn->uploaded, upload_checkpoint, &ctx);
+
+    if (state == ADCS_INVALID_PARAMETERS && jn->uploaded != 0) {
+        // The ADCS has been reset since and dropped the upload, start it over
+        jn->uploaded = 0;
+        state = journal_save(jpath, jn);
+        if (state == ADCS_OK) {
+            state = adcs_upload_file_from(path, jn->program, 0, upload_checkpoint, &ctx);
+        }
+    }
+    return state;
+}
+
+static ADCS_returnState firmware_verify(firmware_journal *jn) {
+    ADCS_returnState state = bootloader_enter();
+    if (state == ADCS_OK) {
+        state = program_check(jn->program, jn);
+    }
+    if (state == ADCS_CRC_ERROR) {
+        // Every block matched its CRC on the way, so the slot changed since: upload again next time
+        jn->step = ADCS_FIRMWARE_UPLOAD;
+        jn->uploaded = 0;
+    }
+    return state;
+}
+
+static ADCS_returnState firmware_copy(firmware_journal *jn) {
+    ADCS_returnState state = bootloader_enter();
+    if (state == ADCS_OK) {
+        state = ADCS_copy_program_internal_flash(jn->program, 0); // boot segment left alone
+    }
+
+    uint32_t waited = 0;
+    uint32_t step = 0;
+    while (state == ADCS_OK) {
+        bool busy, err;
+        state = ADCS_copy_internal_flash_progress(&busy, &err);
+        if (state == ADCS_OK && !busy) {
+            if (err) {
+                return ADCS_INVALID_PARAMETERS;
+            }
+            break;
+        }
+        if (state == ADCS_OK && !backoff(&waited, &step, ADCS_FIRMWARE_COPY_TIMEOUT_MS)) {
+            state = ADCS_UART_FAILED;
+        }
+    }
+
+    // Also catches a copy cut short by a reset, after which the progress reads idle without error
+    if (state == ADCS_OK) {
+        state = program_check(INTERNAL_FLASH_PROGRAM, jn);
+    }
+    return state;
+}
+
+static ADCS_returnState firmware_boot(void) {
+    uint8_t running, boot_stat;
+    if (ADCS_get_boot_index(&running, &boot_stat) == ADCS_OK && running == INTERNAL_FLASH_PROGRAM) {
+        return ADCS_OK; // booted before the journal caught up, internal flash already holds the update
+    }
+
+    ADCS_returnState state = ADCS_set_boot_index(INTERNAL_FLASH_PROGRAM);
+    if (state == ADCS_OK) {
+        state = ADCS_run_selected_program();
+    }
+    if (state == ADCS_OK || state == ADCS_UART_FAILED) {
+        state = boot_wait(INTERNAL_FLASH_PROGRAM);
+    }
+    return state;
+}
+
+static ADCS_returnState firmware_step(const char *path, const char *jpath, firmware_journal *jn) {
+    switch (jn->step) {
+    case ADCS_FIRMWARE_UPLOAD:
+        return firmware_upload(path, jpath, jn);
+    case ADCS_FIRMWARE_BOOTLOADER:
+        return bootloader_enter();
+    case ADCS_FIRMWARE_VERIFY:
+        return firmware_verify(jn);
+    case ADCS_FIRMWARE_COPY:
+        return firmware_copy(jn);
+    case ADCS_FIRMWARE_BOOT:
+        return firmware_boot();
+    default:
+        return ADCS_OK;
+    }
+}
+
+/**
+ * @brief
+ *      Update the program the ADCS boots, continuing an earlier interrupted update of the same file
+ * @details
+ *      The journal is only used if it is for the same slot and a file of the same size and
+ *      CRC, otherwise the update starts over. Each call runs until the ADCS is running the
+ *      new program or a step fails; calling again retries that step.
+ * @param path
+ *      Program file on the OBC filesystem, at most ADCS_FIRMWARE_PATH_MAX characters
+ * @param program
+ *      Slot to upload to and copy from: 2 EEPROM, 3-9 external flash program 1-7
+ * @return
+ *      ADCS_OK once the ADCS runs the new program from internal flash. ADCS_CRC_ERROR if a
+ *      slot did not match the file; ADCS_INVALID_PARAMETERS if the ADCS rejected a step.
+ */
+ADCS_returnState adcs_firmware_update(const char *path, uint8_t program) {
+    char jpath[ADCS_FIRMWARE_PATH_MAX + sizeof(ADCS_FIRMWARE_JOURNAL_EXT)];
+    firmware_journal jn;
+    uint32_t size;
+    uint16_t crc16;
+
+    if (program < FIRST_SLOT || program > LAST_SLOT || !journal_path(path, jpath)) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    ADCS_returnState state = file_identify(path, &size, &crc16);
+    if (state != ADCS_OK) {
+        return state;
+    }
+    if (!journal_load(jpath, &jn) || jn.program != program || jn.size != size || jn.crc16 != crc16) {
+        memset(&jn, 0, sizeof(jn));
+        jn.magic = FIRMWARE_MAGIC;
+        jn.program = program;
+        jn.step = ADCS_FIRMWARE_UPLOAD;
+        jn.crc16 = crc16;
+        jn.size = size;
+        state = journal_save(jpath, &jn);
+    }
+
+    while (state == ADCS_OK && jn.step < ADCS_FIRMWARE_DONE) {
+        uint8_t step = jn.step;
+        state = firmware_step(path, jpath, &jn);
+        if (state == ADCS_OK) {
+            jn.step++;
+        }
+        if (jn.step != step) {
+            ADCS_returnState saved = journal_save(jpath, &jn);
+            state = (state == ADCS_OK) ? saved : state;
+        }
+    }
+
+    if (state == ADCS_OK) {
+        red_unlink(jpath);
+    }
+    return state;
+}
+
+/**
+ * @brief
+ *      Where an interrupted firmware update stands
+ * @param step
+ *      Step to do next, ADCS_FIRMWARE_UPLOAD if there is no update in progress
+ * @param uploaded
+ *      Bytes of the file written on the ADCS so far
+ */
+ADCS_returnState adcs_firmware_progress(const char *path, adcs_firmware_step *step, uint32_t *uploaded) {
+    char jpath[ADCS_FIRMWARE_PATH_MAX + sizeof(ADCS_FIRMWARE_JOURNAL_EXT)];
+    firmware_journal jn;
+
+    *step = ADCS_FIRMWARE_UPLOAD;
+    *uploaded = 0;
+    if (!journal_path(path, jpath)) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    if (journal_load(jpath, &jn)) {
+        *step = (adcs_firmware_step)jn.step;
+        *uploaded = (jn.step == ADCS_FIRMWARE_UPLOAD) ? jn.uploaded : jn.size;
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Forget an interrupted firmware update, the next one starts from the upload
+ */
+ADCS_returnState adcs_firmware_discard(const char *path) {
+    char jpath[ADCS_FIRMWARE_PATH_MAX + sizeof(ADCS_FIRMWARE_JOURNAL_EXT)];
+
+    if (!journal_path(path, jpath)) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    red_unlink(jpath);
+    return ADCS_OK;
+}
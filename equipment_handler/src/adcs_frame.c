@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_frame.c
+ */
+
+#include "adcs_frame.h"
+#include "adcs_types.h"
+
+#include <stddef.h>
+
+enum {
+    WAIT_ESC,  // hunting for the ESC of ESC SOM
+    WAIT_SOM,  // ESC seen outside a frame
+    WAIT_ID,   // inside a frame, nothing received yet
+    BODY,      // inside a frame, collecting payload
+    BODY_ESC,  // ESC seen inside a frame
+    DONE
+};
+
+/**
+ * @brief
+ *      Prepare a parser to receive one frame
+ * @param payload
+ *      Where the de-stuffed payload (everything after the ID byte) is written
+ * @param capacity
+ *      Size of payload in bytes
+ */
+void adcs_frame_parser_init(adcs_frame_parser *parser, uint8_t *payload, uint32_t capacity) {
+    parser->state = WAIT_ESC;
+    parser->have_id = false;
+    parser->id = 0;
+    parser->payload = payload;
+    parser->capacity = capacity;
+    parser->length = 0;
+    parser->split = false;
+    parser->split_pending = false;
+    parser->tail = NULL;
+    parser->tail_capacity = 0;
+    parser->skip = false;
+}
+
+/**
+ * @brief
+ *      Turn a freshly initialised parser into a split parser
+ * @details
+ *      Once the payload buffer holds capacity bytes, adcs_frame_parse returns ADCS_FRAME_SPLIT
+ *      so the caller can look at that header and choose where the remaining payload goes,
+ *      e.g. straight into place in a larger buffer. Without a tail the rest is dropped.
+ */
+void adcs_frame_parser_split(adcs_frame_parser *parser) {
+    parser->split = true;
+    parser->split_pending = true;
+}
+
+/**
+ * @brief
+ *      Direct the rest of the current frame's payload to tail, after ADCS_FRAME_SPLIT
+ * @param capacity
+ *      Size of tail, further bytes are counted in length but not stored
+ */
+void adcs_frame_parser_set_tail(adcs_frame_parser *parser, uint8_t *tail, uint32_t capacity) {
+    parser->tail = tail;
+    parser->tail_capacity = capacity;
+}
+
+/**
+ * @brief
+ *      Drop the rest of the current frame, e.g. after ADCS_FRAME_OVERFLOW on a frame that
+ *      is not the one awaited
+ * @details
+ *      The parser keeps its place in the frame, so a stuffed ESC ESC followed by SOM in the
+ *      dropped payload is not taken for the start of a new frame. Parsing then returns
+ *      ADCS_FRAME_COMPLETE at the frame's ESC EOM, with the same ID, and the parser needs
+ *      re-initialising. A new ESC SOM before that still starts a new frame as usual.
+ */
+void adcs_frame_parser_skip(adcs_frame_parser *parser) { parser->skip = true; }
+
+static void frame_restart(adcs_frame_parser *parser) {
+    parser->state = WAIT_ID;
+    parser->have_id = false;
+    parser->length = 0;
+    parser->split_pending = parser->split;
+    parser->tail = NULL;
+    parser->tail_capacity = 0;
+    parser->skip = false;
+}
+
+static ADCS_frameState frame_store(adcs_frame_parser *parser, uint8_t byte) {
+    parser->state = BODY;
+    if (!parser->have_id) {
+        parser->id = byte;
+        parser->have_id = true;
+        return ADCS_FRAME_INCOMPLETE;
+    }
+    if (parser->skip) {
+        parser->length++;
+        return ADCS_FRAME_INCOMPLETE;
+    }
+    if (parser->length < parser->capacity) {
+        parser->payload[parser->length++] = byte;
+        if (parser->split_pending && parser->length == parser->capacity) {
+            parser->split_pending = false;
+            return ADCS_FRAME_SPLIT;
+        }
+        return ADCS_FRAME_INCOMPLETE;
+    }
+    if (!parser->split) {
+        return ADCS_FRAME_OVERFLOW;
+    }
+    uint32_t pos = parser->length++ - parser->capacity;
+    if (pos < parser->tail_capacity) {
+        parser->tail[pos] = byte;
+    }
+    return ADCS_FRAME_INCOMPLETE;
+}
+
+/**
+ * @brief
+ *      Feed received bytes to the parser
+ * @param data
+ *      Received bytes
+ * @param len
+ *      Number of bytes in data
+ * @param consumed
+ *      Set to the number of bytes used. Parsing stops right after ESC EOM so the rest of
+ *      data can be handed to the next frame.
+ * @return
+ *      ADCS_FRAME_COMPLETE as soon as ESC EOM is seen, ADCS_FRAME_SPLIT right after the byte
+ *      that fills a split parser's payload buffer
+ */
+ADCS_frameState adcs_frame_parse(adcs_frame_parser *parser, const uint8_t *data, uint32_t len,
+                                 uint32_t *consumed) {
+    uint32_t i = 0;
+    ADCS_frameState result = ADCS_FRAME_INCOMPLETE;
+
+    if (parser->state == DONE) {
+        result = ADCS_FRAME_COMPLETE;
+    }
+
+    while (i < len && result == ADCS_FRAME_INCOMPLETE) {
+        uint8_t byte = data[i++];
+        switch (parser->state) {
+        case WAIT_ESC:
+            if (byte == ADCS_ESC_CHAR) {
+                parser->state = WAIT_SOM;
+            }
+            break;
+        case WAIT_SOM:
+            if (byte == ADCS_SOM) {
+                frame_restart(parser);
+            } else if (byte != ADCS_ESC_CHAR) {
+                parser->state = WAIT_ESC;
+            }
+            break;
+        case WAIT_ID:
+        case BODY:
+            if (byte == ADCS_ESC_CHAR) {
+                parser->state = BODY_ESC;
+            } else {
+                result = frame_store(parser, byte);
+            }
+            break;
+        case BODY_ESC:
+            if (byte == ADCS_ESC_CHAR) {
+                result = frame_store(parser, byte); // stuffed 0x1F
+            } else if (byte == ADCS_EOM) {
+                parser->state = DONE;
+                result = ADCS_FRAME_COMPLETE;
+            } else if (byte == ADCS_SOM) {
+                frame_restart(parser); // a new frame started before this one ended
+            } else {
+                parser->state = WAIT_ESC; // not a valid escape, drop the frame
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (consumed != NULL) {
+        *consumed = i;
+    }
+    return result;
+}
+
+/**
+ * @brief
+ *      Wrap a message in ESC SOM / ESC EOM, doubling any ESC inside it
+ * @param frame
+ *      Destination, at least ADCS_FRAME_ENCODED_MAX(length) bytes
+ * @param body
+ *      TC/TM ID followed by any parameters
+ * @param length
+ *      Length of body in bytes
+ * @return
+ *      Number of bytes written to frame
+ */
+uint32_t adcs_frame_encode(uint8_t *frame, const uint8_t *body, uint32_t length) {
+    uint32_t pos = 0;
+
+    frame[pos++] = ADCS_ESC_CHAR;
+    frame[pos++] = ADCS_SOM;
+    for (uint32_t i = 0; i < length; i++) {
+        if (body[i] == ADCS_ESC_CHAR) {
+            frame[pos++] = ADCS_ESC_CHAR;
+        }
+        frame[pos++] = body[i];
+    }
+    frame[pos++] = ADCS_ESC_CHAR;
+    frame[pos++] = ADCS_EOM;
+    return pos;
+}
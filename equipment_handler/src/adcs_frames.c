@@ -0,0 +1,1142 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_frames.c
+ * @brief
+ *      Generated by tools/adcs_gen.py from tools/adcs_frames.json, do not edit.
+ */
+
+#include "adcs_frames.h"
+#include "adcs_handler.h"
+#include "adcs_io.h"
+
+// Laid out by the generator, keep the pre-commit formatting off it
+// clang-format off
+
+// The I/O buffers hold the largest frames
+ADCS_STATIC_ASSERT(1 + SET_SYSTEM_CONFIG_LEN <= ADCS_MAX_TC_LEN, largest_tc);
+ADCS_STATIC_ASSERT(GET_FULL_CONFIG_LEN <= ADCS_MAX_TM_LEN, largest_tm);
+
+// Table 149. flags holds bits 12-47, 48-51 and 54-65 in frame order, named by adcs_state_flag
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->att_estimate_mode) == 1, state_att_estimate_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->att_ctrl_mode) == 1, state_att_ctrl_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->run_mode) == 1, state_run_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->ASGP4_mode) == 1, state_ASGP4_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->flags.word[0]) == 4, state_flags_0);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->flags) * 8 >= 36, state_flags_0_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->flags.word[0]) == 4, state_flags_36);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->flags) * 8 >= 40, state_flags_36_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->MTM_sample_mode) == 1, state_MTM_sample_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->flags.word[0]) == 4, state_flags_40);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->flags) * 8 >= 52, state_flags_40_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->est_angle) == 12, state_est_angle);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->est_quaternion) == 6, state_est_quaternion);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->est_angular_rate) == 12, state_est_angular_rate);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->ECI_pos) == 12, state_ECI_pos);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->ECI_vel) == 12, state_ECI_vel);
+ADCS_STATIC_ASSERT(offsetof(adcs_state, ECI_vel) == offsetof(adcs_state, ECI_pos) + 12, state_ECI_vel_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->longlatalt.x) == 4, state_longlatalt_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->longlatalt.y) == 4, state_longlatalt_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_state, longlatalt.y) == offsetof(adcs_state, longlatalt.x) + 4,
+                   state_longlatalt_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->longlatalt.z) == 4, state_longlatalt_z);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state *)0)->ecef_pos) == 6, state_ecef_pos);
+const adcs_field adcs_state_fields[] = {
+    ADCS_BITS(0, 0, 4, adcs_state, att_estimate_mode), // table 80
+    ADCS_BITS(0, 4, 4, adcs_state, att_ctrl_mode),     // table 78
+    ADCS_BITS(1, 0, 2, adcs_state, run_mode),          // table 75
+    ADCS_BITS(1, 2, 2, adcs_state, ASGP4_mode),        // table 87
+    ADCS_FLAGS(1, 4, 36, adcs_state, flags, 0),
+    ADCS_FLAGS(6, 0, 4, adcs_state, flags, 36),
+    ADCS_BITS(6, 4, 2, adcs_state, MTM_sample_mode), // table 90
+    ADCS_FLAGS(6, 6, 12, adcs_state, flags, 40),
+    ADCS_FIELD(12, ADCS_FIELD_I16_F, 3, 0.01f, adcs_state, est_angle), // [deg]
+    ADCS_FIELD(18, ADCS_FIELD_I16, 3, 0, adcs_state, est_quaternion),
+    ADCS_FIELD(24, ADCS_FIELD_I16_F, 3, 0.01f, adcs_state, est_angular_rate), // [deg/s]
+    ADCS_FIELD(30, ADCS_FIELD_I16_F, 6, 0.25f, adcs_state, ECI_pos),          // [km, m/s], up to ECI_vel
+    ADCS_FIELD(42, ADCS_FIELD_I16_F, 2, 0.01f, adcs_state, longlatalt.x),     // [deg], up to longlatalt.y
+    ADCS_FIELD(46, ADCS_FIELD_U16_F, 1, 0.01f, adcs_state, longlatalt.z),     // [km]
+    ADCS_FIELD(48, ADCS_FIELD_I16, 3, 0, adcs_state, ecef_pos),               // [m]
+};
+
+// Table 149. flags holds bits 12-47, 48-51 and 54-65 in frame order, named by adcs_state_flag, unscaled
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->att_estimate_mode) == 1, state_raw_att_estimate_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->att_ctrl_mode) == 1, state_raw_att_ctrl_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->run_mode) == 1, state_raw_run_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->ASGP4_mode) == 1, state_raw_ASGP4_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->flags.word[0]) == 4, state_raw_flags_0);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->flags) * 8 >= 36, state_raw_flags_0_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->flags.word[0]) == 4, state_raw_flags_36);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->flags) * 8 >= 40, state_raw_flags_36_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->MTM_sample_mode) == 1, state_raw_MTM_sample_mode);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->flags.word[0]) == 4, state_raw_flags_40);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->flags) * 8 >= 52, state_raw_flags_40_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->est_angle) == 6, state_raw_est_angle);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->est_quaternion) == 6, state_raw_est_quaternion);
+ADCS_STATIC_ASSERT(offsetof(adcs_state_raw, est_quaternion) == offsetof(adcs_state_raw, est_angle) + 6,
+                   state_raw_est_quaternion_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->est_angular_rate) == 6, state_raw_est_angular_rate);
+ADCS_STATIC_ASSERT(offsetof(adcs_state_raw, est_angular_rate) == offsetof(adcs_state_raw, est_quaternion) + 6,
+                   state_raw_est_angular_rate_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->ECI_pos) == 6, state_raw_ECI_pos);
+ADCS_STATIC_ASSERT(offsetof(adcs_state_raw, ECI_pos) == offsetof(adcs_state_raw, est_angular_rate) + 6,
+                   state_raw_ECI_pos_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->ECI_vel) == 6, state_raw_ECI_vel);
+ADCS_STATIC_ASSERT(offsetof(adcs_state_raw, ECI_vel) == offsetof(adcs_state_raw, ECI_pos) + 6,
+                   state_raw_ECI_vel_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->longlatalt.x) == 2, state_raw_longlatalt_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->longlatalt.y) == 2, state_raw_longlatalt_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_state_raw, longlatalt.y) == offsetof(adcs_state_raw, longlatalt.x) + 2,
+                   state_raw_longlatalt_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->longlatalt.z) == 2, state_raw_longlatalt_z);
+ADCS_STATIC_ASSERT(sizeof(((adcs_state_raw *)0)->ecef_pos) == 6, state_raw_ecef_pos);
+const adcs_field adcs_state_raw_fields[] = {
+    ADCS_BITS(0, 0, 4, adcs_state_raw, att_estimate_mode), // table 80
+    ADCS_BITS(0, 4, 4, adcs_state_raw, att_ctrl_mode),     // table 78
+    ADCS_BITS(1, 0, 2, adcs_state_raw, run_mode),          // table 75
+    ADCS_BITS(1, 2, 2, adcs_state_raw, ASGP4_mode),        // table 87
+    ADCS_FLAGS(1, 4, 36, adcs_state_raw, flags, 0),
+    ADCS_FLAGS(6, 0, 4, adcs_state_raw, flags, 36),
+    ADCS_BITS(6, 4, 2, adcs_state_raw, MTM_sample_mode), // table 90
+    ADCS_FLAGS(6, 6, 12, adcs_state_raw, flags, 40),
+    // [0.01 deg, 0.01 deg/s, 0.25 km, 0.25 m/s], up to ECI_vel
+    ADCS_FIELD(12, ADCS_FIELD_I16, 15, 0, adcs_state_raw, est_angle),
+    ADCS_FIELD(42, ADCS_FIELD_I16, 2, 0, adcs_state_raw, longlatalt.x), // [0.01 deg], up to longlatalt.y
+    ADCS_FIELD(46, ADCS_FIELD_U16, 1, 0, adcs_state_raw, longlatalt.z), // [0.01 km]
+    ADCS_FIELD(48, ADCS_FIELD_I16, 3, 0, adcs_state_raw, ecef_pos),
+};
+
+// Table 106, longitude, latitude, altitude
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->x) == 4, llh_x);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->y) == 4, llh_y);
+ADCS_STATIC_ASSERT(offsetof(xyz, y) == offsetof(xyz, x) + 4, llh_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->z) == 4, llh_z);
+const adcs_field adcs_llh_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 2, 0.01f, xyz, x), // [deg], up to y
+    ADCS_FIELD(4, ADCS_FIELD_U16_F, 1, 0.01f, xyz, z), // [km]
+};
+
+// Table 150
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->magnetic_field) == 12, measures_magnetic_field);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->coarse_sun) == 12, measures_coarse_sun);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->sun) == 12, measures_sun);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, sun) == offsetof(adcs_measures, coarse_sun) + 12, measures_sun_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->nadir) == 12, measures_nadir);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, nadir) == offsetof(adcs_measures, sun) + 12, measures_nadir_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->angular_rate) == 12, measures_angular_rate);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->wheel_speed) == 12, measures_wheel_speed);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->star1b) == 12, measures_star1b);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->star1o) == 12, measures_star1o);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, star1o) == offsetof(adcs_measures, star1b) + 12,
+                   measures_star1o_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->star2b) == 12, measures_star2b);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, star2b) == offsetof(adcs_measures, star1o) + 12,
+                   measures_star2b_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->star2o) == 12, measures_star2o);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, star2o) == offsetof(adcs_measures, star2b) + 12,
+                   measures_star2o_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->star3b) == 12, measures_star3b);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, star3b) == offsetof(adcs_measures, star2o) + 12,
+                   measures_star3b_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures *)0)->star3o) == 12, measures_star3o);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures, star3o) == offsetof(adcs_measures, star3b) + 12,
+                   measures_star3o_follows);
+const adcs_field adcs_measures_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.01f, adcs_measures, magnetic_field), // [uT]
+    ADCS_FIELD(6, ADCS_FIELD_I16_F, 9, 0.0001f, adcs_measures, coarse_sun),   // up to nadir
+    ADCS_FIELD(24, ADCS_FIELD_I16_F, 3, 0.01f, adcs_measures, angular_rate),  // [deg/s]
+    ADCS_FIELD(30, ADCS_FIELD_I16_F, 3, 1.0f, adcs_measures, wheel_speed),    // [rpm]
+    ADCS_FIELD(36, ADCS_FIELD_I16_F, 18, 0.0001f, adcs_measures, star1b),     // up to star3o
+};
+
+// Table 150, unscaled
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->magnetic_field) == 6, measures_raw_magnetic_field);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->coarse_sun) == 6, measures_raw_coarse_sun);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, coarse_sun) == offsetof(adcs_measures_raw, magnetic_field) + 6,
+                   measures_raw_coarse_sun_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->sun) == 6, measures_raw_sun);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, sun) == offsetof(adcs_measures_raw, coarse_sun) + 6,
+                   measures_raw_sun_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->nadir) == 6, measures_raw_nadir);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, nadir) == offsetof(adcs_measures_raw, sun) + 6,
+                   measures_raw_nadir_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->angular_rate) == 6, measures_raw_angular_rate);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, angular_rate) == offsetof(adcs_measures_raw, nadir) + 6,
+                   measures_raw_angular_rate_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->wheel_speed) == 6, measures_raw_wheel_speed);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, wheel_speed) == offsetof(adcs_measures_raw, angular_rate) + 6,
+                   measures_raw_wheel_speed_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->star1b) == 6, measures_raw_star1b);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, star1b) == offsetof(adcs_measures_raw, wheel_speed) + 6,
+                   measures_raw_star1b_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->star1o) == 6, measures_raw_star1o);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, star1o) == offsetof(adcs_measures_raw, star1b) + 6,
+                   measures_raw_star1o_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->star2b) == 6, measures_raw_star2b);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, star2b) == offsetof(adcs_measures_raw, star1o) + 6,
+                   measures_raw_star2b_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->star2o) == 6, measures_raw_star2o);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, star2o) == offsetof(adcs_measures_raw, star2b) + 6,
+                   measures_raw_star2o_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->star3b) == 6, measures_raw_star3b);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, star3b) == offsetof(adcs_measures_raw, star2o) + 6,
+                   measures_raw_star3b_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_measures_raw *)0)->star3o) == 6, measures_raw_star3o);
+ADCS_STATIC_ASSERT(offsetof(adcs_measures_raw, star3o) == offsetof(adcs_measures_raw, star3b) + 6,
+                   measures_raw_star3o_follows);
+const adcs_field adcs_measures_raw_fields[] = {
+    // [0.01 uT, 0.0001, 0.01 deg/s, 1 rpm], up to star3o
+    ADCS_FIELD(0, ADCS_FIELD_I16, 36, 0, adcs_measures_raw, magnetic_field),
+};
+
+// Table 151
+ADCS_STATIC_ASSERT(sizeof(((adcs_actuator *)0)->magnetorquer) == 12, actuator_magnetorquer);
+ADCS_STATIC_ASSERT(sizeof(((adcs_actuator *)0)->wheel_speed) == 12, actuator_wheel_speed);
+const adcs_field adcs_actuator_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 100.0f, adcs_actuator, magnetorquer), // [s]
+    ADCS_FIELD(6, ADCS_FIELD_I16_F, 3, 1.0f, adcs_actuator, wheel_speed),    // [rpm]
+};
+
+// Table 152
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->igrf_magnetic_field) == 12, estimate_igrf_magnetic_field);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->sun) == 12, estimate_sun);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->gyro_bias) == 12, estimate_gyro_bias);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->innovation) == 12, estimate_innovation);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->quaternion_err) == 12, estimate_quaternion_err);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate, quaternion_err) == offsetof(adcs_estimate, innovation) + 12,
+                   estimate_quaternion_err_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->quaternion_covar) == 12, estimate_quaternion_covar);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate *)0)->angular_rate_covar) == 12, estimate_angular_rate_covar);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate, angular_rate_covar) == offsetof(adcs_estimate, quaternion_covar) + 12,
+                   estimate_angular_rate_covar_follows);
+const adcs_field adcs_estimate_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.01f, adcs_estimate, igrf_magnetic_field), // [uT]
+    ADCS_FIELD(6, ADCS_FIELD_I16_F, 3, 0.0001f, adcs_estimate, sun),
+    ADCS_FIELD(12, ADCS_FIELD_I16_F, 3, 0.001f, adcs_estimate, gyro_bias),        // [deg/s]
+    ADCS_FIELD(18, ADCS_FIELD_I16_F, 6, 0.0001f, adcs_estimate, innovation),      // up to quaternion_err
+    ADCS_FIELD(30, ADCS_FIELD_I16_F, 6, 0.001f, adcs_estimate, quaternion_covar), // up to angular_rate_covar
+};
+
+// Table 152, unscaled
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->igrf_magnetic_field) == 6, estimate_raw_igrf_magnetic_field);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->sun) == 6, estimate_raw_sun);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate_raw, sun) == offsetof(adcs_estimate_raw, igrf_magnetic_field) + 6,
+                   estimate_raw_sun_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->gyro_bias) == 6, estimate_raw_gyro_bias);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate_raw, gyro_bias) == offsetof(adcs_estimate_raw, sun) + 6,
+                   estimate_raw_gyro_bias_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->innovation) == 6, estimate_raw_innovation);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate_raw, innovation) == offsetof(adcs_estimate_raw, gyro_bias) + 6,
+                   estimate_raw_innovation_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->quaternion_err) == 6, estimate_raw_quaternion_err);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate_raw, quaternion_err) == offsetof(adcs_estimate_raw, innovation) + 6,
+                   estimate_raw_quaternion_err_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->quaternion_covar) == 6, estimate_raw_quaternion_covar);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate_raw, quaternion_covar) ==
+                   offsetof(adcs_estimate_raw, quaternion_err) + 6,
+                   estimate_raw_quaternion_covar_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_estimate_raw *)0)->angular_rate_covar) == 6, estimate_raw_angular_rate_covar);
+ADCS_STATIC_ASSERT(offsetof(adcs_estimate_raw, angular_rate_covar) ==
+                   offsetof(adcs_estimate_raw, quaternion_covar) + 6,
+                   estimate_raw_angular_rate_covar_follows);
+const adcs_field adcs_estimate_raw_fields[] = {
+    // [0.01 uT, 0.0001, 0.001 deg/s, 0.001], up to angular_rate_covar
+    ADCS_FIELD(0, ADCS_FIELD_I16, 21, 0, adcs_estimate_raw, igrf_magnetic_field),
+};
+
+// Table 170, after the complete flag and error (table 171) in byte 0
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->epoch) == 4, asgp4_epoch);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->inclination) == 4, asgp4_inclination);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, inclination) == offsetof(adcs_asgp4, epoch) + 4,
+                   asgp4_inclination_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->RAAN) == 4, asgp4_RAAN);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, RAAN) == offsetof(adcs_asgp4, inclination) + 4, asgp4_RAAN_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->ECC) == 4, asgp4_ECC);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, ECC) == offsetof(adcs_asgp4, RAAN) + 4, asgp4_ECC_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->AOP) == 4, asgp4_AOP);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, AOP) == offsetof(adcs_asgp4, ECC) + 4, asgp4_AOP_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->MA) == 4, asgp4_MA);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, MA) == offsetof(adcs_asgp4, AOP) + 4, asgp4_MA_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->MM) == 4, asgp4_MM);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, MM) == offsetof(adcs_asgp4, MA) + 4, asgp4_MM_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_asgp4 *)0)->Bstar) == 4, asgp4_Bstar);
+ADCS_STATIC_ASSERT(offsetof(adcs_asgp4, Bstar) == offsetof(adcs_asgp4, MM) + 4, asgp4_Bstar_follows);
+const adcs_field adcs_asgp4_fields[] = {
+    ADCS_FIELD(1, ADCS_FIELD_F32, 8, 0, adcs_asgp4, epoch), // up to Bstar
+};
+
+// Table 153
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam2.centroid_x) == 2, raw_sensor_cam2_centroid_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam2.centroid_y) == 2, raw_sensor_cam2_centroid_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, cam2.centroid_y) == offsetof(adcs_raw_sensor, cam2.centroid_x) + 2,
+                   raw_sensor_cam2_centroid_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam2.capture_stat) == 1, raw_sensor_cam2_capture_stat);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam2.detect_result) == 1, raw_sensor_cam2_detect_result);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, cam2.detect_result) ==
+                   offsetof(adcs_raw_sensor, cam2.capture_stat) + 1,
+                   raw_sensor_cam2_detect_result_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam1.centroid_x) == 2, raw_sensor_cam1_centroid_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam1.centroid_y) == 2, raw_sensor_cam1_centroid_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, cam1.centroid_y) == offsetof(adcs_raw_sensor, cam1.centroid_x) + 2,
+                   raw_sensor_cam1_centroid_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam1.capture_stat) == 1, raw_sensor_cam1_capture_stat);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->cam1.detect_result) == 1, raw_sensor_cam1_detect_result);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, cam1.detect_result) ==
+                   offsetof(adcs_raw_sensor, cam1.capture_stat) + 1,
+                   raw_sensor_cam1_detect_result_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->css) == 10, raw_sensor_css);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->MTM.x) == 2, raw_sensor_MTM_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->MTM.y) == 2, raw_sensor_MTM_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, MTM.y) == offsetof(adcs_raw_sensor, MTM.x) + 2,
+                   raw_sensor_MTM_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->MTM.z) == 2, raw_sensor_MTM_z);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, MTM.z) == offsetof(adcs_raw_sensor, MTM.y) + 2,
+                   raw_sensor_MTM_z_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->rate.x) == 2, raw_sensor_rate_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->rate.y) == 2, raw_sensor_rate_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, rate.y) == offsetof(adcs_raw_sensor, rate.x) + 2,
+                   raw_sensor_rate_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_sensor *)0)->rate.z) == 2, raw_sensor_rate_z);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_sensor, rate.z) == offsetof(adcs_raw_sensor, rate.y) + 2,
+                   raw_sensor_rate_z_follows);
+const adcs_field adcs_raw_sensor_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16, 2, 0, adcs_raw_sensor, cam2.centroid_x),   // azimuth, up to cam2.centroid_y
+    ADCS_FIELD(4, ADCS_FIELD_U8, 2, 0, adcs_raw_sensor, cam2.capture_stat),  // table 123, up to cam2.detect_result
+    ADCS_FIELD(6, ADCS_FIELD_I16, 2, 0, adcs_raw_sensor, cam1.centroid_x),   // up to cam1.centroid_y
+    ADCS_FIELD(10, ADCS_FIELD_U8, 2, 0, adcs_raw_sensor, cam1.capture_stat), // up to cam1.detect_result
+    ADCS_FIELD(12, ADCS_FIELD_U8, 10, 0, adcs_raw_sensor, css),
+    ADCS_FIELD(22, ADCS_FIELD_I16, 3, 0, adcs_raw_sensor, MTM.x),  // up to MTM.z
+    ADCS_FIELD(28, ADCS_FIELD_I16, 3, 0, adcs_raw_sensor, rate.x), // up to rate.z
+};
+
+// Table 158
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->sol_stat) == 1, raw_gps_sol_stat);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->tracked_sats) == 1, raw_gps_tracked_sats);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, tracked_sats) == offsetof(adcs_raw_gps, sol_stat) + 1,
+                   raw_gps_tracked_sats_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->usedInSol_sats) == 1, raw_gps_usedInSol_sats);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, usedInSol_sats) == offsetof(adcs_raw_gps, tracked_sats) + 1,
+                   raw_gps_usedInSol_sats_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->xyz_lof_count) == 1, raw_gps_xyz_lof_count);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, xyz_lof_count) == offsetof(adcs_raw_gps, usedInSol_sats) + 1,
+                   raw_gps_xyz_lof_count_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->range_log_count) == 1, raw_gps_range_log_count);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, range_log_count) == offsetof(adcs_raw_gps, xyz_lof_count) + 1,
+                   raw_gps_range_log_count_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->response_msg) == 1, raw_gps_response_msg);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, response_msg) == offsetof(adcs_raw_gps, range_log_count) + 1,
+                   raw_gps_response_msg_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->reference_week) == 2, raw_gps_reference_week);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->time) == 4, raw_gps_time);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->x.pos) == 4, raw_gps_x_pos);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->x.vel) == 2, raw_gps_x_vel);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->y.pos) == 4, raw_gps_y_pos);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->y.vel) == 2, raw_gps_y_vel);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->z.pos) == 4, raw_gps_z_pos);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->z.vel) == 2, raw_gps_z_vel);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->pos_std_dev) == 12, raw_gps_pos_std_dev);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->vel_std_dev.x) == 1, raw_gps_vel_std_dev_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->vel_std_dev.y) == 1, raw_gps_vel_std_dev_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, vel_std_dev.y) == offsetof(adcs_raw_gps, vel_std_dev.x) + 1,
+                   raw_gps_vel_std_dev_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_raw_gps *)0)->vel_std_dev.z) == 1, raw_gps_vel_std_dev_z);
+ADCS_STATIC_ASSERT(offsetof(adcs_raw_gps, vel_std_dev.z) == offsetof(adcs_raw_gps, vel_std_dev.y) + 1,
+                   raw_gps_vel_std_dev_z_follows);
+const adcs_field adcs_raw_gps_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 6, 0, adcs_raw_gps, sol_stat), // up to response_msg
+    ADCS_FIELD(6, ADCS_FIELD_U16, 1, 0, adcs_raw_gps, reference_week),
+    ADCS_FIELD(8, ADCS_FIELD_U32, 1, 0, adcs_raw_gps, time),             // [ms]
+    ADCS_FIELD(12, ADCS_FIELD_I32, 1, 0, adcs_raw_gps, x.pos),           // [m]
+    ADCS_FIELD(16, ADCS_FIELD_I16, 1, 0, adcs_raw_gps, x.vel),           // [m/s]
+    ADCS_FIELD(18, ADCS_FIELD_I32, 1, 0, adcs_raw_gps, y.pos),           // [m]
+    ADCS_FIELD(22, ADCS_FIELD_I16, 1, 0, adcs_raw_gps, y.vel),           // [m/s]
+    ADCS_FIELD(24, ADCS_FIELD_I32, 1, 0, adcs_raw_gps, z.pos),           // [m]
+    ADCS_FIELD(28, ADCS_FIELD_I16, 1, 0, adcs_raw_gps, z.vel),           // [m/s]
+    ADCS_FIELD(30, ADCS_FIELD_U8_F, 3, 0.1f, adcs_raw_gps, pos_std_dev), // [m]
+    ADCS_FIELD(33, ADCS_FIELD_U8, 3, 0, adcs_raw_gps, vel_std_dev.x),    // [m/s], up to vel_std_dev.z
+};
+
+// Table 159. The three confidences come first, then the magnitudes, then catalogue number and centroid of each
+// star
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->detected_stars) == 1, star_track_detected_stars);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->img_noise) == 1, star_track_img_noise);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, img_noise) == offsetof(adcs_star_track, detected_stars) + 1,
+                   star_track_img_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->invalid_stars) == 1, star_track_invalid_stars);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, invalid_stars) == offsetof(adcs_star_track, img_noise) + 1,
+                   star_track_invalid_stars_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->identified_stars) == 1, star_track_identified_stars);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, identified_stars) == offsetof(adcs_star_track, invalid_stars) + 1,
+                   star_track_identified_stars_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->identification_mode) == 1, star_track_identification_mode);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, identification_mode) ==
+                   offsetof(adcs_star_track, identified_stars) + 1,
+                   star_track_identification_mode_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->img_dark_val) == 1, star_track_img_dark_val);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, img_dark_val) == offsetof(adcs_star_track, identification_mode) + 1,
+                   star_track_img_dark_val_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->flags.word[0]) == 4, star_track_flags_0);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->flags) * 8 >= 8, star_track_flags_0_bounds);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->sample_T) == 2, star_track_sample_T);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star1.confidence) == 1, star_track_star1_confidence);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star2.confidence) == 1, star_track_star2_confidence);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star3.confidence) == 1, star_track_star3_confidence);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star1.magnitude) == 2, star_track_star1_magnitude);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star2.magnitude) == 2, star_track_star2_magnitude);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star3.magnitude) == 2, star_track_star3_magnitude);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star1.catalouge_num) == 2, star_track_star1_catalouge_num);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star1.centroid_x) == 2, star_track_star1_centroid_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star1.centroid_y) == 2, star_track_star1_centroid_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, star1.centroid_y) == offsetof(adcs_star_track, star1.centroid_x) + 2,
+                   star_track_star1_centroid_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star2.catalouge_num) == 2, star_track_star2_catalouge_num);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star2.centroid_x) == 2, star_track_star2_centroid_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star2.centroid_y) == 2, star_track_star2_centroid_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, star2.centroid_y) == offsetof(adcs_star_track, star2.centroid_x) + 2,
+                   star_track_star2_centroid_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star3.catalouge_num) == 2, star_track_star3_catalouge_num);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star3.centroid_x) == 2, star_track_star3_centroid_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->star3.centroid_y) == 2, star_track_star3_centroid_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, star3.centroid_y) == offsetof(adcs_star_track, star3.centroid_x) + 2,
+                   star_track_star3_centroid_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->capture_t) == 2, star_track_capture_t);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->detect_t) == 2, star_track_detect_t);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, detect_t) == offsetof(adcs_star_track, capture_t) + 2,
+                   star_track_detect_t_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->identification_t) == 2, star_track_identification_t);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, identification_t) == offsetof(adcs_star_track, detect_t) + 2,
+                   star_track_identification_t_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->estimated_rate) == 12, star_track_estimated_rate);
+ADCS_STATIC_ASSERT(sizeof(((adcs_star_track *)0)->estimated_att) == 12, star_track_estimated_att);
+ADCS_STATIC_ASSERT(offsetof(adcs_star_track, estimated_att) == offsetof(adcs_star_track, estimated_rate) + 12,
+                   star_track_estimated_att_follows);
+const adcs_field adcs_star_track_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 6, 0, adcs_star_track, detected_stars), // up to img_dark_val
+    ADCS_FLAGS(6, 0, 8, adcs_star_track, flags, 0),                      // adcs_star_flag
+    ADCS_FIELD(7, ADCS_FIELD_U16, 1, 0, adcs_star_track, sample_T),
+    ADCS_FIELD(9, ADCS_FIELD_U8, 1, 0, adcs_star_track, star1.confidence),  // [%]
+    ADCS_FIELD(10, ADCS_FIELD_U8, 1, 0, adcs_star_track, star2.confidence), // [%]
+    ADCS_FIELD(11, ADCS_FIELD_U8, 1, 0, adcs_star_track, star3.confidence), // [%]
+    ADCS_FIELD(12, ADCS_FIELD_U16, 1, 0, adcs_star_track, star1.magnitude),
+    ADCS_FIELD(14, ADCS_FIELD_U16, 1, 0, adcs_star_track, star2.magnitude),
+    ADCS_FIELD(16, ADCS_FIELD_U16, 1, 0, adcs_star_track, star3.magnitude),
+    ADCS_FIELD(18, ADCS_FIELD_U16, 1, 0, adcs_star_track, star1.catalouge_num),
+    ADCS_FIELD(20, ADCS_FIELD_I16, 2, 0, adcs_star_track, star1.centroid_x), // up to star1.centroid_y
+    ADCS_FIELD(24, ADCS_FIELD_U16, 1, 0, adcs_star_track, star2.catalouge_num),
+    ADCS_FIELD(26, ADCS_FIELD_I16, 2, 0, adcs_star_track, star2.centroid_x), // up to star2.centroid_y
+    ADCS_FIELD(30, ADCS_FIELD_U16, 1, 0, adcs_star_track, star3.catalouge_num),
+    ADCS_FIELD(32, ADCS_FIELD_I16, 2, 0, adcs_star_track, star3.centroid_x),       // up to star3.centroid_y
+    ADCS_FIELD(36, ADCS_FIELD_U16, 3, 0, adcs_star_track, capture_t),              // [ms], up to identification_t
+    ADCS_FIELD(42, ADCS_FIELD_I16_F, 6, 0.0001f, adcs_star_track, estimated_rate), // up to estimated_att
+};
+
+// Three raw signed values
+ADCS_STATIC_ASSERT(sizeof(((xyz16 *)0)->x) == 2, xyz16_x);
+ADCS_STATIC_ASSERT(sizeof(((xyz16 *)0)->y) == 2, xyz16_y);
+ADCS_STATIC_ASSERT(offsetof(xyz16, y) == offsetof(xyz16, x) + 2, xyz16_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((xyz16 *)0)->z) == 2, xyz16_z);
+ADCS_STATIC_ASSERT(offsetof(xyz16, z) == offsetof(xyz16, y) + 2, xyz16_z_follows);
+const adcs_field adcs_xyz16_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16, 3, 0, xyz16, x), // up to z
+};
+
+// Table 154
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubesense1_3v3_I) == 4, pwr_temp_cubesense1_3v3_I);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubesense1_camSram_I) == 4, pwr_temp_cubesense1_camSram_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, cubesense1_camSram_I) == offsetof(adcs_pwr_temp, cubesense1_3v3_I) + 4,
+                   pwr_temp_cubesense1_camSram_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubesense2_3v3_I) == 4, pwr_temp_cubesense2_3v3_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, cubesense2_3v3_I) == offsetof(adcs_pwr_temp, cubesense1_camSram_I) + 4,
+                   pwr_temp_cubesense2_3v3_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubesense2_camSram_I) == 4, pwr_temp_cubesense2_camSram_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, cubesense2_camSram_I) == offsetof(adcs_pwr_temp, cubesense2_3v3_I) + 4,
+                   pwr_temp_cubesense2_camSram_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubecontrol_3v3_I) == 4, pwr_temp_cubecontrol_3v3_I);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubecontrol_5v_I) == 4, pwr_temp_cubecontrol_5v_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, cubecontrol_5v_I) == offsetof(adcs_pwr_temp, cubecontrol_3v3_I) + 4,
+                   pwr_temp_cubecontrol_5v_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubecontrol_vBat_I) == 4, pwr_temp_cubecontrol_vBat_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, cubecontrol_vBat_I) == offsetof(adcs_pwr_temp, cubecontrol_5v_I) + 4,
+                   pwr_temp_cubecontrol_vBat_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->wheel1_I) == 4, pwr_temp_wheel1_I);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->wheel2_I) == 4, pwr_temp_wheel2_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, wheel2_I) == offsetof(adcs_pwr_temp, wheel1_I) + 4,
+                   pwr_temp_wheel2_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->wheel3_I) == 4, pwr_temp_wheel3_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, wheel3_I) == offsetof(adcs_pwr_temp, wheel2_I) + 4,
+                   pwr_temp_wheel3_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubestar_I) == 4, pwr_temp_cubestar_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, cubestar_I) == offsetof(adcs_pwr_temp, wheel3_I) + 4,
+                   pwr_temp_cubestar_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->magnetorquer_I) == 4, pwr_temp_magnetorquer_I);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->cubestar_temp) == 4, pwr_temp_cubestar_temp);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->MCU_temp) == 4, pwr_temp_MCU_temp);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->MTM_temp) == 4, pwr_temp_MTM_temp);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->MTM2_temp) == 4, pwr_temp_MTM2_temp);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, MTM2_temp) == offsetof(adcs_pwr_temp, MTM_temp) + 4,
+                   pwr_temp_MTM2_temp_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->rate_sensor_temp.x) == 2, pwr_temp_rate_sensor_temp_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->rate_sensor_temp.y) == 2, pwr_temp_rate_sensor_temp_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, rate_sensor_temp.y) == offsetof(adcs_pwr_temp, rate_sensor_temp.x) + 2,
+                   pwr_temp_rate_sensor_temp_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp *)0)->rate_sensor_temp.z) == 2, pwr_temp_rate_sensor_temp_z);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp, rate_sensor_temp.z) == offsetof(adcs_pwr_temp, rate_sensor_temp.y) + 2,
+                   pwr_temp_rate_sensor_temp_z_follows);
+const adcs_field adcs_pwr_temp_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U16_F, 4, 0.1f, adcs_pwr_temp, cubesense1_3v3_I), // [mA], up to cubesense2_camSram_I
+    // [mA], up to cubecontrol_vBat_I
+    ADCS_FIELD(8, ADCS_FIELD_U16_F, 3, 0.48828125f, adcs_pwr_temp, cubecontrol_3v3_I),
+    ADCS_FIELD(14, ADCS_FIELD_U16_F, 4, 0.01f, adcs_pwr_temp, wheel1_I),      // [mA], up to cubestar_I
+    ADCS_FIELD(22, ADCS_FIELD_U16_F, 1, 0.1f, adcs_pwr_temp, magnetorquer_I), // [mA]
+    ADCS_FIELD(24, ADCS_FIELD_I16_F, 1, 0.01f, adcs_pwr_temp, cubestar_temp), // [C]
+    ADCS_FIELD(26, ADCS_FIELD_I16_F, 1, 1.0f, adcs_pwr_temp, MCU_temp),       // [C]
+    ADCS_FIELD(28, ADCS_FIELD_I16_F, 2, 0.1f, adcs_pwr_temp, MTM_temp),       // [C], up to MTM2_temp
+    ADCS_FIELD(32, ADCS_FIELD_I16, 3, 0, adcs_pwr_temp, rate_sensor_temp.x),  // [C], up to rate_sensor_temp.z
+};
+
+// Table 154, unscaled
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubesense1_3v3_I) == 2, pwr_temp_raw_cubesense1_3v3_I);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubesense1_camSram_I) == 2, pwr_temp_raw_cubesense1_camSram_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubesense1_camSram_I) ==
+                   offsetof(adcs_pwr_temp_raw, cubesense1_3v3_I) + 2,
+                   pwr_temp_raw_cubesense1_camSram_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubesense2_3v3_I) == 2, pwr_temp_raw_cubesense2_3v3_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubesense2_3v3_I) ==
+                   offsetof(adcs_pwr_temp_raw, cubesense1_camSram_I) + 2,
+                   pwr_temp_raw_cubesense2_3v3_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubesense2_camSram_I) == 2, pwr_temp_raw_cubesense2_camSram_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubesense2_camSram_I) ==
+                   offsetof(adcs_pwr_temp_raw, cubesense2_3v3_I) + 2,
+                   pwr_temp_raw_cubesense2_camSram_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubecontrol_3v3_I) == 2, pwr_temp_raw_cubecontrol_3v3_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubecontrol_3v3_I) ==
+                   offsetof(adcs_pwr_temp_raw, cubesense2_camSram_I) + 2,
+                   pwr_temp_raw_cubecontrol_3v3_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubecontrol_5v_I) == 2, pwr_temp_raw_cubecontrol_5v_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubecontrol_5v_I) ==
+                   offsetof(adcs_pwr_temp_raw, cubecontrol_3v3_I) + 2,
+                   pwr_temp_raw_cubecontrol_5v_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubecontrol_vBat_I) == 2, pwr_temp_raw_cubecontrol_vBat_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubecontrol_vBat_I) ==
+                   offsetof(adcs_pwr_temp_raw, cubecontrol_5v_I) + 2,
+                   pwr_temp_raw_cubecontrol_vBat_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->wheel1_I) == 2, pwr_temp_raw_wheel1_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, wheel1_I) == offsetof(adcs_pwr_temp_raw, cubecontrol_vBat_I) + 2,
+                   pwr_temp_raw_wheel1_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->wheel2_I) == 2, pwr_temp_raw_wheel2_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, wheel2_I) == offsetof(adcs_pwr_temp_raw, wheel1_I) + 2,
+                   pwr_temp_raw_wheel2_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->wheel3_I) == 2, pwr_temp_raw_wheel3_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, wheel3_I) == offsetof(adcs_pwr_temp_raw, wheel2_I) + 2,
+                   pwr_temp_raw_wheel3_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubestar_I) == 2, pwr_temp_raw_cubestar_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, cubestar_I) == offsetof(adcs_pwr_temp_raw, wheel3_I) + 2,
+                   pwr_temp_raw_cubestar_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->magnetorquer_I) == 2, pwr_temp_raw_magnetorquer_I);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, magnetorquer_I) == offsetof(adcs_pwr_temp_raw, cubestar_I) + 2,
+                   pwr_temp_raw_magnetorquer_I_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->cubestar_temp) == 2, pwr_temp_raw_cubestar_temp);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->MCU_temp) == 2, pwr_temp_raw_MCU_temp);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, MCU_temp) == offsetof(adcs_pwr_temp_raw, cubestar_temp) + 2,
+                   pwr_temp_raw_MCU_temp_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->MTM_temp) == 2, pwr_temp_raw_MTM_temp);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, MTM_temp) == offsetof(adcs_pwr_temp_raw, MCU_temp) + 2,
+                   pwr_temp_raw_MTM_temp_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->MTM2_temp) == 2, pwr_temp_raw_MTM2_temp);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, MTM2_temp) == offsetof(adcs_pwr_temp_raw, MTM_temp) + 2,
+                   pwr_temp_raw_MTM2_temp_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->rate_sensor_temp.x) == 2, pwr_temp_raw_rate_sensor_temp_x);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->rate_sensor_temp.y) == 2, pwr_temp_raw_rate_sensor_temp_y);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, rate_sensor_temp.y) ==
+                   offsetof(adcs_pwr_temp_raw, rate_sensor_temp.x) + 2,
+                   pwr_temp_raw_rate_sensor_temp_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_pwr_temp_raw *)0)->rate_sensor_temp.z) == 2, pwr_temp_raw_rate_sensor_temp_z);
+ADCS_STATIC_ASSERT(offsetof(adcs_pwr_temp_raw, rate_sensor_temp.z) ==
+                   offsetof(adcs_pwr_temp_raw, rate_sensor_temp.y) + 2,
+                   pwr_temp_raw_rate_sensor_temp_z_follows);
+const adcs_field adcs_pwr_temp_raw_fields[] = {
+    // [0.1 mA, 0.488281 mA, 0.01 mA], up to magnetorquer_I
+    ADCS_FIELD(0, ADCS_FIELD_U16, 12, 0, adcs_pwr_temp_raw, cubesense1_3v3_I),
+    // [0.01 C, 1 C, 0.1 C], up to MTM2_temp
+    ADCS_FIELD(24, ADCS_FIELD_I16, 4, 0, adcs_pwr_temp_raw, cubestar_temp),
+    ADCS_FIELD(32, ADCS_FIELD_I16, 3, 0, adcs_pwr_temp_raw, rate_sensor_temp.x), // up to rate_sensor_temp.z
+};
+
+// Table 186, roll, pitch, yaw
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->x) == 4, att_angle_x);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->y) == 4, att_angle_y);
+ADCS_STATIC_ASSERT(offsetof(xyz, y) == offsetof(xyz, x) + 4, att_angle_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->z) == 4, att_angle_z);
+ADCS_STATIC_ASSERT(offsetof(xyz, z) == offsetof(xyz, y) + 4, att_angle_z_follows);
+const adcs_field adcs_att_angle_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.01f, xyz, x), // [deg], up to z
+};
+
+// Table 187, longitude, latitude, altitude
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->x) == 4, track_ref_x);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->y) == 4, track_ref_y);
+ADCS_STATIC_ASSERT(offsetof(xyz, y) == offsetof(xyz, x) + 4, track_ref_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->z) == 4, track_ref_z);
+ADCS_STATIC_ASSERT(offsetof(xyz, z) == offsetof(xyz, y) + 4, track_ref_z_follows);
+const adcs_field adcs_track_ref_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 3, 0, xyz, x), // [deg, m], up to z
+};
+
+// Table 214, unit vector
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->x) == 4, iner_ref_x);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->y) == 4, iner_ref_y);
+ADCS_STATIC_ASSERT(offsetof(xyz, y) == offsetof(xyz, x) + 4, iner_ref_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((xyz *)0)->z) == 4, iner_ref_z);
+ADCS_STATIC_ASSERT(offsetof(xyz, z) == offsetof(xyz, y) + 4, iner_ref_z_follows);
+const adcs_field adcs_iner_ref_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.0001f, xyz, x), // up to z
+};
+
+// Table 194
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->inclination) == 8, sgp4_inclination);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->ECC) == 8, sgp4_ECC);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, ECC) == offsetof(adcs_sgp4, inclination) + 8, sgp4_ECC_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->RAAN) == 8, sgp4_RAAN);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, RAAN) == offsetof(adcs_sgp4, ECC) + 8, sgp4_RAAN_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->AOP) == 8, sgp4_AOP);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, AOP) == offsetof(adcs_sgp4, RAAN) + 8, sgp4_AOP_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->Bstar) == 8, sgp4_Bstar);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, Bstar) == offsetof(adcs_sgp4, AOP) + 8, sgp4_Bstar_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->MM) == 8, sgp4_MM);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, MM) == offsetof(adcs_sgp4, Bstar) + 8, sgp4_MM_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->MA) == 8, sgp4_MA);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, MA) == offsetof(adcs_sgp4, MM) + 8, sgp4_MA_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sgp4 *)0)->epoch) == 8, sgp4_epoch);
+ADCS_STATIC_ASSERT(offsetof(adcs_sgp4, epoch) == offsetof(adcs_sgp4, MA) + 8, sgp4_epoch_follows);
+const adcs_field adcs_sgp4_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F64, 8, 0, adcs_sgp4, inclination), // [deg, orbit/day, year.day], up to epoch
+};
+
+// Tables 201-207
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->acp_type) == 1, sys_config_acp_type);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->special_ctrl_sel) == 1, sys_config_special_ctrl_sel);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_sig_ver) == 1, sys_config_CC_sig_ver);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_motor_ver) == 1, sys_config_CC_motor_ver);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, CC_motor_ver) == offsetof(adcs_sysConfig, CC_sig_ver) + 1,
+                   sys_config_CC_motor_ver_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS1_ver) == 1, sys_config_CS1_ver);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, CS1_ver) == offsetof(adcs_sysConfig, CC_motor_ver) + 1,
+                   sys_config_CS1_ver_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS2_ver) == 1, sys_config_CS2_ver);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, CS2_ver) == offsetof(adcs_sysConfig, CS1_ver) + 1,
+                   sys_config_CS2_ver_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS1_cam) == 1, sys_config_CS1_cam);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS2_cam) == 1, sys_config_CS2_cam);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->cubeStar_ver) == 1, sys_config_cubeStar_ver);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->GPS) == 1, sys_config_GPS);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->include_MTM2) == 1, sys_config_include_MTM2);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->MTQ_max_dipole) == 12, sys_config_MTQ_max_dipole);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->MTQ_ontime_res) == 4, sys_config_MTQ_ontime_res);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, MTQ_ontime_res) == offsetof(adcs_sysConfig, MTQ_max_dipole) + 12,
+                   sys_config_MTQ_ontime_res_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->MTQ_max_ontime) == 4, sys_config_MTQ_max_ontime);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, MTQ_max_ontime) == offsetof(adcs_sysConfig, MTQ_ontime_res) + 4,
+                   sys_config_MTQ_max_ontime_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->RW_max_torque) == 12, sys_config_RW_max_torque);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, RW_max_torque) == offsetof(adcs_sysConfig, MTQ_max_ontime) + 4,
+                   sys_config_RW_max_torque_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->RW_max_moment) == 12, sys_config_RW_max_moment);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, RW_max_moment) == offsetof(adcs_sysConfig, RW_max_torque) + 12,
+                   sys_config_RW_max_moment_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->RW_inertia) == 12, sys_config_RW_inertia);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, RW_inertia) == offsetof(adcs_sysConfig, RW_max_moment) + 12,
+                   sys_config_RW_inertia_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->RW_torque_inc) == 4, sys_config_RW_torque_inc);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, RW_torque_inc) == offsetof(adcs_sysConfig, RW_inertia) + 12,
+                   sys_config_RW_torque_inc_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->MTM1) == 48, sys_config_MTM1);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, MTM1) == offsetof(adcs_sysConfig, RW_torque_inc) + 4,
+                   sys_config_MTM1_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->MTM2) == 48, sys_config_MTM2);
+ADCS_STATIC_ASSERT(offsetof(adcs_sysConfig, MTM2) == offsetof(adcs_sysConfig, MTM1) + 48, sys_config_MTM2_follows);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_signal.port) == 1, sys_config_CC_signal_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_signal.pin) == 1, sys_config_CC_signal_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_motor.port) == 1, sys_config_CC_motor_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_motor.pin) == 1, sys_config_CC_motor_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_common.port) == 1, sys_config_CC_common_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CC_common.pin) == 1, sys_config_CC_common_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS1.port) == 1, sys_config_CS1_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS1.pin) == 1, sys_config_CS1_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS2.port) == 1, sys_config_CS2_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CS2.pin) == 1, sys_config_CS2_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->cubeStar.port) == 1, sys_config_cubeStar_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->cubeStar.pin) == 1, sys_config_cubeStar_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CW1.port) == 1, sys_config_CW1_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CW1.pin) == 1, sys_config_CW1_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CW2.port) == 1, sys_config_CW2_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CW2.pin) == 1, sys_config_CW2_pin);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CW3.port) == 1, sys_config_CW3_port);
+ADCS_STATIC_ASSERT(sizeof(((adcs_sysConfig *)0)->CW3.pin) == 1, sys_config_CW3_pin);
+const adcs_field adcs_sys_config_fields[] = {
+    ADCS_BITS(0, 0, 4, adcs_sysConfig, acp_type),                   // table 202
+    ADCS_BITS(0, 4, 4, adcs_sysConfig, special_ctrl_sel),           // table 203
+    ADCS_FIELD(1, ADCS_FIELD_U8, 4, 0, adcs_sysConfig, CC_sig_ver), // up to CS2_ver
+    ADCS_BITS(5, 0, 4, adcs_sysConfig, CS1_cam),                    // table 204
+    ADCS_BITS(5, 4, 4, adcs_sysConfig, CS2_cam),                    // table 204
+    ADCS_FIELD(6, ADCS_FIELD_U8, 1, 0, adcs_sysConfig, cubeStar_ver),
+    ADCS_BITS(7, 0, 4, adcs_sysConfig, GPS), // table 205
+    ADCS_BITS(7, 4, 1, adcs_sysConfig, include_MTM2),
+    // [A.m^2, s, N.m, Nms, kg.m^2], up to MTM2
+    ADCS_FIELD(8, ADCS_FIELD_F32, 39, 0, adcs_sysConfig, MTQ_max_dipole),
+    ADCS_BITS(164, 0, 4, adcs_sysConfig, CC_signal.port), // table 206
+    ADCS_BITS(164, 4, 4, adcs_sysConfig, CC_signal.pin),  // table 207
+    ADCS_BITS(165, 0, 4, adcs_sysConfig, CC_motor.port),
+    ADCS_BITS(165, 4, 4, adcs_sysConfig, CC_motor.pin),
+    ADCS_BITS(166, 0, 4, adcs_sysConfig, CC_common.port),
+    ADCS_BITS(166, 4, 4, adcs_sysConfig, CC_common.pin),
+    ADCS_BITS(167, 0, 4, adcs_sysConfig, CS1.port),
+    ADCS_BITS(167, 4, 4, adcs_sysConfig, CS1.pin),
+    ADCS_BITS(168, 0, 4, adcs_sysConfig, CS2.port),
+    ADCS_BITS(168, 4, 4, adcs_sysConfig, CS2.pin),
+    ADCS_BITS(169, 0, 4, adcs_sysConfig, cubeStar.port),
+    ADCS_BITS(169, 4, 4, adcs_sysConfig, cubeStar.pin),
+    ADCS_BITS(170, 0, 4, adcs_sysConfig, CW1.port),
+    ADCS_BITS(170, 4, 4, adcs_sysConfig, CW1.pin),
+    ADCS_BITS(171, 0, 4, adcs_sysConfig, CW2.port),
+    ADCS_BITS(171, 4, 4, adcs_sysConfig, CW2.pin),
+    ADCS_BITS(172, 0, 4, adcs_sysConfig, CW3.port),
+    ADCS_BITS(172, 4, 4, adcs_sysConfig, CW3.pin),
+};
+
+// Table 189
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_sense.mounting_angle) == 12,
+                   cubesense_cam1_sense_mounting_angle);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_sense.detect_th) == 1, cubesense_cam1_sense_detect_th);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_sense.auto_adjust) == 1, cubesense_cam1_sense_auto_adjust);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_sense.exposure_t) == 2, cubesense_cam1_sense_exposure_t);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_sense.boresight_x) == 4, cubesense_cam1_sense_boresight_x);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_sense.boresight_y) == 4, cubesense_cam1_sense_boresight_y);
+ADCS_STATIC_ASSERT(offsetof(cubesense_config, cam1_sense.boresight_y) ==
+                   offsetof(cubesense_config, cam1_sense.boresight_x) + 4,
+                   cubesense_cam1_sense_boresight_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_sense.mounting_angle) == 12,
+                   cubesense_cam2_sense_mounting_angle);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_sense.detect_th) == 1, cubesense_cam2_sense_detect_th);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_sense.auto_adjust) == 1, cubesense_cam2_sense_auto_adjust);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_sense.exposure_t) == 2, cubesense_cam2_sense_exposure_t);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_sense.boresight_x) == 4, cubesense_cam2_sense_boresight_x);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_sense.boresight_y) == 4, cubesense_cam2_sense_boresight_y);
+ADCS_STATIC_ASSERT(offsetof(cubesense_config, cam2_sense.boresight_y) ==
+                   offsetof(cubesense_config, cam2_sense.boresight_x) + 4,
+                   cubesense_cam2_sense_boresight_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->nadir_max_deviate) == 1, cubesense_nadir_max_deviate);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->nadir_max_bad_edge) == 1, cubesense_nadir_max_bad_edge);
+ADCS_STATIC_ASSERT(offsetof(cubesense_config, nadir_max_bad_edge) ==
+                   offsetof(cubesense_config, nadir_max_deviate) + 1,
+                   cubesense_nadir_max_bad_edge_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->nadir_max_radius) == 1, cubesense_nadir_max_radius);
+ADCS_STATIC_ASSERT(offsetof(cubesense_config, nadir_max_radius) ==
+                   offsetof(cubesense_config, nadir_max_bad_edge) + 1,
+                   cubesense_nadir_max_radius_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->nadir_min_radius) == 1, cubesense_nadir_min_radius);
+ADCS_STATIC_ASSERT(offsetof(cubesense_config, nadir_min_radius) ==
+                   offsetof(cubesense_config, nadir_max_radius) + 1,
+                   cubesense_nadir_min_radius_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam1_area) == 40, cubesense_cam1_area);
+ADCS_STATIC_ASSERT(sizeof(((cubesense_config *)0)->cam2_area) == 40, cubesense_cam2_area);
+ADCS_STATIC_ASSERT(offsetof(cubesense_config, cam2_area) == offsetof(cubesense_config, cam1_area) + 40,
+                   cubesense_cam2_area_follows);
+const adcs_field adcs_cubesense_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.01f, cubesense_config, cam1_sense.mounting_angle), // [deg]
+    ADCS_FIELD(6, ADCS_FIELD_U8, 1, 0, cubesense_config, cam1_sense.detect_th),
+    ADCS_BITS(7, 0, 1, cubesense_config, cam1_sense.auto_adjust),
+    ADCS_FIELD(8, ADCS_FIELD_U16, 1, 0, cubesense_config, cam1_sense.exposure_t),
+    // [pixels], up to cam1_sense.boresight_y
+    ADCS_FIELD(10, ADCS_FIELD_U16_F, 2, 0.01f, cubesense_config, cam1_sense.boresight_x),
+    ADCS_FIELD(14, ADCS_FIELD_I16_F, 3, 0.01f, cubesense_config, cam2_sense.mounting_angle), // [deg]
+    ADCS_FIELD(20, ADCS_FIELD_U8, 1, 0, cubesense_config, cam2_sense.detect_th),
+    ADCS_BITS(21, 0, 1, cubesense_config, cam2_sense.auto_adjust),
+    ADCS_FIELD(22, ADCS_FIELD_U16, 1, 0, cubesense_config, cam2_sense.exposure_t),
+    // [pixels], up to cam2_sense.boresight_y
+    ADCS_FIELD(24, ADCS_FIELD_U16_F, 2, 0.01f, cubesense_config, cam2_sense.boresight_x),
+    ADCS_FIELD(28, ADCS_FIELD_U8, 4, 0, cubesense_config, nadir_max_deviate), // up to nadir_min_radius
+    // x min, x max, y min, y max of 5 areas, up to cam2_area
+    ADCS_FIELD(32, ADCS_FIELD_U16, 40, 0, cubesense_config, cam1_area),
+};
+
+// Table 179, axis selection (table 180)
+ADCS_STATIC_ASSERT(sizeof(((xyzu8 *)0)->x) == 1, mtq_x);
+ADCS_STATIC_ASSERT(sizeof(((xyzu8 *)0)->y) == 1, mtq_y);
+ADCS_STATIC_ASSERT(offsetof(xyzu8, y) == offsetof(xyzu8, x) + 1, mtq_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((xyzu8 *)0)->z) == 1, mtq_z);
+ADCS_STATIC_ASSERT(offsetof(xyzu8, z) == offsetof(xyzu8, y) + 1, mtq_z_follows);
+const adcs_field adcs_mtq_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 3, 0, xyzu8, x), // up to z
+};
+
+// Table 182
+ADCS_STATIC_ASSERT(sizeof(((rate_gyro_config *)0)->gyro) == 3, rate_gyro_gyro);
+ADCS_STATIC_ASSERT(sizeof(((rate_gyro_config *)0)->sensor_offset) == 12, rate_gyro_sensor_offset);
+ADCS_STATIC_ASSERT(sizeof(((rate_gyro_config *)0)->rate_sensor_mult) == 1, rate_gyro_rate_sensor_mult);
+const adcs_field adcs_rate_gyro_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 3, 0, rate_gyro_config, gyro),                  // table 180
+    ADCS_FIELD(3, ADCS_FIELD_I16_F, 3, 0.001f, rate_gyro_config, sensor_offset), // [deg/s]
+    ADCS_FIELD(9, ADCS_FIELD_U8, 1, 0, rate_gyro_config, rate_sensor_mult),
+};
+
+// Table 183
+ADCS_STATIC_ASSERT(sizeof(((css_config *)0)->config) == 10, css_config);
+ADCS_STATIC_ASSERT(sizeof(((css_config *)0)->rel_scale) == 40, css_rel_scale);
+ADCS_STATIC_ASSERT(sizeof(((css_config *)0)->threshold) == 1, css_threshold);
+const adcs_field adcs_css_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 10, 0, css_config, config), // table 180
+    ADCS_FIELD(10, ADCS_FIELD_U8_F, 10, 0.01f, css_config, rel_scale),
+    ADCS_FIELD(20, ADCS_FIELD_U8, 1, 0, css_config, threshold),
+};
+
+// Tables 190, 191. The sensitivity matrix comes as S11, S22, S33, S12, S13, S21, S23, S31, S32 and is stored row-
+// major
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->mounting_angle) == 12, mtm_mounting_angle);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->channel_offset) == 12, mtm_channel_offset);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat[0]) == 4, mtm_sensitivity_mat_0);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat) >= 4, mtm_sensitivity_mat_0_bounds);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat[4]) == 4, mtm_sensitivity_mat_4);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat) >= 20, mtm_sensitivity_mat_4_bounds);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat[8]) == 4, mtm_sensitivity_mat_8);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat) >= 36, mtm_sensitivity_mat_8_bounds);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat[1]) == 4, mtm_sensitivity_mat_1);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat) >= 16, mtm_sensitivity_mat_1_bounds);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat[5]) == 4, mtm_sensitivity_mat_5);
+ADCS_STATIC_ASSERT(sizeof(((mtm_config *)0)->sensitivity_mat) >= 32, mtm_sensitivity_mat_5_bounds);
+const adcs_field adcs_mtm_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.01f, mtm_config, mounting_angle), // [deg]
+    ADCS_FIELD(6, ADCS_FIELD_I16_F, 3, 0.001f, mtm_config, channel_offset),
+    ADCS_FIELD(12, ADCS_FIELD_I16_F, 1, 0.001f, mtm_config, sensitivity_mat[0]),
+    ADCS_FIELD(14, ADCS_FIELD_I16_F, 1, 0.001f, mtm_config, sensitivity_mat[4]),
+    ADCS_FIELD(16, ADCS_FIELD_I16_F, 1, 0.001f, mtm_config, sensitivity_mat[8]),
+    ADCS_FIELD(18, ADCS_FIELD_I16_F, 3, 0.001f, mtm_config, sensitivity_mat[1]),
+    ADCS_FIELD(24, ADCS_FIELD_I16_F, 3, 0.001f, mtm_config, sensitivity_mat[5]),
+};
+
+// Table 188
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->mounting_angle) == 12, star_tracker_mounting_angle);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->exposure_t) == 2, star_tracker_exposure_t);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->analog_gain) == 2, star_tracker_analog_gain);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, analog_gain) == offsetof(cubestar_config, exposure_t) + 2,
+                   star_tracker_analog_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->detect_th) == 1, star_tracker_detect_th);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->star_th) == 1, star_tracker_star_th);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, star_th) == offsetof(cubestar_config, detect_th) + 1,
+                   star_tracker_star_th_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->max_star_matched) == 1, star_tracker_max_star_matched);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, max_star_matched) == offsetof(cubestar_config, star_th) + 1,
+                   star_tracker_max_star_matched_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->detect_timeout_t) == 2, star_tracker_detect_timeout_t);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->max_pixel) == 1, star_tracker_max_pixel);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->min_pixel) == 1, star_tracker_min_pixel);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, min_pixel) == offsetof(cubestar_config, max_pixel) + 1,
+                   star_tracker_min_pixel_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->err_margin) == 1, star_tracker_err_margin);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, err_margin) == offsetof(cubestar_config, min_pixel) + 1,
+                   star_tracker_err_margin_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->delay_t) == 2, star_tracker_delay_t);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->centroid_x) == 4, star_tracker_centroid_x);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->centroid_y) == 4, star_tracker_centroid_y);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, centroid_y) == offsetof(cubestar_config, centroid_x) + 4,
+                   star_tracker_centroid_y_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->focal_len) == 4, star_tracker_focal_len);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, focal_len) == offsetof(cubestar_config, centroid_y) + 4,
+                   star_tracker_focal_len_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->radical_distor_ceof1) == 4, star_tracker_radical_distor_ceof1);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, radical_distor_ceof1) == offsetof(cubestar_config, focal_len) + 4,
+                   star_tracker_radical_distor_ceof1_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->radical_distor_ceof2) == 4, star_tracker_radical_distor_ceof2);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, radical_distor_ceof2) ==
+                   offsetof(cubestar_config, radical_distor_ceof1) + 4,
+                   star_tracker_radical_distor_ceof2_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->tangent_distor_ceof1) == 4, star_tracker_tangent_distor_ceof1);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, tangent_distor_ceof1) ==
+                   offsetof(cubestar_config, radical_distor_ceof2) + 4,
+                   star_tracker_tangent_distor_ceof1_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->tangent_distor_ceof2) == 4, star_tracker_tangent_distor_ceof2);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, tangent_distor_ceof2) ==
+                   offsetof(cubestar_config, tangent_distor_ceof1) + 4,
+                   star_tracker_tangent_distor_ceof2_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->window_wid) == 1, star_tracker_window_wid);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->track_margin) == 1, star_tracker_track_margin);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, track_margin) == offsetof(cubestar_config, window_wid) + 1,
+                   star_tracker_track_margin_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->valid_margin) == 1, star_tracker_valid_margin);
+ADCS_STATIC_ASSERT(offsetof(cubestar_config, valid_margin) == offsetof(cubestar_config, track_margin) + 1,
+                   star_tracker_valid_margin_follows);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->module_en) == 1, star_tracker_module_en);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->loc_predict_en) == 1, star_tracker_loc_predict_en);
+ADCS_STATIC_ASSERT(sizeof(((cubestar_config *)0)->search_wid) == 1, star_tracker_search_wid);
+const adcs_field adcs_star_tracker_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_I16_F, 3, 0.01f, cubestar_config, mounting_angle), // [deg]
+    ADCS_FIELD(6, ADCS_FIELD_U16, 2, 0, cubestar_config, exposure_t),           // up to analog_gain
+    ADCS_FIELD(10, ADCS_FIELD_U8, 3, 0, cubestar_config, detect_th),            // up to max_star_matched
+    ADCS_FIELD(13, ADCS_FIELD_U16, 1, 0, cubestar_config, detect_timeout_t),
+    ADCS_FIELD(15, ADCS_FIELD_U8, 3, 0, cubestar_config, max_pixel), // [%], up to err_margin
+    ADCS_FIELD(18, ADCS_FIELD_U16, 1, 0, cubestar_config, delay_t),
+    ADCS_FIELD(20, ADCS_FIELD_F32, 7, 0, cubestar_config, centroid_x), // [mm], up to tangent_distor_ceof2
+    ADCS_FIELD(48, ADCS_FIELD_U8, 3, 0, cubestar_config, window_wid),  // [%], up to valid_margin
+    ADCS_BITS(51, 0, 1, cubestar_config, module_en),
+    ADCS_BITS(51, 1, 1, cubestar_config, loc_predict_en),
+    // 52: search_wid, packed by hand (raw = search_wid * 5)
+};
+
+// Table 195
+ADCS_STATIC_ASSERT(sizeof(((detumble_config *)0)->spin_gain) == 4, detumble_spin_gain);
+ADCS_STATIC_ASSERT(sizeof(((detumble_config *)0)->damping_gain) == 4, detumble_damping_gain);
+ADCS_STATIC_ASSERT(offsetof(detumble_config, damping_gain) == offsetof(detumble_config, spin_gain) + 4,
+                   detumble_damping_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((detumble_config *)0)->spin_rate) == 4, detumble_spin_rate);
+ADCS_STATIC_ASSERT(sizeof(((detumble_config *)0)->fast_bDot) == 4, detumble_fast_bDot);
+const adcs_field adcs_detumble_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 2, 0, detumble_config, spin_gain),        // up to damping_gain
+    ADCS_FIELD(8, ADCS_FIELD_I16_F, 1, 0.001f, detumble_config, spin_rate), // [deg/s]
+    ADCS_FIELD(10, ADCS_FIELD_F32, 1, 0, detumble_config, fast_bDot),
+};
+
+// Table 196
+ADCS_STATIC_ASSERT(sizeof(((ywheel_ctrl_config *)0)->control_gain) == 4, ywheel_control_gain);
+ADCS_STATIC_ASSERT(sizeof(((ywheel_ctrl_config *)0)->damping_gain) == 4, ywheel_damping_gain);
+ADCS_STATIC_ASSERT(offsetof(ywheel_ctrl_config, damping_gain) == offsetof(ywheel_ctrl_config, control_gain) + 4,
+                   ywheel_damping_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((ywheel_ctrl_config *)0)->proportional_gain) == 4, ywheel_proportional_gain);
+ADCS_STATIC_ASSERT(offsetof(ywheel_ctrl_config, proportional_gain) ==
+                   offsetof(ywheel_ctrl_config, damping_gain) + 4,
+                   ywheel_proportional_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((ywheel_ctrl_config *)0)->derivative_gain) == 4, ywheel_derivative_gain);
+ADCS_STATIC_ASSERT(offsetof(ywheel_ctrl_config, derivative_gain) ==
+                   offsetof(ywheel_ctrl_config, proportional_gain) + 4,
+                   ywheel_derivative_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((ywheel_ctrl_config *)0)->reference) == 4, ywheel_reference);
+ADCS_STATIC_ASSERT(offsetof(ywheel_ctrl_config, reference) == offsetof(ywheel_ctrl_config, derivative_gain) + 4,
+                   ywheel_reference_follows);
+const adcs_field adcs_ywheel_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 5, 0, ywheel_ctrl_config, control_gain), // [Nms], up to reference
+};
+
+// Table 197
+ADCS_STATIC_ASSERT(sizeof(((rwheel_ctrl_config *)0)->proportional_gain) == 4, rwheel_proportional_gain);
+ADCS_STATIC_ASSERT(sizeof(((rwheel_ctrl_config *)0)->derivative_gain) == 4, rwheel_derivative_gain);
+ADCS_STATIC_ASSERT(offsetof(rwheel_ctrl_config, derivative_gain) ==
+                   offsetof(rwheel_ctrl_config, proportional_gain) + 4,
+                   rwheel_derivative_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((rwheel_ctrl_config *)0)->bias_moment) == 4, rwheel_bias_moment);
+ADCS_STATIC_ASSERT(offsetof(rwheel_ctrl_config, bias_moment) == offsetof(rwheel_ctrl_config, derivative_gain) + 4,
+                   rwheel_bias_moment_follows);
+ADCS_STATIC_ASSERT(sizeof(((rwheel_ctrl_config *)0)->sun_point_facet) == 1, rwheel_sun_point_facet);
+ADCS_STATIC_ASSERT(sizeof(((rwheel_ctrl_config *)0)->auto_transit) == 1, rwheel_auto_transit);
+const adcs_field adcs_rwheel_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 3, 0, rwheel_ctrl_config, proportional_gain), // [Nms], up to bias_moment
+    ADCS_BITS(12, 0, 7, rwheel_ctrl_config, sun_point_facet),                   // table 180
+    ADCS_BITS(12, 7, 1, rwheel_ctrl_config, auto_transit),
+};
+
+// Table 198
+ADCS_STATIC_ASSERT(sizeof(((track_ctrl_config *)0)->proportional_gain) == 4, tracking_proportional_gain);
+ADCS_STATIC_ASSERT(sizeof(((track_ctrl_config *)0)->derivative_gain) == 4, tracking_derivative_gain);
+ADCS_STATIC_ASSERT(offsetof(track_ctrl_config, derivative_gain) ==
+                   offsetof(track_ctrl_config, proportional_gain) + 4,
+                   tracking_derivative_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((track_ctrl_config *)0)->integral_gain) == 4, tracking_integral_gain);
+ADCS_STATIC_ASSERT(offsetof(track_ctrl_config, integral_gain) == offsetof(track_ctrl_config, derivative_gain) + 4,
+                   tracking_integral_gain_follows);
+ADCS_STATIC_ASSERT(sizeof(((track_ctrl_config *)0)->target_facet) == 1, tracking_target_facet);
+const adcs_field adcs_tracking_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 3, 0, track_ctrl_config, proportional_gain), // up to integral_gain
+    ADCS_FIELD(12, ADCS_FIELD_U8, 1, 0, track_ctrl_config, target_facet),      // table 180
+};
+
+// Table 199
+ADCS_STATIC_ASSERT(sizeof(((moment_inertia_config *)0)->diag) == 12, moi_diag);
+ADCS_STATIC_ASSERT(sizeof(((moment_inertia_config *)0)->nondiag) == 12, moi_nondiag);
+ADCS_STATIC_ASSERT(offsetof(moment_inertia_config, nondiag) == offsetof(moment_inertia_config, diag) + 12,
+                   moi_nondiag_follows);
+const adcs_field adcs_moi_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 6, 0, moment_inertia_config, diag), // [kg.m^2], Ixx, Iyy, Izz, up to nondiag
+};
+
+// Table 200
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->MTM_rate_nosie) == 4, estimation_MTM_rate_nosie);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->EKF_noise) == 4, estimation_EKF_noise);
+ADCS_STATIC_ASSERT(offsetof(estimation_config, EKF_noise) == offsetof(estimation_config, MTM_rate_nosie) + 4,
+                   estimation_EKF_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->CSS_noise) == 4, estimation_CSS_noise);
+ADCS_STATIC_ASSERT(offsetof(estimation_config, CSS_noise) == offsetof(estimation_config, EKF_noise) + 4,
+                   estimation_CSS_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->suns_sensor_noise) == 4, estimation_suns_sensor_noise);
+ADCS_STATIC_ASSERT(offsetof(estimation_config, suns_sensor_noise) == offsetof(estimation_config, CSS_noise) + 4,
+                   estimation_suns_sensor_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->nadir_sensor_noise) == 4, estimation_nadir_sensor_noise);
+ADCS_STATIC_ASSERT(offsetof(estimation_config, nadir_sensor_noise) ==
+                   offsetof(estimation_config, suns_sensor_noise) + 4,
+                   estimation_nadir_sensor_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->MTM_noise) == 4, estimation_MTM_noise);
+ADCS_STATIC_ASSERT(offsetof(estimation_config, MTM_noise) == offsetof(estimation_config, nadir_sensor_noise) + 4,
+                   estimation_MTM_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->star_track_noise) == 4, estimation_star_track_noise);
+ADCS_STATIC_ASSERT(offsetof(estimation_config, star_track_noise) == offsetof(estimation_config, MTM_noise) + 4,
+                   estimation_star_track_noise_follows);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->select.word[0]) == 4, estimation_select_0);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->select) * 8 >= 6, estimation_select_0_bounds);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->MTM_mode) == 1, estimation_MTM_mode);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->MTM_select) == 1, estimation_MTM_select);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->select.word[0]) == 4, estimation_select_6);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->select) * 8 >= 7, estimation_select_6_bounds);
+ADCS_STATIC_ASSERT(sizeof(((estimation_config *)0)->cam_sample_period) == 1, estimation_cam_sample_period);
+const adcs_field adcs_estimation_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_F32, 7, 0, estimation_config, MTM_rate_nosie), // up to star_track_noise
+    ADCS_FLAGS(28, 0, 6, estimation_config, select, 0),                     // adcs_estimation_flag
+    ADCS_BITS(28, 6, 2, estimation_config, MTM_mode),
+    ADCS_BITS(29, 0, 2, estimation_config, MTM_select),
+    ADCS_FLAGS(29, 2, 1, estimation_config, select, 6),
+    ADCS_FIELD(30, ADCS_FIELD_U8, 1, 0, estimation_config, cam_sample_period),
+};
+
+// Table 209
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->inclination) == 4, asgp4_setting_inclination);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->RAAN) == 4, asgp4_setting_RAAN);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, RAAN) == offsetof(aspg4_setting, inclination) + 4,
+                   asgp4_setting_RAAN_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->ECC) == 4, asgp4_setting_ECC);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, ECC) == offsetof(aspg4_setting, RAAN) + 4, asgp4_setting_ECC_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->AoP) == 4, asgp4_setting_AoP);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, AoP) == offsetof(aspg4_setting, ECC) + 4, asgp4_setting_AoP_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->time) == 4, asgp4_setting_time);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, time) == offsetof(aspg4_setting, AoP) + 4, asgp4_setting_time_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->pos) == 4, asgp4_setting_pos);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, pos) == offsetof(aspg4_setting, time) + 4, asgp4_setting_pos_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->max_pos_err) == 4, asgp4_setting_max_pos_err);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->asgp4_filter) == 1, asgp4_setting_asgp4_filter);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->xp) == 4, asgp4_setting_xp);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->yp) == 4, asgp4_setting_yp);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, yp) == offsetof(aspg4_setting, xp) + 4, asgp4_setting_yp_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->gps_rollover) == 1, asgp4_setting_gps_rollover);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->pos_sd) == 4, asgp4_setting_pos_sd);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->vel_sd) == 4, asgp4_setting_vel_sd);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->min_sat) == 1, asgp4_setting_min_sat);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->time_gain) == 4, asgp4_setting_time_gain);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->max_lag) == 4, asgp4_setting_max_lag);
+ADCS_STATIC_ASSERT(offsetof(aspg4_setting, max_lag) == offsetof(aspg4_setting, time_gain) + 4,
+                   asgp4_setting_max_lag_follows);
+ADCS_STATIC_ASSERT(sizeof(((aspg4_setting *)0)->min_samples) == 2, asgp4_setting_min_samples);
+const adcs_field adcs_asgp4_setting_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U16_F, 6, 0.001f, aspg4_setting, inclination), // [deg], up to pos
+    ADCS_FIELD(12, ADCS_FIELD_U8_F, 1, 0.1f, aspg4_setting, max_pos_err),   // [km]
+    ADCS_FIELD(13, ADCS_FIELD_U8, 1, 0, aspg4_setting, asgp4_filter),       // table 193
+    ADCS_FIELD(14, ADCS_FIELD_I32_F, 2, 1e-07f, aspg4_setting, xp),         // [arcsec], up to yp
+    ADCS_FIELD(22, ADCS_FIELD_U8, 1, 0, aspg4_setting, gps_rollover),
+    ADCS_FIELD(23, ADCS_FIELD_U8_F, 1, 0.1f, aspg4_setting, pos_sd),  // [m]
+    ADCS_FIELD(24, ADCS_FIELD_U8_F, 1, 0.01f, aspg4_setting, vel_sd), // [m/s]
+    ADCS_FIELD(25, ADCS_FIELD_U8, 1, 0, aspg4_setting, min_sat),
+    ADCS_FIELD(26, ADCS_FIELD_U8_F, 2, 0.01f, aspg4_setting, time_gain), // [s], up to max_lag
+    ADCS_FIELD(28, ADCS_FIELD_U16, 1, 0, aspg4_setting, min_samples),
+};
+
+// Table 208
+ADCS_STATIC_ASSERT(sizeof(((usercoded_setting *)0)->controller) == 48, usercoded_controller);
+ADCS_STATIC_ASSERT(sizeof(((usercoded_setting *)0)->estimator) == 48, usercoded_estimator);
+ADCS_STATIC_ASSERT(offsetof(usercoded_setting, estimator) == offsetof(usercoded_setting, controller) + 48,
+                   usercoded_estimator_follows);
+const adcs_field adcs_usercoded_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 96, 0, usercoded_setting, controller), // up to estimator
+};
+
+// Table 192, the config messages back to back
+ADCS_STATIC_ASSERT(sizeof(((adcs_config *)0)->RW) == 4, full_config_RW);
+const adcs_field adcs_full_config_fields[] = {
+    ADCS_FIELD(0, ADCS_FIELD_U8, 3, 0, adcs_config, MTQ.x),                            // up to MTQ.z
+    ADCS_FIELD(3, ADCS_FIELD_U8, 4, 0, adcs_config, RW),                               // table 181
+    ADCS_FIELD(7, ADCS_FIELD_U8, 3, 0, adcs_config, rate_gyro.gyro),                   // table 180
+    ADCS_FIELD(10, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, rate_gyro.sensor_offset), // [deg/s]
+    ADCS_FIELD(16, ADCS_FIELD_U8, 1, 0, adcs_config, rate_gyro.rate_sensor_mult),
+    ADCS_FIELD(17, ADCS_FIELD_U8, 10, 0, adcs_config, css.config), // table 180
+    ADCS_FIELD(27, ADCS_FIELD_U8_F, 10, 0.01f, adcs_config, css.rel_scale),
+    ADCS_FIELD(37, ADCS_FIELD_U8, 1, 0, adcs_config, css.threshold),
+    ADCS_FIELD(38, ADCS_FIELD_I16_F, 3, 0.01f, adcs_config, cubesense.cam1_sense.mounting_angle), // [deg]
+    ADCS_FIELD(44, ADCS_FIELD_U8, 1, 0, adcs_config, cubesense.cam1_sense.detect_th),
+    ADCS_BITS(45, 0, 1, adcs_config, cubesense.cam1_sense.auto_adjust),
+    ADCS_FIELD(46, ADCS_FIELD_U16, 1, 0, adcs_config, cubesense.cam1_sense.exposure_t),
+    // [pixels], up to cubesense.cam1_sense.boresight_y
+    ADCS_FIELD(48, ADCS_FIELD_U16_F, 2, 0.01f, adcs_config, cubesense.cam1_sense.boresight_x),
+    ADCS_FIELD(52, ADCS_FIELD_I16_F, 3, 0.01f, adcs_config, cubesense.cam2_sense.mounting_angle), // [deg]
+    ADCS_FIELD(58, ADCS_FIELD_U8, 1, 0, adcs_config, cubesense.cam2_sense.detect_th),
+    ADCS_BITS(59, 0, 1, adcs_config, cubesense.cam2_sense.auto_adjust),
+    ADCS_FIELD(60, ADCS_FIELD_U16, 1, 0, adcs_config, cubesense.cam2_sense.exposure_t),
+    // [pixels], up to cubesense.cam2_sense.boresight_y
+    ADCS_FIELD(62, ADCS_FIELD_U16_F, 2, 0.01f, adcs_config, cubesense.cam2_sense.boresight_x),
+    // up to cubesense.nadir_min_radius
+    ADCS_FIELD(66, ADCS_FIELD_U8, 4, 0, adcs_config, cubesense.nadir_max_deviate),
+    // x min, x max, y min, y max of 5 areas, up to cubesense.cam2_area
+    ADCS_FIELD(70, ADCS_FIELD_U16, 40, 0, adcs_config, cubesense.cam1_area),
+    ADCS_FIELD(150, ADCS_FIELD_I16_F, 3, 0.01f, adcs_config, MTM1.mounting_angle), // [deg]
+    ADCS_FIELD(156, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, MTM1.channel_offset),
+    ADCS_FIELD(162, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, MTM1.sensitivity_mat[0]),
+    ADCS_FIELD(164, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, MTM1.sensitivity_mat[4]),
+    ADCS_FIELD(166, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, MTM1.sensitivity_mat[8]),
+    ADCS_FIELD(168, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, MTM1.sensitivity_mat[1]),
+    ADCS_FIELD(174, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, MTM1.sensitivity_mat[5]),
+    ADCS_FIELD(180, ADCS_FIELD_I16_F, 3, 0.01f, adcs_config, MTM2.mounting_angle), // [deg]
+    ADCS_FIELD(186, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, MTM2.channel_offset),
+    ADCS_FIELD(192, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, MTM2.sensitivity_mat[0]),
+    ADCS_FIELD(194, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, MTM2.sensitivity_mat[4]),
+    ADCS_FIELD(196, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, MTM2.sensitivity_mat[8]),
+    ADCS_FIELD(198, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, MTM2.sensitivity_mat[1]),
+    ADCS_FIELD(204, ADCS_FIELD_I16_F, 3, 0.001f, adcs_config, MTM2.sensitivity_mat[5]),
+    ADCS_FIELD(210, ADCS_FIELD_I16_F, 3, 0.01f, adcs_config, star_tracker.mounting_angle), // [deg]
+    ADCS_FIELD(216, ADCS_FIELD_U16, 2, 0, adcs_config, star_tracker.exposure_t), // up to star_tracker.analog_gain
+    // up to star_tracker.max_star_matched
+    ADCS_FIELD(220, ADCS_FIELD_U8, 3, 0, adcs_config, star_tracker.detect_th),
+    ADCS_FIELD(223, ADCS_FIELD_U16, 1, 0, adcs_config, star_tracker.detect_timeout_t),
+    // [%], up to star_tracker.err_margin
+    ADCS_FIELD(225, ADCS_FIELD_U8, 3, 0, adcs_config, star_tracker.max_pixel),
+    ADCS_FIELD(228, ADCS_FIELD_U16, 1, 0, adcs_config, star_tracker.delay_t),
+    // [mm], up to star_tracker.tangent_distor_ceof2
+    ADCS_FIELD(230, ADCS_FIELD_F32, 7, 0, adcs_config, star_tracker.centroid_x),
+    // [%], up to star_tracker.valid_margin
+    ADCS_FIELD(258, ADCS_FIELD_U8, 3, 0, adcs_config, star_tracker.window_wid),
+    ADCS_BITS(261, 0, 1, adcs_config, star_tracker.module_en),
+    ADCS_BITS(261, 1, 1, adcs_config, star_tracker.loc_predict_en),
+    // 262: star_tracker.search_wid, packed by hand (raw = search_wid * 5)
+    ADCS_FIELD(263, ADCS_FIELD_F32, 2, 0, adcs_config, detumble.spin_gain),        // up to detumble.damping_gain
+    ADCS_FIELD(271, ADCS_FIELD_I16_F, 1, 0.001f, adcs_config, detumble.spin_rate), // [deg/s]
+    ADCS_FIELD(273, ADCS_FIELD_F32, 1, 0, adcs_config, detumble.fast_bDot),
+    ADCS_FIELD(277, ADCS_FIELD_F32, 5, 0, adcs_config, ywheel.control_gain), // [Nms], up to ywheel.reference
+    // [Nms], up to rwheel.bias_moment
+    ADCS_FIELD(297, ADCS_FIELD_F32, 3, 0, adcs_config, rwheel.proportional_gain),
+    ADCS_BITS(309, 0, 7, adcs_config, rwheel.sun_point_facet), // table 180
+    ADCS_BITS(309, 7, 1, adcs_config, rwheel.auto_transit),
+    ADCS_FIELD(310, ADCS_FIELD_F32, 3, 0, adcs_config, tracking.proportional_gain), // up to tracking.integral_gain
+    ADCS_FIELD(322, ADCS_FIELD_U8, 1, 0, adcs_config, tracking.target_facet),       // table 180
+    ADCS_FIELD(323, ADCS_FIELD_F32, 6, 0, adcs_config, MoI.diag), // [kg.m^2], Ixx, Iyy, Izz, up to MoI.nondiag
+    // up to estimation.star_track_noise
+    ADCS_FIELD(347, ADCS_FIELD_F32, 7, 0, adcs_config, estimation.MTM_rate_nosie),
+    ADCS_FLAGS(375, 0, 6, adcs_config, estimation.select, 0), // adcs_estimation_flag
+    ADCS_BITS(375, 6, 2, adcs_config, estimation.MTM_mode),
+    ADCS_BITS(376, 0, 2, adcs_config, estimation.MTM_select),
+    ADCS_FLAGS(376, 2, 1, adcs_config, estimation.select, 6),
+    ADCS_FIELD(377, ADCS_FIELD_U8, 1, 0, adcs_config, estimation.cam_sample_period),
+    ADCS_FIELD(378, ADCS_FIELD_U16_F, 6, 0.001f, adcs_config, aspg4.inclination), // [deg], up to aspg4.pos
+    ADCS_FIELD(390, ADCS_FIELD_U8_F, 1, 0.1f, adcs_config, aspg4.max_pos_err),    // [km]
+    ADCS_FIELD(391, ADCS_FIELD_U8, 1, 0, adcs_config, aspg4.asgp4_filter),        // table 193
+    ADCS_FIELD(392, ADCS_FIELD_I32_F, 2, 1e-07f, adcs_config, aspg4.xp),          // [arcsec], up to aspg4.yp
+    ADCS_FIELD(400, ADCS_FIELD_U8, 1, 0, adcs_config, aspg4.gps_rollover),
+    ADCS_FIELD(401, ADCS_FIELD_U8_F, 1, 0.1f, adcs_config, aspg4.pos_sd),  // [m]
+    ADCS_FIELD(402, ADCS_FIELD_U8_F, 1, 0.01f, adcs_config, aspg4.vel_sd), // [m/s]
+    ADCS_FIELD(403, ADCS_FIELD_U8, 1, 0, adcs_config, aspg4.min_sat),
+    ADCS_FIELD(404, ADCS_FIELD_U8_F, 2, 0.01f, adcs_config, aspg4.time_gain), // [s], up to aspg4.max_lag
+    ADCS_FIELD(406, ADCS_FIELD_U16, 1, 0, adcs_config, aspg4.min_samples),
+    ADCS_FIELD(408, ADCS_FIELD_U8, 96, 0, adcs_config, usercoded.controller), // up to usercoded.estimator
+};
+
+// clang-format on
@@ -24,12 +24,14 @@
 
 #include <string.h>
 
+#include "adcs_cursor.h"
+#include "adcs_file_index.h"
+#include "adcs_fields.h"
+#include "adcs_frames.h"
 #include "adcs_io.h"
+#include "adcs_transport.h"
 #include "adcs_types.h"
 
-#define USE_UART
-//#define USE_I2C
-
 /*************************** General functions ***************************/
 /**
  * @brief
@@ -39,15 +41,49 @@
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState adcs_telecommand(uint8_t *command, uint32_t length) {
-    ADCS_returnState ack = ADCS_OK;
+    const adcs_transport *transport = adcs_active_transport();
+
+    if (transport == NULL || transport->send_telecommand == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    return transport->send_telecommand(command, length);
+}
 
-#if defined(USE_UART)
-    ack = send_uart_telecommand(command, length);
-#elif defined(USE_I2C)
-    ack = send_i2c_telecommand(command, length);
-#endif
+/**
+ * @brief
+ *      Send several telecommands of the same length, overlapping their acknowledges where the
+ *      transport allows and one by one otherwise
+ * @param commands
+ *      count telecommands of length bytes each (TC ID included), back to back
+ * @return
+ *      ADCS_OK if all were accepted, otherwise the first failure. Later telecommands are still
+ *      sent after a failed one.
+ */
+ADCS_returnState adcs_telecommands(uint8_t *commands, uint32_t length, uint32_t count) {
+    const adcs_transport *transport = adcs_active_transport();
+    ADCS_returnState result = ADCS_OK;
 
-    return ack;
+    if (transport == NULL || transport->send_telecommand == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    while (count > 0) {
+        uint32_t n;
+        ADCS_returnState state;
+
+        if (transport->send_telecommands != NULL) {
+            n = (count < ADCS_TC_WINDOW) ? count : ADCS_TC_WINDOW;
+            state = transport->send_telecommands(commands, length, n);
+        } else {
+            n = 1;
+            state = transport->send_telecommand(commands, length);
+        }
+        if (result == ADCS_OK) {
+            result = state;
+        }
+        commands += n * length;
+        count -= n;
+    }
+    return result;
 }
 
 /**
@@ -58,19 +94,61 @@ ADCS_returnState adcs_telecommand(uint8_t *command, uint32_t length) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState adcs_telemetry(uint8_t TM_ID, uint8_t *reply, uint32_t length) {
-    ADCS_returnState ack = ADCS_OK;
-#if defined(USE_UART)
-    ack = request_uart_telemetry(TM_ID, reply, length);
-#elif defined(USE_I2C)
-    ack = request_i2c_telemetry(TM_ID, reply, length);
-#endif
+    const adcs_transport *transport = adcs_active_transport();
 
-    return ack;
+    if (transport == NULL || transport->request_telemetry == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    return transport->request_telemetry(TM_ID, reply, length);
 }
 
-// To Do: We should put these functions into a new file so we can use them in
-// test, too. A lot of bitwise operations in this file can be replaced with this
-// function (probably with a better name!).
+/**
+ * @brief
+ *      Request a telemetry frame and decode it through its field table
+ * @param reply
+ *      room for the length byte frame
+ * @param fields
+ *      the field table of the frame, generated into adcs_frames.c
+ * @param out
+ *      the struct the table describes, left untouched if the request fails
+ * @return
+ * 		Success of function defined in adcs_types.h
+ */
+static ADCS_returnState adcs_telemetry_fields(uint8_t TM_ID, uint8_t *reply, uint32_t length,
+                                              const adcs_field *fields, uint32_t count, void *out) {
+    ADCS_returnState state = adcs_telemetry(TM_ID, reply, length);
+
+    if (state == ADCS_OK) {
+        state = adcs_fields_decode(fields, count, reply, length, out);
+    }
+    return state;
+}
+
+/**
+ * @brief
+ *      Pack a struct into a telecommand frame through its field table and send it
+ * @param command
+ *      room for the ID and length - 1 parameter bytes
+ * @param fields
+ *      the field table of the frame, generated into adcs_frames.c
+ * @param in
+ *      the struct the table describes
+ * @return
+ * 		Success of function defined in adcs_types.h
+ */
+static ADCS_returnState adcs_telecommand_fields(uint8_t TC_ID, uint8_t *command, uint32_t length,
+                                                const adcs_field *fields, uint32_t count, const void *in) {
+    memset(command, 0, length);
+    command[0] = TC_ID;
+    ADCS_returnState state = adcs_fields_encode(fields, count, in, &command[1], length - 1);
+
+    if (state == ADCS_OK) {
+        state = adcs_telecommand(command, length);
+    }
+    return state;
+}
+
+// Kept for existing callers: frames are read through adcs_cursor.h
 /**
  * @brief
  * 		append two bytes of a int16_t
@@ -80,12 +158,9 @@ ADCS_returnState adcs_telemetry(uint8_t TM_ID, uint8_t *reply, uint32_t length)
  * 		the appended int16_t
  */
 int16_t uint82int16(uint8_t b1, uint8_t b2) {
-    int16_t b;
-    if (b2 >> 7) { // negative
-        b = -1 * ((~((b2 << 8) | b1)) + 1);
-    } else
-        b = (b2 << 8) | b1; // positive
-    return b;
+    const uint8_t bytes[2] = {b1, b2};
+    adcs_reader tm = adcs_reader_init(bytes, sizeof(bytes));
+    return adcs_get_i16(&tm);
 }
 
 /**
@@ -97,12 +172,8 @@ int16_t uint82int16(uint8_t b1, uint8_t b2) {
  * 		the appended int32_t
  */
 int32_t uint82int32(uint8_t *address) {
-    int32_t b;
-    if (*(address + 3) >> 7) { // negative
-        b = -1 * ((~((*(address + 3) << 24) | (*(address + 2) << 16) | (*(address + 1) << 8) | *address)) + 1);
-    } else
-        b = (*(address + 3) << 24) | (*(address + 2) << 16) | (*(address + 1) << 8) | *address; // positive
-    return b;
+    adcs_reader tm = adcs_reader_init(address, 4);
+    return adcs_get_i32(&tm);
 }
 
 /**
@@ -114,9 +185,9 @@ int32_t uint82int32(uint8_t *address) {
  * 		the appended float
  */
 uint16_t uint82uint16(uint8_t b1, uint8_t b2) {
-    uint16_t b;
-    b = (b2 << 8) | b1;
-    return b;
+    const uint8_t bytes[2] = {b1, b2};
+    adcs_reader tm = adcs_reader_init(bytes, sizeof(bytes));
+    return adcs_get_u16(&tm);
 }
 
 /**
@@ -133,9 +204,10 @@ uint16_t uint82uint16(uint8_t b1, uint8_t b2) {
  * 		formatted value = rawval * coef;
  */
 void get_xyz(xyz *measurement, uint8_t *address, float coef) {
-    measurement->x = coef * uint82int16(*address, *(address + 1));
-    measurement->y = coef * uint82int16(*(address + 2), *(address + 3));
-    measurement->z = coef * uint82int16(*(address + 4), *(address + 5));
+    adcs_reader tm = adcs_reader_init(address, 6);
+    measurement->x = coef * adcs_get_i16(&tm);
+    measurement->y = coef * adcs_get_i16(&tm);
+    measurement->z = coef * adcs_get_i16(&tm);
 }
 
 /**
@@ -149,9 +221,10 @@ void get_xyz(xyz *measurement, uint8_t *address, float coef) {
  * 		the position in the telemetry frame where the data is located
  */
 void get_xyz16(xyz16 *measurement, uint8_t *address) {
-    measurement->x = uint82int16(*address, *(address + 1));
-    measurement->y = uint82int16(*(address + 2), *(address + 3));
-    measurement->z = uint82int16(*(address + 4), *(address + 5));
+    adcs_reader tm = adcs_reader_init(address, 6);
+    measurement->x = adcs_get_i16(&tm);
+    measurement->y = adcs_get_i16(&tm);
+    measurement->z = adcs_get_i16(&tm);
 }
 
 /**
@@ -168,12 +241,11 @@ void get_xyz16(xyz16 *measurement, uint8_t *address) {
  * 		formatted value = rawval * coef;
  */
 void get_3x3(float *matrix, uint8_t *address, float coef) {
-    for (int i = 0; i < 3; i++) {
-        matrix[4 * i] = coef * uint82int16(*(address + 2 * i), *(address + 2 * i + 1));
-    }
-    for (int i = 0; i < 3; i++) {
-        matrix[1 + i] = coef * uint82int16(*(address + 2 * (i + 3)), *(address + 2 * (i + 1) + 1));
-        matrix[5 + i] = coef * uint82int16(*(address + 2 * (i + 6)), *(address + 2 * (i + 5) + 1));
+    // The diagonal first, then the other elements in row order
+    static const uint8_t order[9] = {0, 4, 8, 1, 2, 3, 5, 6, 7};
+    adcs_reader tm = adcs_reader_init(address, 18);
+    for (int i = 0; i < 9; i++) {
+        matrix[order[i]] = coef * adcs_get_i16(&tm);
     }
 }
 
@@ -236,7 +308,11 @@ ADCS_returnState ADCS_format_sd_card(void) {
     uint8_t command[2];
     command[0] = FORMAT_SD_CARD_ID;
     command[1] = ADCS_MAGIC_NUMBER; // magic number 0x5A
-    return adcs_telecommand(command, 2);
+    ADCS_returnState state = adcs_telecommand(command, 2);
+    if (state == ADCS_OK) {
+        adcs_file_index_forget(0, 0, true);
+    }
+    return state;
 }
 
 /**
@@ -260,7 +336,11 @@ ADCS_returnState ADCS_erase_file(uint8_t file_type, uint8_t file_counter, bool e
     command[1] = file_type;
     command[2] = file_counter;
     command[3] = erase_all;
-    return adcs_telecommand(command, 4);
+    ADCS_returnState state = adcs_telecommand(command, 4);
+    if (state == ADCS_OK) {
+        adcs_file_index_forget(file_type, file_counter, erase_all);
+    }
+    return state;
 }
 
 /**
@@ -280,18 +360,18 @@ ADCS_returnState ADCS_erase_file(uint8_t file_type, uint8_t file_counter, bool e
  */
 ADCS_returnState ADCS_load_file_download_block(uint8_t file_type, uint8_t counter, uint32_t offset,
                                                uint16_t block_length) {
-    uint8_t command[9];
+    uint8_t command[LOAD_FILE_DOWNLOAD_BLOCK_LEN + 1];
     command[0] = LOAD_FILE_DOWNLOAD_BLOCK_ID;
-    command[1] = file_type;
-    command[2] = counter;
-    command[3] = offset & 0x000000FF;
-    command[4] = (offset >> 8) & 0x000000FF;
-    command[5] = (offset >> 16) & 0x000000FF;
-    command[6] = (offset >> 24) & 0x000000FF;
-    command[7] = block_length & 0x00FF;
-    command[8] = (block_length >> 8) & 0x00FF;
-
-    return adcs_telecommand(command, 9);
+    adcs_writer tc = adcs_writer_init(&command[1], LOAD_FILE_DOWNLOAD_BLOCK_LEN);
+    adcs_put_u8(&tc, file_type);
+    adcs_put_u8(&tc, counter);
+    adcs_put_u32(&tc, offset);
+    adcs_put_u16(&tc, block_length);
+
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -336,14 +416,55 @@ ADCS_returnState ADCS_initiate_file_upload(uint8_t file_dest, uint8_t block_size
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_file_upload_packet(uint16_t packet_number, char *file_bytes) {
-    uint8_t command[23];
+    uint8_t command[FILE_UPLOAD_PACKET_LEN + 1];
     command[0] = FILE_UPLOAD_PACKET_ID;
-    command[1] = packet_number & 0xFF;
-    command[2] = packet_number >> 8;
-    memcpy(&command[3], file_bytes, 20);
+    adcs_writer tc = adcs_writer_init(&command[1], FILE_UPLOAD_PACKET_LEN);
+    adcs_put_u16(&tc, packet_number);
+    adcs_put_bytes(&tc, (const uint8_t *)file_bytes, ADCS_DL_PACKET_LEN);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return adcs_telecommand(command, sizeof(command));
 }
 
+/**
+ * @brief
+ * 		Sends several File Upload Packets without waiting on each acknowledge in turn
+ * @details
+ * 		Lost or rejected packets are not retried here, they show in the upload hole map
+ * 		(ADCS_get_hole_map).
+ * @param block
+ * 		Upload block, packet n is the 20 bytes at n * ADCS_DL_PACKET_LEN
+ * @param packet_numbers
+ * 		Packets to send
+ * @return
+ * 		Success of function defined in adcs_types.h
+ */
+ADCS_returnState ADCS_file_upload_packets(const uint8_t *block, const uint16_t *packet_numbers, uint32_t count) {
+    uint8_t commands[ADCS_TC_WINDOW][3 + ADCS_DL_PACKET_LEN];
+    ADCS_returnState result = ADCS_OK;
+
+    while (count > 0) {
+        uint32_t n = (count < ADCS_TC_WINDOW) ? count : ADCS_TC_WINDOW;
+        for (uint32_t i = 0; i < n; i++) {
+            commands[i][0] = FILE_UPLOAD_PACKET_ID;
+            adcs_writer tc = adcs_writer_init(&commands[i][1], FILE_UPLOAD_PACKET_LEN);
+            adcs_put_u16(&tc, packet_numbers[i]);
+            adcs_put_bytes(&tc, &block[packet_numbers[i] * ADCS_DL_PACKET_LEN], ADCS_DL_PACKET_LEN);
+            if (tc.overrun) {
+                return ADCS_INCORRECT_LENGTH;
+            }
+        }
+        ADCS_returnState state = adcs_telecommands(&commands[0][0], sizeof(commands[0]), n);
+        if (result == ADCS_OK) {
+            result = state;
+        }
+        packet_numbers += n;
+        count -= n;
+    }
+    return result;
+}
+
 /**
  * @brief
  * 		Finalizes Uploaded File Block
@@ -357,13 +478,16 @@ ADCS_returnState ADCS_file_upload_packet(uint16_t packet_number, char *file_byte
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_finalize_upload_block(uint8_t file_dest, uint32_t offset, uint16_t block_length) {
-    uint8_t command[8];
+    uint8_t command[FINALIZE_UPLOAD_BLOCK_LEN + 1];
     command[0] = FINALIZE_UPLOAD_BLOCK_ID;
-    command[1] = file_dest;
-    memcpy(&command[2], &offset, 4);
-    command[6] = block_length & 0xFF;
-    command[7] = block_length >> 8;
-    return adcs_telecommand(command, 8);
+    adcs_writer tc = adcs_writer_init(&command[1], FINALIZE_UPLOAD_BLOCK_LEN);
+    adcs_put_u8(&tc, file_dest);
+    adcs_put_u32(&tc, offset);
+    adcs_put_u16(&tc, block_length);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -396,9 +520,14 @@ ADCS_returnState ADCS_reset_file_list_read_pointer(void) {
  * @param ignore_hole_map
  * 		Ignore Hole Map
  * @return
- * 		Success of function defined in adcs_types.h
+ * 		Success of function defined in adcs_types.h. ADCS_INVALID_PARAMETERS, without sending
+ * 		anything, if the active transport cannot receive a burst: the ADCS only streams it over UART.
  */
 ADCS_returnState ADCS_initiate_download_burst(uint8_t msg_length, bool ignore_hole_map) {
+    const adcs_transport *transport = adcs_active_transport();
+    if (transport == NULL || transport->receive_packet == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
     uint8_t command[3];
     command[0] = INITIATE_DOWNLOAD_BURST_ID;
     command[1] = msg_length;
@@ -406,15 +535,57 @@ ADCS_returnState ADCS_initiate_download_burst(uint8_t msg_length, bool ignore_ho
     return adcs_telecommand(command, 3);
 }
 
-void ADCS_receive_download_burst(uint8_t *hole_map, uint8_t *image_bytes, uint16_t length_bytes) {
-#if defined(USE_UART)
-    for(int i = 0; i < length_bytes/20; i++) {
-        receive_uart_packet(hole_map, image_bytes);
+/**
+ * @brief
+ * 		Number of packets of a download block not yet marked in the hole map
+ */
+static uint32_t hole_map_missing(const uint8_t *hole_map, uint32_t packets) {
+    uint32_t missing = 0;
+    for (uint32_t i = 0; i < packets; i++) {
+        missing += !((hole_map[i / 8] >> (i % 8)) & 1);
     }
-#elif defined(USE_I2C)
-    //TODO: write receive function for I2C
-#endif
+    return missing;
+}
 
+/**
+ * @brief
+ * 		Receive the packets of a download burst started with ADCS_initiate_download_burst
+ * @details
+ * 		Packets may arrive in any order and some may be lost: each is written straight to its
+ * 		place in image_bytes and marked in hole_map. Reception ends once every packet is in,
+ * 		or when the burst goes quiet; the hole map then says what to request again with
+ * 		ADCS_set_hole_map and another burst.
+ * @param hole_map
+ * 		ADCS_HOLE_MAP_LEN byte map, bit n of byte n / 8 is set once packet n has arrived.
+ * 		Clear it before the first burst of a block.
+ * @param image_bytes
+ * 		Buffer for the download block
+ * @param length_bytes
+ * 		Size of the download block, at most ADCS_DL_BLOCK_LEN
+ * @return
+ * 		ADCS_OK once the block is complete, ADCS_UART_FAILED if the burst ended with holes.
+ * 		ADCS_INVALID_PARAMETERS if the active transport cannot receive a burst (I2C).
+ */
+ADCS_returnState ADCS_receive_download_burst(uint8_t *hole_map, uint8_t *image_bytes, uint16_t length_bytes) {
+    const adcs_transport *transport = adcs_active_transport();
+    uint32_t packets = (length_bytes + ADCS_DL_PACKET_LEN - 1) / ADCS_DL_PACKET_LEN;
+
+    if (transport == NULL || transport->receive_packet == NULL || length_bytes > ADCS_DL_BLOCK_LEN) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    // Counted once, then each packet that fills a hole counts it down
+    uint32_t missing = hole_map_missing(hole_map, packets);
+    while (missing > 0) {
+        bool added;
+        ADCS_returnState state = transport->receive_packet(hole_map, image_bytes, length_bytes, &added);
+        if (state == ADCS_UART_FAILED) {
+            return state;
+        }
+        if (state == ADCS_OK && added) {
+            missing--;
+        }
+    }
+    return ADCS_OK;
 }
 
 /*************************** Common TMs ***************************/
@@ -430,15 +601,19 @@ void ADCS_receive_download_burst(uint8_t *hole_map, uint8_t *image_bytes, uint16
  */
 ADCS_returnState ADCS_get_node_identification(uint8_t *node_type, uint8_t *interface_ver, uint8_t *major_firm_ver,
                                               uint8_t *minor_firm_ver, uint16_t *runtime_s, uint16_t *runtime_ms) {
-    uint8_t telemetry[8];
+    uint8_t telemetry[NODE_IDENTIFICATION_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(NODE_IDENTIFICATION_ID, telemetry, 8);
-    *node_type = telemetry[0];
-    *interface_ver = telemetry[1];
-    *major_firm_ver = telemetry[2];
-    *minor_firm_ver = telemetry[3];
-    *runtime_s = (telemetry[5] << 8) | telemetry[4];  // [s]
-    *runtime_ms = (telemetry[7] << 8) | telemetry[6]; // [ms]
+    state = adcs_telemetry(NODE_IDENTIFICATION_ID, telemetry, NODE_IDENTIFICATION_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *node_type = adcs_get_u8(&tm);
+    *interface_ver = adcs_get_u8(&tm);
+    *major_firm_ver = adcs_get_u8(&tm);
+    *minor_firm_ver = adcs_get_u8(&tm);
+    *runtime_s = adcs_get_u16(&tm);  // [s]
+    *runtime_ms = adcs_get_u16(&tm); // [ms]
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -463,15 +638,19 @@ ADCS_returnState ADCS_get_boot_program_stat(uint8_t* mcu_reset_cause,
                                             uint8_t* boot_idx,
                                             uint8_t* major_firm_ver,
                                             uint8_t* minor_firm_ver) {
-  uint8_t telemetry[6];
+  uint8_t telemetry[BOOT_RUNNING_STAT_LEN];
   ADCS_returnState state;
-  state = adcs_telemetry(BOOT_RUNNING_STAT, telemetry, 6);
-  *mcu_reset_cause = telemetry[0] & 0xF;
-  *boot_cause = (telemetry[0] >> 4) & 0xF;
-  *boot_count = telemetry[2] << 8 | telemetry[1];
-  *boot_idx = telemetry[3];
-  *major_firm_ver = telemetry[4];
-  *minor_firm_ver = telemetry[5];
+  state = adcs_telemetry(BOOT_RUNNING_STAT, telemetry, BOOT_RUNNING_STAT_LEN);
+  adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+  *mcu_reset_cause = adcs_get_bits(&tm, 4);
+  *boot_cause = adcs_get_bits(&tm, 4);
+  *boot_count = adcs_get_u16(&tm);
+  *boot_idx = adcs_get_u8(&tm);
+  *major_firm_ver = adcs_get_u8(&tm);
+  *minor_firm_ver = adcs_get_u8(&tm);
+  if (tm.overrun) {
+      return ADCS_INCORRECT_LENGTH;
+  }
   return state;
 }
 
@@ -487,11 +666,15 @@ ADCS_returnState ADCS_get_boot_program_stat(uint8_t* mcu_reset_cause,
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_boot_index(uint8_t *program_idx, uint8_t *boot_stat) {
-    uint8_t telemetry[2];
+    uint8_t telemetry[BOOT_IDX_STAT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(BOOT_IDX_STAT, telemetry, 2);
-    *program_idx = telemetry[0];
-    *boot_stat = telemetry[1];
+    state = adcs_telemetry(BOOT_IDX_STAT, telemetry, BOOT_IDX_STAT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *program_idx = adcs_get_u8(&tm);
+    *boot_stat = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -503,12 +686,16 @@ ADCS_returnState ADCS_get_boot_index(uint8_t *program_idx, uint8_t *boot_stat) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_last_logged_event(uint32_t *time, uint8_t *event_id, uint8_t *event_param) {
-    uint8_t telemetry[6];
+    uint8_t telemetry[LAST_LOGGED_EVENT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(LAST_LOGGED_EVENT_ID, telemetry, 6);
-    *time = (telemetry[3] << 24) | (telemetry[2] << 16) | (telemetry[1] << 8) | telemetry[0];
-    *event_id = telemetry[4];
-    *event_param = telemetry[5];
+    state = adcs_telemetry(LAST_LOGGED_EVENT_ID, telemetry, LAST_LOGGED_EVENT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *time = adcs_get_u32(&tm);
+    *event_id = adcs_get_u8(&tm);
+    *event_param = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -519,11 +706,15 @@ ADCS_returnState ADCS_get_last_logged_event(uint32_t *time, uint8_t *event_id, u
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_SD_format_progress(bool *format_busy, bool *erase_all_busy) {
-    uint8_t telemetry[1];
+    uint8_t telemetry[SD_FORMAT_PROGRESS_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(SD_FORMAT_PROGRESS, telemetry, 1);
-    *format_busy = telemetry[0] & 0x1;
-    *erase_all_busy = telemetry[0] & 0x2;
+    state = adcs_telemetry(SD_FORMAT_PROGRESS, telemetry, SD_FORMAT_PROGRESS_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *format_busy = adcs_get_flag(&tm);
+    *erase_all_busy = adcs_get_flag(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -538,13 +729,17 @@ ADCS_returnState ADCS_get_SD_format_progress(bool *format_busy, bool *erase_all_
  */
 ADCS_returnState ADCS_get_TC_ack(uint8_t *last_tc_id, bool *tc_processed, ADCS_returnState *tc_err_stat,
                                  uint8_t *tc_err_idx) {
-    uint8_t telemetry[4];
+    uint8_t telemetry[LAST_TC_ACK_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(LAST_TC_ACK_ID, telemetry, 4);
-    *last_tc_id = telemetry[0];
-    *tc_processed = telemetry[1] & 1;
-    *tc_err_stat = (ADCS_returnState) telemetry[2];
-    *tc_err_idx = telemetry[3];
+    state = adcs_telemetry(LAST_TC_ACK_ID, telemetry, LAST_TC_ACK_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *last_tc_id = adcs_get_u8(&tm);
+    *tc_processed = adcs_get_flag(&tm);
+    *tc_err_stat = (ADCS_returnState)adcs_get_u8(&tm);
+    *tc_err_idx = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -557,11 +752,15 @@ ADCS_returnState ADCS_get_TC_ack(uint8_t *last_tc_id, bool *tc_processed, ADCS_r
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_file_download_buffer(uint16_t *packet_count, uint8_t file[20]) {
-    uint8_t telemetry[22];
+    uint8_t telemetry[FILE_DL_BUFFER_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(FILE_DL_BUFFER_ID, telemetry, 22);
-    *packet_count = (telemetry[1] << 8) | telemetry[0];
-    memcpy(&(*file), &telemetry[2], 20);
+    state = adcs_telemetry(FILE_DL_BUFFER_ID, telemetry, FILE_DL_BUFFER_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *packet_count = adcs_get_u16(&tm);
+    adcs_get_bytes(&tm, file, 20);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -578,13 +777,17 @@ ADCS_returnState ADCS_get_file_download_buffer(uint16_t *packet_count, uint8_t f
 ADCS_returnState ADCS_get_file_download_block_stat(bool *ready, bool *param_err,
                                                    uint16_t *crc16_checksum,
                                                    uint16_t *length) {
-    uint8_t telemetry[5];
+    uint8_t telemetry[DL_BLOCK_STAT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(DL_BLOCK_STAT_ID, telemetry, 5);
-    *ready = telemetry[0] & 0x1;
-    *param_err = telemetry[0] & 0x2;
-    *crc16_checksum = (telemetry[2] << 8) | telemetry[1];
-    *length = (telemetry[4] << 8) | telemetry[3];
+    state = adcs_telemetry(DL_BLOCK_STAT_ID, telemetry, DL_BLOCK_STAT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *ready = adcs_get_flag(&tm);
+    *param_err = adcs_get_flag(&tm);
+    *crc16_checksum = adcs_get_u16(&tm);
+    *length = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -600,15 +803,19 @@ ADCS_returnState ADCS_get_file_download_block_stat(bool *ready, bool *param_err,
  */
 ADCS_returnState ADCS_get_file_info(uint8_t *type, bool *updating, uint8_t *counter, uint32_t *size,
                                     uint32_t *time, uint16_t *crc16_checksum) {
-    uint8_t telemetry[12];
+    uint8_t telemetry[FILE_INFO_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(FILE_INFO_ID, telemetry, 12);
-    *type = telemetry[0] & 0xF;
-    *updating = (telemetry[0] >> 4) & 1;
-    *counter = telemetry[1];
-    *size = (telemetry[5] << 24) | (telemetry[4] << 16) | (telemetry[3] << 8) | telemetry[2];
-    *time = (telemetry[9] << 24) | (telemetry[8] << 16) | (telemetry[7] << 8) | telemetry[6];
-    *crc16_checksum = (telemetry[11] << 8) | telemetry[10];
+    state = adcs_telemetry(FILE_INFO_ID, telemetry, FILE_INFO_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *type = adcs_get_bits(&tm, 4);
+    *updating = adcs_get_flag(&tm);
+    *counter = adcs_get_u8(&tm);
+    *size = adcs_get_u32(&tm);
+    *time = adcs_get_u32(&tm);
+    *crc16_checksum = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -619,10 +826,14 @@ ADCS_returnState ADCS_get_file_info(uint8_t *type, bool *updating, uint8_t *coun
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_init_upload_stat(bool *busy) {
-    uint8_t telemetry[1];
+    uint8_t telemetry[INIT_UPLOAD_STAT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(INIT_UPLOAD_STAT_ID, telemetry, 1);
-    *busy = telemetry[0] & 1;
+    state = adcs_telemetry(INIT_UPLOAD_STAT_ID, telemetry, INIT_UPLOAD_STAT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *busy = adcs_get_flag(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -633,11 +844,15 @@ ADCS_returnState ADCS_get_init_upload_stat(bool *busy) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_finalize_upload_stat(bool *busy, bool *err) {
-    uint8_t telemetry[1];
+    uint8_t telemetry[FINIALIZE_UPLOAD_STAT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(FINIALIZE_UPLOAD_STAT_ID, telemetry, 1);
-    *busy = telemetry[0] & 0x1;
-    *busy = telemetry[0] & 0x2;
+    state = adcs_telemetry(FINIALIZE_UPLOAD_STAT_ID, telemetry, FINIALIZE_UPLOAD_STAT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *busy = adcs_get_flag(&tm);
+    *err = adcs_get_flag(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -648,10 +863,14 @@ ADCS_returnState ADCS_get_finalize_upload_stat(bool *busy, bool *err) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_upload_crc16_checksum(uint16_t *checksum) {
-    uint8_t telemetry[2];
+    uint8_t telemetry[UPLOAD_CRC16_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(UPLOAD_CRC16_ID, telemetry, 2);
-    *checksum = (telemetry[1] << 8) | telemetry[0];
+    state = adcs_telemetry(UPLOAD_CRC16_ID, telemetry, UPLOAD_CRC16_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *checksum = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -664,11 +883,15 @@ ADCS_returnState ADCS_get_upload_crc16_checksum(uint16_t *checksum) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_SRAM_latchup_count(uint16_t *sram1, uint16_t *sram2) {
-    uint8_t telemetry[6];
+    uint8_t telemetry[SRAM_LATCHUP_COUNT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(SRAM_LATCHUP_COUNT_ID, telemetry, 6);
-    *sram1 = (telemetry[1] << 8) | telemetry[0];
-    *sram2 = (telemetry[3] << 8) | telemetry[2];
+    state = adcs_telemetry(SRAM_LATCHUP_COUNT_ID, telemetry, SRAM_LATCHUP_COUNT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *sram1 = adcs_get_u16(&tm);
+    *sram2 = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -681,12 +904,16 @@ ADCS_returnState ADCS_get_SRAM_latchup_count(uint16_t *sram1, uint16_t *sram2) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_EDAC_err_count(uint16_t *single_sram, uint16_t *double_sram, uint16_t *multi_sram) {
-    uint8_t telemetry[6];
+    uint8_t telemetry[EDAC_ERR_COUNT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(EDAC_ERR_COUNT_ID, telemetry, 6);
-    *single_sram = (telemetry[1] << 8) | telemetry[0];
-    *double_sram = (telemetry[3] << 8) | telemetry[2];
-    *multi_sram = (telemetry[5] << 8) | telemetry[4];
+    state = adcs_telemetry(EDAC_ERR_COUNT_ID, telemetry, EDAC_ERR_COUNT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *single_sram = adcs_get_u16(&tm);
+    *double_sram = adcs_get_u16(&tm);
+    *multi_sram = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -694,26 +921,46 @@ ADCS_returnState ADCS_get_EDAC_err_count(uint16_t *single_sram, uint16_t *double
  * @brief
  * 		Gets the communication status - includes TC and TM counters and
  * error. flags
- * @param flags_arr
- * 		An array of flags. Refer to table 37
+ * @param flags
+ * 		Error flags, named by adcs_comms_flag. Refer to table 37
  * @attention
  * 		The size of TM is more than requested data
  * @return
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_comms_stat(uint16_t *TC_num, uint16_t *TM_num,
-                                     uint8_t *flags_arr) {
+                                     adcs_comms_flags *flags) {
     ADCS_returnState state;
-    uint8_t telemetry[6];
-    state = adcs_telemetry(COMMS_STAT_ID, telemetry, 6);
-    *TC_num = (telemetry[1] << 8) | telemetry[0];
-    *TM_num = (telemetry[3] << 8) | telemetry[2];
-    for (int i = 0; i < 6; i++) {
-        *(flags_arr + i) = (telemetry[4] >> i) & 1;
+    uint8_t telemetry[COMMS_STAT_LEN];
+    state = adcs_telemetry(COMMS_STAT_ID, telemetry, COMMS_STAT_LEN);
+    if (adcs_decode_comms_stat(telemetry, sizeof(telemetry), TC_num, TM_num, flags) != ADCS_OK) {
+        return ADCS_INCORRECT_LENGTH;
     }
     return state;
 }
 
+/**
+ * @brief
+ * 		Decodes a Communication Status frame, shared by ADCS_get_comms_stat and the
+ * I2C read check in adcs_io.c so the table 37 layout is spelled out once
+ * @param telemetry
+ * 		the frame, without the ID
+ * @param length
+ * 		length of the frame
+ * @param flags
+ * 		Error flags, named by adcs_comms_flag
+ * @return
+ * 		ADCS_INCORRECT_LENGTH if the frame is short, otherwise ADCS_OK
+ */
+ADCS_returnState adcs_decode_comms_stat(const uint8_t *telemetry, uint32_t length, uint16_t *TC_num,
+                                        uint16_t *TM_num, adcs_comms_flags *flags) {
+    adcs_reader tm = adcs_reader_init(telemetry, length);
+    *TC_num = adcs_get_u16(&tm);
+    *TM_num = adcs_get_u16(&tm);
+    adcs_get_bitset(&tm, flags->word, 0, ADCS_COMMS_FLAG_COUNT);
+    return tm.overrun ? ADCS_INCORRECT_LENGTH : ADCS_OK;
+}
+
 /************************* Common Config Msgs *************************/
 /**
  * @brief
@@ -735,10 +982,14 @@ ADCS_returnState ADCS_set_cache_en_state(bool en_state) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_sram_scrub_size(uint16_t size) {
-    uint8_t command[3];
+    uint8_t command[SET_SRAM_SCRUB_PARAM_LEN + 1];
     command[0] = SET_SRAM_SCRUB_PARAM_ID;
-    memcpy(&command[1], &size, 2);
-    return adcs_telecommand(command, 3);
+    adcs_writer tc = adcs_writer_init(&command[1], SET_SRAM_SCRUB_PARAM_LEN);
+    adcs_put_u16(&tc, size);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -790,16 +1041,16 @@ ADCS_returnState ADCS_set_hole_map(uint8_t *hole_map, uint8_t num) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_unix_t(uint32_t unix_t, uint16_t count_ms) {
-    uint8_t command[7] = {0};
-    //switch the endianness of the two input variables
-    uint32_t unix_t_le = ((unix_t << 24) & 0xFF000000) | ((unix_t << 8) & 0x00FF0000) | ((unix_t >> 8) & 0x0000FF00) | ((unix_t >> 24) & 0x000000FF);
-    uint16_t count_ms_le = ((count_ms << 8) & 0xFF00) | ((count_ms >> 8) & 0x00FF);
+    uint8_t command[SET_CURRENT_UNIX_TIME_LEN + 1] = {0};
     command[0] = SET_CURRENT_UNIX_TIME;
+    adcs_writer tc = adcs_writer_init(&command[1], SET_CURRENT_UNIX_TIME_LEN);
+    adcs_put_u32(&tc, unix_t);
+    adcs_put_u16(&tc, count_ms); // [ms]
 
-    memcpy(&command[1], &unix_t_le, 4);
-    memcpy(&command[5], &count_ms_le, 2); // [ms]
-
-    return adcs_telecommand(command, 7);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -809,10 +1060,14 @@ ADCS_returnState ADCS_set_unix_t(uint32_t unix_t, uint16_t count_ms) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_cache_en_state(bool *en_state) {
-    uint8_t telemetry[1];
+    uint8_t telemetry[GET_CACHE_EN_STATE_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(GET_CACHE_EN_STATE_ID, telemetry, 1);
-    *en_state = telemetry[0] & 1;
+    state = adcs_telemetry(GET_CACHE_EN_STATE_ID, telemetry, GET_CACHE_EN_STATE_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *en_state = adcs_get_flag(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -823,10 +1078,14 @@ ADCS_returnState ADCS_get_cache_en_state(bool *en_state) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_sram_scrub_size(uint16_t *size) {
-    uint8_t telemetry[2];
+    uint8_t telemetry[GET_SRAM_SCRUB_PARAM_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(GET_SRAM_SCRUB_PARAM_ID, telemetry, 2);
-    *size = (telemetry[1] >> 8) | telemetry[0];
+    state = adcs_telemetry(GET_SRAM_SCRUB_PARAM_ID, telemetry, GET_SRAM_SCRUB_PARAM_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *size = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -846,11 +1105,15 @@ ADCS_returnState ADCS_get_sram_scrub_size(uint16_t *size) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_UnixTime_save_config(uint8_t *when, uint8_t *period) {
-    uint8_t telemetry[2];
+    uint8_t telemetry[GET_UNIX_TIME_SAVE_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(GET_UNIX_TIME_SAVE_ID, telemetry, 2);
-    *when = telemetry[0];
-    *period = telemetry[1];
+    state = adcs_telemetry(GET_UNIX_TIME_SAVE_ID, telemetry, GET_UNIX_TIME_SAVE_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *when = adcs_get_u8(&tm);
+    *period = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -865,11 +1128,15 @@ ADCS_returnState ADCS_get_UnixTime_save_config(uint8_t *when, uint8_t *period) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_hole_map(uint8_t *hole_map, uint8_t num) {
-    uint8_t telemetry[16];
+    uint8_t telemetry[GET_HOLE_MAP_LEN];
     ADCS_returnState state;
     uint8_t TM_ID = GET_HOLE_MAP_ID + num;
-    state = adcs_telemetry(TM_ID, telemetry, 16);
-    memcpy(&hole_map, &telemetry[0], 16);
+    state = adcs_telemetry(TM_ID, telemetry, GET_HOLE_MAP_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    adcs_get_bytes(&tm, hole_map, GET_HOLE_MAP_LEN);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -905,11 +1172,15 @@ ADCS_returnState ADCS_get_hole_map(uint8_t *hole_map, uint8_t num) {
 
 ADCS_returnState ADCS_get_unix_t(uint32_t *unix_t, uint16_t *count_ms) {
     ADCS_returnState state;
-    uint8_t telemetry[6];
-    state = adcs_telemetry(GET_CURRENT_UNIX_TIME, telemetry, 6);
-    *unix_t = (telemetry[3] << 24) | (telemetry[2] << 16) | (telemetry[1] << 8) | telemetry[0];
-    *count_ms = (telemetry[5] << 8) | telemetry[4];
-
+    uint8_t telemetry[GET_CURRENT_UNIX_TIME_LEN];
+    state = adcs_telemetry(GET_CURRENT_UNIX_TIME, telemetry, GET_CURRENT_UNIX_TIME_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *unix_t = adcs_get_u32(&tm);
+    *count_ms = adcs_get_u16(&tm);
+
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -1010,24 +1281,20 @@ ADCS_returnState ADCS_copy_program_internal_flash(uint8_t index, uint8_t overwri
  * @brief
  * 		Gets the BootLoader state.
  * @param uptime
- * @param flags_arr
- * 		11 boolean flags from Table 69
- * 		sram1, sram2, sram_latch_not_recovered, sram_latch_recovered,
- * 		sd_initial_err, sd_read_err, sd_write_err, external_flash_err,
- * 		internal_flash_err, eeprom_err, bad_boot_reg, comms_radio_err
+ * @param flags
+ * 		16 flags from Table 69, named by adcs_boot_flag
  * @return
  * 		Success of function defined in adcs_types.h
  */
-ADCS_returnState ADCS_get_bootloader_state(uint16_t *uptime, uint8_t *flags_arr) {
-    uint8_t telemetry[6] = {0};
+ADCS_returnState ADCS_get_bootloader_state(uint16_t *uptime, adcs_boot_flags *flags) {
+    uint8_t telemetry[GET_BOOTLOADER_STATE_LEN] = {0};
     ADCS_returnState state;
-    state = adcs_telemetry(GET_BOOTLOADER_STATE_ID, telemetry, 6);
-    *uptime = (telemetry[1] << 8) + telemetry[0];
-
-    for(int k = 0; k < 2; k++){
-        for (int i = 0; i < 8; i++) {
-            *(flags_arr + k*8 + i) = (telemetry[2+k] >> i) & 1;
-        }
+    state = adcs_telemetry(GET_BOOTLOADER_STATE_ID, telemetry, GET_BOOTLOADER_STATE_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *uptime = adcs_get_u16(&tm);
+    adcs_get_bitset(&tm, flags->word, 0, ADCS_BOOT_FLAG_COUNT);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
     }
     return state;
 }
@@ -1046,13 +1313,17 @@ ADCS_returnState ADCS_get_bootloader_state(uint16_t *uptime, uint8_t *flags_arr)
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_program_info(uint8_t *index, bool *busy, uint32_t *file_size, uint16_t *crc16_checksum) {
-    uint8_t telemetry[8];
+    uint8_t telemetry[GET_PROGRAM_INFO_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(GET_PROGRAM_INFO_ID, telemetry, 8);
-    *index = telemetry[0];
-    *busy = telemetry[1] & 1;
-    *file_size = (telemetry[5] << 24) + (telemetry[4] << 16) + (telemetry[3] << 8) + telemetry[2];
-    *crc16_checksum = (telemetry[7] << 8) + telemetry[6];
+    state = adcs_telemetry(GET_PROGRAM_INFO_ID, telemetry, GET_PROGRAM_INFO_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *index = adcs_get_u8(&tm);
+    *busy = adcs_get_flag(&tm);
+    *file_size = adcs_get_u32(&tm);
+    *crc16_checksum = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -1067,11 +1338,15 @@ ADCS_returnState ADCS_get_program_info(uint8_t *index, bool *busy, uint32_t *fil
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_copy_internal_flash_progress(bool *busy, bool *err) {
-    uint8_t telemetry;
+    uint8_t telemetry[COPY_INTERNAL_FLASH_PROGRESS_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(COPY_INTERNAL_FLASH_PROGRESS_ID, &telemetry, 1);
-    *busy = telemetry & 1;
-    *err = telemetry & 2;
+    state = adcs_telemetry(COPY_INTERNAL_FLASH_PROGRESS_ID, telemetry, COPY_INTERNAL_FLASH_PROGRESS_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *busy = adcs_get_flag(&tm);
+    *err = adcs_get_flag(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -1135,12 +1410,15 @@ ADCS_returnState ADCS_clear_latched_errs(bool adcs_flag, bool hk_flag) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_attitude_ctrl_mode(uint8_t ctrl_mode, uint16_t timeout) {
-    uint8_t command[4];
+    uint8_t command[SET_ATT_CONTROL_MODE_LEN + 1];
     command[0] = SET_ATT_CONTROL_MODE_ID;
-    command[1] = ctrl_mode;
-    command[2] = timeout & 0xFF;
-    command[3] = timeout >> 8;
-    return adcs_telecommand(command, 4);
+    adcs_writer tc = adcs_writer_init(&command[1], SET_ATT_CONTROL_MODE_LEN);
+    adcs_put_u8(&tc, ctrl_mode);
+    adcs_put_u16(&tc, timeout);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -1171,6 +1449,16 @@ ADCS_returnState ADCS_trigger_adcs_loop(void) {
     return adcs_telecommand(&command, 1);
 }
 
+/**
+ * @brief
+ * 		Writes the three axes of a simulated vector, x first
+ */
+static void put_xyz16(adcs_writer *tc, xyz16 value) {
+    adcs_put_i16(tc, value.x);
+    adcs_put_i16(tc, value.y);
+    adcs_put_i16(tc, value.z);
+}
+
 /**
  * @brief
  * 		Triggers the ADCS loop with simulated sensor data.
@@ -1183,14 +1471,49 @@ ADCS_returnState ADCS_trigger_adcs_loop(void) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_trigger_adcs_loop_sim(sim_sensor_data sim_data) {
-    uint8_t command[128];
+    uint8_t command[TRIGGER_ADCS_LOOP_SIM_LEN + 1];
     command[0] = TRIGGER_ADCS_LOOP_SIM_ID;
-    memcpy(&command[1], &sim_data, 121);
-    command[122] = sim_data.pos_std_dev.x * 10;
-    command[123] = sim_data.pos_std_dev.y * 10;
-    command[124] = sim_data.pos_std_dev.z * 10;
-    memcpy(&command[124], &sim_data.vel_std_dev, 3);
-    return adcs_telecommand(command, 128);
+    adcs_writer tc = adcs_writer_init(&command[1], TRIGGER_ADCS_LOOP_SIM_LEN);
+    adcs_put_u32(&tc, sim_data.unix_t);
+    for (int i = 0; i < 10; i++) {
+        adcs_put_u16(&tc, sim_data.css_raw[i]);
+    }
+    const cam_sim_sensor *cams[2] = {&sim_data.cam1, &sim_data.cam2};
+    for (int i = 0; i < 2; i++) {
+        adcs_put_u16(&tc, cams[i]->x_angle);
+        adcs_put_u16(&tc, cams[i]->y_angle);
+        adcs_put_u8(&tc, cams[i]->busy);
+        adcs_put_u8(&tc, cams[i]->result);
+    }
+    put_xyz16(&tc, sim_data.MTM);
+    adcs_put_i32(&tc, sim_data.rate.x);
+    adcs_put_i32(&tc, sim_data.rate.y);
+    adcs_put_i32(&tc, sim_data.rate.z);
+    put_xyz16(&tc, sim_data.wheel_speed);
+    put_xyz16(&tc, sim_data.star1_cam);
+    put_xyz16(&tc, sim_data.star1_inertial);
+    put_xyz16(&tc, sim_data.star2_cam);
+    put_xyz16(&tc, sim_data.star2_inertial);
+    put_xyz16(&tc, sim_data.star3_cam);
+    put_xyz16(&tc, sim_data.star3_inertial);
+    adcs_put_u8(&tc, sim_data.gps_sol_stat);
+    adcs_put_u16(&tc, sim_data.gps_week);
+    adcs_put_u32(&tc, sim_data.gps_time);
+    const ecef *axes[3] = {&sim_data.x, &sim_data.y, &sim_data.z};
+    for (int i = 0; i < 3; i++) {
+        adcs_put_i32(&tc, axes[i]->pos);
+        adcs_put_i16(&tc, axes[i]->vel);
+    }
+    adcs_put_u8(&tc, sim_data.pos_std_dev.x * 10);
+    adcs_put_u8(&tc, sim_data.pos_std_dev.y * 10);
+    adcs_put_u8(&tc, sim_data.pos_std_dev.z * 10);
+    adcs_put_u8(&tc, sim_data.vel_std_dev.x);
+    adcs_put_u8(&tc, sim_data.vel_std_dev.y);
+    adcs_put_u8(&tc, sim_data.vel_std_dev.z);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    return adcs_telecommand(command, sizeof(command));
     /* test cases:
      + command[16] >> 8 | command[15]
      + command[123]
@@ -1256,12 +1579,12 @@ ADCS_returnState ADCS_set_MTM_op_mode(uint8_t mode) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_cnv2jpg(uint8_t source, uint8_t QF, uint8_t white_balance) {
-    uint8_t command[4];
+    uint8_t command[CNV2JPG_LEN + 1];
     command[0] = CNV2JPG_ID;
     command[1] = source;
-    command[1] = QF;
-    command[1] = white_balance;
-    return adcs_telecommand(command, 4);
+    command[2] = QF;
+    command[3] = white_balance;
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -1303,15 +1626,9 @@ ADCS_returnState ADCS_save_img(uint8_t camera, uint8_t img_size) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_magnetorquer_output(xyz16 duty_cycle) {
-    uint8_t command[7];
-    command[0] = SET_MAGNETORQUER_OUTPUT_ID;
-    command[1] = (duty_cycle.x) & 0x00FF;
-    command[2] = (duty_cycle.x >> 8) & 0x00FF;
-    command[3] = (duty_cycle.y) & 0x00FF;
-    command[4] = (duty_cycle.y >> 8) & 0x00FF;
-    command[5] = (duty_cycle.z) & 0x00FF;
-    command[6] = (duty_cycle.z >> 8) & 0x00FF;
-    return adcs_telecommand(command, 7);
+    uint8_t command[1 + SET_MAGNETORQUER_OUTPUT_LEN];
+    return adcs_telecommand_fields(SET_MAGNETORQUER_OUTPUT_ID, command, sizeof(command), adcs_xyz16_fields,
+                                   ADCS_XYZ16_FIELD_COUNT, &duty_cycle);
 }
 
 /**
@@ -1326,15 +1643,9 @@ ADCS_returnState ADCS_set_magnetorquer_output(xyz16 duty_cycle) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_wheel_speed(xyz16 speed) {
-    uint8_t command[7];
-    command[0] = SET_WHEEL_SPEED_ID;
-    command[1] = (speed.x) & 0x00FF;
-    command[2] = (speed.x >> 8) & 0x00FF;
-    command[3] = (speed.y) & 0x00FF;
-    command[4] = (speed.y >> 8) & 0x00FF;
-    command[5] = (speed.z) & 0x00FF;
-    command[6] = (speed.z >> 8) & 0x00FF;
-    return adcs_telecommand(command, 7);
+    uint8_t command[1 + SET_WHEEL_SPEED_LEN];
+    return adcs_telecommand_fields(SET_WHEEL_SPEED_ID, command, sizeof(command), adcs_xyz16_fields,
+                                   ADCS_XYZ16_FIELD_COUNT, &speed);
 }
 
 /**
@@ -1371,92 +1682,31 @@ ADCS_returnState ADCS_save_orbit_params(void) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_current_state(adcs_state *data) {
-    uint8_t telemetry[54];
-    ADCS_returnState state;
-
-    state = adcs_telemetry(ADCS_STATE, telemetry, 54);
-    data->att_estimate_mode = telemetry[0] & 0xF;    // Refer to table 80
-    data->att_ctrl_mode = (telemetry[0] >> 4) & 0xF; // Refer to table 78
-    data->run_mode = telemetry[1] & 0x3;             // Refer to table 75
-    data->ASGP4_mode = (telemetry[1] >> 2) & 0x3;    // Refer to table 87
-
-    /* The next section of code parses all of the ADCS status flags out of the telemetry bytes.
-     * Table 149 in the ADCS Firmware Manual describes the format of this telemetry frame.
-     *
-     * Flags start at the 12th bit in the frame, in the middle of the second byte.
-     *
-     * Particular attention needs to be paid to the order of flags. The first flag within a byte is stored
-     * in the least significant bit.
-     *
-     * At offset 52 (52nd bit, halfway through the 7th byte) there is an enum which takes 2 bits.
-     * After this enum, at offset 54, there are 2 more bits for flags in the 7th byte.
-     *
-     * Flags end at offset 66 (2 bits into the 9th byte in the frame).
-     */
-
-    uint8_t flags_arr_offset = 0;
-    // flags_arr_offset is 12 behind frame offset
-
-    // Frame offset: 12 (Table 149)
-    for (int i = 0; i < 4; i++) {
-        *(data->flags_arr + flags_arr_offset) = (telemetry[1] >> (i + 4)) & 1;
-        flags_arr_offset++;
-    }
-
-    // Frame offset: 16 (Table 149)
-    for(int k = 0; k < 4; k++){
-        // Frame offset: 16 + 8*k (Table 149)
-
-        for (int i = 0; i < 8; i++) {
-            *(data->flags_arr + flags_arr_offset) = (telemetry[2+k] >> i) & 1;
-            flags_arr_offset++;
-        }
-
-    }
-
-    // Frame offset: 48 (Table 149)
-    for (int i = 0; i < 4; i++) {
-        *(data->flags_arr + flags_arr_offset) = (telemetry[6] >> i) & 1;
-        flags_arr_offset++;
-    }
-
-    // Frame offset: 52 (Table 149)
-    data->MTM_sample_mode = (telemetry[6] >> 4) & 0x3; // Refer to table 90
-
-    // flags_arr_offset is now 14 behind frame offset
-
-    // Frame offset: 54 (Table 149)
-    for (int i = 0; i < 2; i++) {
-        *(data->flags_arr + flags_arr_offset) = (telemetry[6] >> (i + 6)) & 1;
-        flags_arr_offset++;
-    }
-
-    // Frame offset: 56 (Table 149)
-    for (int i = 0; i < 8; i++) {
-        *(data->flags_arr + flags_arr_offset) = (telemetry[7] >> i) & 1;
-        flags_arr_offset++;
-    }
-
-    // Frame offset: 64 (Table 149)
-    for (int i = 0; i < 2; i++) {
-        *(data->flags_arr + flags_arr_offset) = (telemetry[8] >> i) & 1;
-        flags_arr_offset++;
-    }
+    uint8_t telemetry[ADCS_STATE_LEN];
+    return adcs_telemetry_fields(ADCS_STATE, telemetry, ADCS_STATE_LEN, adcs_state_fields, ADCS_STATE_FIELD_COUNT,
+                                 data);
+}
 
-    get_xyz(&data->est_angle, &telemetry[12], 0.01); // [deg]
-    get_xyz16(&data->est_quaternion, &telemetry[18]);
-    get_xyz(&data->est_angular_rate, &telemetry[24], 0.01); // [deg/s]
-    get_xyz(&data->ECI_pos, &telemetry[30], 0.25);          // [km]
-    get_xyz(&data->ECI_vel, &telemetry[36], 0.25);          // [m/s]
-    get_xyz(&data->longlatalt, &telemetry[42], 0.01);       // [deg, deg, km]
-    if (telemetry[47] >> 7) {                               // since it is uint16 and has been treated as int16
-        data->longlatalt.z = 0.01 * (telemetry[47] << 8 | telemetry[46]);
-    }
-    get_xyz16(&data->ecef_pos, &telemetry[48]); // [m]
-    return state;
+/**
+ * @brief
+ * 		Gets ADCS current full state without converting it to physical units.
+ * @param data
+ * 		The counts as sent, scaled by the ADCS_STATE_*_SCALE constants of adcs_frames.h
+ * 		Refer to table 149
+ * @return
+ * 		Success of function defined in adcs_types.h
+ */
+ADCS_returnState ADCS_get_current_state_raw(adcs_state_raw *data) {
+    uint8_t telemetry[ADCS_STATE_LEN];
+    return adcs_telemetry_fields(ADCS_STATE, telemetry, ADCS_STATE_LEN, adcs_state_raw_fields,
+                                 ADCS_STATE_RAW_FIELD_COUNT, data);
 }
 
 /************************* General **************************/
+// Last conversion status read, the result stays at success until the next conversion starts
+static bool jpg_cnv_complete;
+static uint8_t jpg_cnv_counter;
+
 /**
  * @brief
  * 		Gets JPG conversion progress.
@@ -1474,29 +1724,43 @@ ADCS_returnState ADCS_get_current_state(adcs_state *data) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_jpg_cnv_progress(uint8_t *percentage, uint8_t *result, uint8_t *file_counter) {
-    uint8_t telemetry[3];
+    uint8_t telemetry[JPG_CNV_PROGRESS_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(JPG_CNV_PROGRESS_ID, telemetry, 3);
-    *percentage = telemetry[0];
-    *result = telemetry[1];
-    *file_counter = telemetry[2];
+    state = adcs_telemetry(JPG_CNV_PROGRESS_ID, telemetry, JPG_CNV_PROGRESS_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *percentage = adcs_get_u8(&tm);
+    *result = adcs_get_u8(&tm);
+    *file_counter = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    if (state == ADCS_OK) {
+        bool complete = (*result == 1);
+        if (complete && (!jpg_cnv_complete || *file_counter != jpg_cnv_counter)) {
+            adcs_file_index_invalidate(); // a new JPG file, once per conversion
+        }
+        jpg_cnv_complete = complete;
+        jpg_cnv_counter = *file_counter;
+    }
     return state;
 }
 
 /**
  * @brief
  * 		Gets flags regarding CubeACP state.
- * @param flags_arr
- * 		6 boolean flags from Table 101
+ * @param flags
+ * 		6 flags from Table 101, named by adcs_acp_flag
  * @return
  * 		Success of function defined in adcs_types.h
  */
-ADCS_returnState ADCS_get_cubeACP_state(uint8_t *flags_arr) {
-    uint8_t telemetry;
+ADCS_returnState ADCS_get_cubeACP_state(adcs_acp_flags *flags) {
+    uint8_t telemetry[CUBEACP_STATE_FLAGS_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(CUBEACP_STATE_FLAGS_ID, &telemetry, 1);
-    for (int i = 0; i < 6; i++) {
-        *(flags_arr + i) = (telemetry >> i) & 1;
+    state = adcs_telemetry(CUBEACP_STATE_FLAGS_ID, telemetry, CUBEACP_STATE_FLAGS_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    adcs_get_bitset(&tm, flags->word, 0, ADCS_ACP_FLAG_COUNT);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
     }
     return state;
 }
@@ -1510,13 +1774,9 @@ ADCS_returnState ADCS_get_cubeACP_state(uint8_t *flags_arr) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_sat_pos_LLH(xyz *target) {
-    uint8_t telemetry[6];
-    ADCS_returnState state;
-    state = adcs_telemetry(SATELLITE_POSITION_LLH_ID, telemetry, 6);
-    memcpy(&target->x, &telemetry[0], 2);
-    memcpy(&target->y, &telemetry[2], 2);
-    memcpy(&target->z, &telemetry[4], 2);
-    return state;
+    uint8_t telemetry[SATELLITE_POSITION_LLH_LEN];
+    return adcs_telemetry_fields(SATELLITE_POSITION_LLH_ID, telemetry, SATELLITE_POSITION_LLH_LEN, adcs_llh_fields,
+                                 ADCS_LLH_FIELD_COUNT, target);
 }
 
 /**
@@ -1535,13 +1795,17 @@ ADCS_returnState ADCS_get_sat_pos_LLH(xyz *target) {
  */
 ADCS_returnState ADCS_get_execution_times(uint16_t *adcs_update, uint16_t *sensor_comms, uint16_t *sgp4_propag,
                                           uint16_t *igrf_model) {
-    uint8_t telemetry[8];
+    uint8_t telemetry[ADCS_EXE_TIMES_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(ADCS_EXE_TIMES_ID, telemetry, 8);
-    *adcs_update = (telemetry[1] << 8) + telemetry[0];
-    *sensor_comms = (telemetry[3] << 8) + telemetry[2];
-    *sgp4_propag = (telemetry[5] << 8) + telemetry[4];
-    *igrf_model = (telemetry[7] << 8) + telemetry[6];
+    state = adcs_telemetry(ADCS_EXE_TIMES_ID, telemetry, ADCS_EXE_TIMES_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *adcs_update = adcs_get_u16(&tm);
+    *sensor_comms = adcs_get_u16(&tm);
+    *sgp4_propag = adcs_get_u16(&tm);
+    *igrf_model = adcs_get_u16(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -1557,14 +1821,21 @@ ADCS_returnState ADCS_get_execution_times(uint16_t *adcs_update, uint16_t *senso
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_ACP_loop_stat(uint16_t *time, uint8_t *execution_point) {
-    uint8_t telemetry[3];
+    uint8_t telemetry[ACP_EXE_STATE_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(ACP_EXE_STATE_ID, telemetry, 3);
-    *time = (telemetry[1] << 8) + telemetry[0];
-    *execution_point = telemetry[2];
+    state = adcs_telemetry(ACP_EXE_STATE_ID, telemetry, ACP_EXE_STATE_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *time = adcs_get_u16(&tm);
+    *execution_point = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
+// Last save status read, it stays at 100% without error until the next capture starts
+static bool img_save_complete;
+
 /**
  * @brief
  * 		Gets the status of Image Capture and Save Operation.
@@ -1581,11 +1852,22 @@ ADCS_returnState ADCS_get_ACP_loop_stat(uint16_t *time, uint8_t *execution_point
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_img_save_progress(uint8_t *percentage, uint8_t *status) {
-    uint8_t telemetry[2];
+    uint8_t telemetry[IMG_CAPTURE_SAVE_OP_STAT_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(IMG_CAPTURE_SAVE_OP_STAT, telemetry, 2);
-    *percentage = telemetry[0];
-    *status = telemetry[1];
+    state = adcs_telemetry(IMG_CAPTURE_SAVE_OP_STAT, telemetry, IMG_CAPTURE_SAVE_OP_STAT_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+    *percentage = adcs_get_u8(&tm);
+    *status = adcs_get_u8(&tm);
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    if (state == ADCS_OK) {
+        bool complete = (*percentage == 100 && *status == 0);
+        if (complete && !img_save_complete) {
+            adcs_file_index_invalidate(); // a new image file, once per save
+        }
+        img_save_complete = complete;
+    }
     return state;
 }
 
@@ -1601,22 +1883,24 @@ ADCS_returnState ADCS_get_img_save_progress(uint8_t *percentage, uint8_t *status
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_measurements(adcs_measures *measurements) {
-    uint8_t telemetry[72];
-    ADCS_returnState state;
-    state = adcs_telemetry(ADCS_MEASUREMENTS_ID, telemetry, 72);
-    get_xyz(&measurements->magnetic_field, &telemetry[0], 0.01); // [uT]
-    get_xyz(&measurements->coarse_sun, &telemetry[6], 0.0001);
-    get_xyz(&measurements->sun, &telemetry[12], 0.0001);
-    get_xyz(&measurements->nadir, &telemetry[18], 0.0001);
-    get_xyz(&measurements->angular_rate, &telemetry[24], 0.01); // [deg/s]
-    get_xyz(&measurements->wheel_speed, &telemetry[30], 1);     // [rpm]
-    get_xyz(&measurements->star1b, &telemetry[36], 0.0001);
-    get_xyz(&measurements->star1o, &telemetry[42], 0.0001);
-    get_xyz(&measurements->star2b, &telemetry[48], 0.0001);
-    get_xyz(&measurements->star2o, &telemetry[54], 0.0001);
-    get_xyz(&measurements->star3b, &telemetry[60], 0.0001);
-    get_xyz(&measurements->star3o, &telemetry[66], 0.0001);
-    return state;
+    uint8_t telemetry[ADCS_MEASUREMENTS_LEN];
+    return adcs_telemetry_fields(ADCS_MEASUREMENTS_ID, telemetry, ADCS_MEASUREMENTS_LEN, adcs_measures_fields,
+                                 ADCS_MEASURES_FIELD_COUNT, measurements);
+}
+
+/**
+ * @brief
+ * 		Gets the calibrated sensor measurements without converting them to physical units.
+ * @param measurements
+ * 		The counts as sent, scaled by the ADCS_MEASURES_*_SCALE constants of adcs_frames.h
+ * 		Refer to table 150
+ * @return
+ * 		Success of function defined in adcs_types.h
+ */
+ADCS_returnState ADCS_get_measurements_raw(adcs_measures_raw *measurements) {
+    uint8_t telemetry[ADCS_MEASUREMENTS_LEN];
+    return adcs_telemetry_fields(ADCS_MEASUREMENTS_ID, telemetry, ADCS_MEASUREMENTS_LEN, adcs_measures_raw_fields,
+                                 ADCS_MEASURES_RAW_FIELD_COUNT, measurements);
 }
 
 /*********************** ADCS Actuator ************************/
@@ -1630,12 +1914,9 @@ ADCS_returnState ADCS_get_measurements(adcs_measures *measurements) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_actuator(adcs_actuator *commands) {
-    uint8_t telemetry[12];
-    ADCS_returnState state;
-    state = adcs_telemetry(ACTUATOR_ID, telemetry, 12);
-    get_xyz(&commands->magnetorquer, &telemetry[0], 100); // [s]
-    get_xyz(&commands->wheel_speed, &telemetry[6], 1);    // [rpm]
-    return state;
+    uint8_t telemetry[ACTUATOR_LEN];
+    return adcs_telemetry_fields(ACTUATOR_ID, telemetry, ACTUATOR_LEN, adcs_actuator_fields,
+                                 ADCS_ACTUATOR_FIELD_COUNT, commands);
 }
 
 /*********************** ADCS Estimation ************************/
@@ -1649,17 +1930,24 @@ ADCS_returnState ADCS_get_actuator(adcs_actuator *commands) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_estimation(adcs_estimate *data) {
-    uint8_t telemetry[42];
-    ADCS_returnState state;
-    state = adcs_telemetry(ESTIMATION_ID, telemetry, 42);
-    get_xyz(&data->igrf_magnetic_field, &telemetry[0], 0.01); // [uT]
-    get_xyz(&data->sun, &telemetry[6], 0.0001);
-    get_xyz(&data->gyro_bias, &telemetry[12], 0.001); // [deg/s]
-    get_xyz(&data->innovation, &telemetry[18], 0.0001);
-    get_xyz(&data->quaternion_err, &telemetry[24], 0.0001);
-    get_xyz(&data->quaternion_covar, &telemetry[30], 0.001);
-    get_xyz(&data->angular_rate_covar, &telemetry[36], 0.001);
-    return state;
+    uint8_t telemetry[ESTIMATION_LEN];
+    return adcs_telemetry_fields(ESTIMATION_ID, telemetry, ESTIMATION_LEN, adcs_estimate_fields,
+                                 ADCS_ESTIMATE_FIELD_COUNT, data);
+}
+
+/**
+ * @brief
+ * 		Gets the estimation meta-data without converting it to physical units.
+ * @param data
+ * 		The counts as sent, scaled by the ADCS_ESTIMATE_*_SCALE constants of adcs_frames.h
+ * 		Refer to table 152
+ * @return
+ * 		Success of function defined in adcs_types.h
+ */
+ADCS_returnState ADCS_get_estimation_raw(adcs_estimate_raw *data) {
+    uint8_t telemetry[ESTIMATION_LEN];
+    return adcs_telemetry_fields(ESTIMATION_ID, telemetry, ESTIMATION_LEN, adcs_estimate_raw_fields,
+                                 ADCS_ESTIMATE_RAW_FIELD_COUNT, data);
 }
 
 /**
@@ -1680,44 +1968,22 @@ ADCS_returnState ADCS_get_estimation(adcs_estimate *data) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_ASGP4(bool *complete, uint8_t *err, adcs_asgp4 *asgp4) {
-    uint8_t telemetry[33];
+    uint8_t telemetry[ASGP4_TLEs_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(ASGP4_TLEs_ID, telemetry, 33);
-    *complete = telemetry[0] & 1;
-    *err = telemetry[0] >> 1;
-    memcpy(&asgp4->epoch, &telemetry[1], 4);
-    memcpy(&asgp4->inclination, &telemetry[5], 4);
-    memcpy(&asgp4->RAAN, &telemetry[9], 4);
-    memcpy(&asgp4->ECC, &telemetry[13], 4);
-    memcpy(&asgp4->AOP, &telemetry[17], 4);
-    memcpy(&asgp4->MA, &telemetry[21], 4);
-    memcpy(&asgp4->MM, &telemetry[25], 4);
-    memcpy(&asgp4->Bstar, &telemetry[29], 4);
+    state = adcs_telemetry_fields(ASGP4_TLEs_ID, telemetry, ASGP4_TLEs_LEN, adcs_asgp4_fields,
+                                  ADCS_ASGP4_FIELD_COUNT, asgp4);
+    if (state == ADCS_OK) {
+        adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
+        *complete = adcs_get_flag(&tm);
+        *err = adcs_get_bits(&tm, 7);
+        if (tm.overrun) {
+            return ADCS_INCORRECT_LENGTH;
+        }
+    }
     return state;
 }
 
 /********************* ADCS Raw Sensor Measurements **********************/
-/**
- * @brief
- * 		Camera sensor capture and detection result
- * @param centroid_x
- * 		azimuth angle
- * @param centroid_y
- * 		elevation angle
- * @param capture_stat
- * 		Camera capture status: 0-5 Refer to table 123
- * @param detect_result
- * 		Camera detection result: 0-7 Refer to table 124
- * @param address
- * 		the position in the telemetry frame where the data is located
- */
-void get_cam_sensor(cam_sensor *cam, uint8_t *address) {
-    cam->centroid_x = uint82int16(*address, *(address + 1));
-    cam->centroid_y = uint82int16(*(address + 2), *(address + 3));
-    cam->capture_stat = *(address + 4);
-    cam->detect_result = *(address + 5);
-}
-
 /**
  * @brief
  * 		Gets the raw sensor measurements.
@@ -1728,32 +1994,9 @@ void get_cam_sensor(cam_sensor *cam, uint8_t *address) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_raw_sensor(adcs_raw_sensor *measurements) {
-    uint8_t telemetry[34];
-    ADCS_returnState state;
-    state = adcs_telemetry(RAW_SENSOR_MEASUREMENTS_ID, telemetry, 34);
-    get_cam_sensor(&measurements->cam2, &telemetry[0]);
-    get_cam_sensor(&measurements->cam1, &telemetry[6]);
-    for (int i = 0; i < 10; i++) {
-        *(measurements->css + i) = telemetry[i + 12];
-    }
-    get_xyz16(&measurements->MTM, &telemetry[22]);
-    get_xyz16(&measurements->rate, &telemetry[28]);
-    return state;
-}
-
-/**
- * @brief
- * 		Camera sensor capture and detection result
- * @param pos
- * 		ECEF position [m]
- * @param vel
- * 		ECEF velocity [m/s]
- * @param address
- * 		the position in the telemetry frame where the data is located
- */
-void get_ecef(ecef *coordinate, uint8_t *address) {
-    coordinate->pos = uint82int32(address);
-    coordinate->vel = uint82int16(*(address + 4), *(address + 5));
+    uint8_t telemetry[RAW_SENSOR_MEASUREMENTS_LEN];
+    return adcs_telemetry_fields(RAW_SENSOR_MEASUREMENTS_ID, telemetry, RAW_SENSOR_MEASUREMENTS_LEN,
+                                 adcs_raw_sensor_fields, ADCS_RAW_SENSOR_FIELD_COUNT, measurements);
 }
 
 /**
@@ -1766,51 +2009,9 @@ void get_ecef(ecef *coordinate, uint8_t *address) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_raw_GPS(adcs_raw_gps *measurements) {
-    uint8_t telemetry[36];
-    ADCS_returnState state;
-    state = adcs_telemetry(RAW_GPS_MEASUREMENTS_ID, telemetry, 36);
-    measurements->sol_stat = telemetry[0];
-    measurements->tracked_sats = telemetry[1];
-    measurements->usedInSol_sats = telemetry[2];
-    measurements->xyz_lof_count = telemetry[3];
-    measurements->range_log_count = telemetry[4];
-    measurements->response_msg = telemetry[5];
-    measurements->reference_week = telemetry[7] << 8 | telemetry[6];
-    measurements->time = telemetry[11] << 24 | telemetry[10] << 16 | telemetry[9] << 8 | telemetry[8];
-    get_ecef(&measurements->x, &telemetry[12]);
-    get_ecef(&measurements->y, &telemetry[18]);
-    get_ecef(&measurements->z, &telemetry[24]);
-    measurements->pos_std_dev.x = telemetry[30] * 0.1;
-    measurements->pos_std_dev.y = telemetry[31] * 0.1;
-    measurements->pos_std_dev.z = telemetry[32] * 0.1;
-    measurements->vel_std_dev.x = telemetry[33];
-    measurements->vel_std_dev.y = telemetry[34];
-    measurements->vel_std_dev.z = telemetry[35];
-    return state;
-}
-
-/**
- * @brief
- * 		Gets raw data for stars.
- * @param address
- * 		the position in the telemetry frame where the data is located
- * @param i
- * 		star index
- */
-void get_star_data(star_data *coordinate, uint8_t *address, uint8_t i) {
-    coordinate->confidence = *(address + i); // percent
-    coordinate->magnitude = *(address + 4 + 2 * i) << 8 | *(address + 3 + 2 * i);
-    coordinate->catalouge_num = *(address + 10 + 6 * i) << 8 | *(address + 9 + 6 * i);
-    if ((*(address + 12 + 6 * i)) >> 7) {
-        coordinate->centroid_x = -1 * (~(*(address + 12 + 6 * i) << 8 | *(address + 11 + 6 * i)) + 1);
-    } else {
-        coordinate->centroid_x = *(address + 12 + 6 * i) << 8 | *(address + 11 + 6 * i);
-    }
-    if ((*(address + 14 + 6 * i)) >> 7) {
-        coordinate->centroid_y = -1 * (~(*(address + 14 + 6 * i) << 8 | *(address + 13 + 6 * i)) + 1);
-    } else {
-        coordinate->centroid_y = *(address + 14 + 6 * i) << 8 | *(address + 13 + 6 * i);
-    }
+    uint8_t telemetry[RAW_GPS_MEASUREMENTS_LEN];
+    return adcs_telemetry_fields(RAW_GPS_MEASUREMENTS_ID, telemetry, RAW_GPS_MEASUREMENTS_LEN, adcs_raw_gps_fields,
+                                 ADCS_RAW_GPS_FIELD_COUNT, measurements);
 }
 
 /**
@@ -1823,28 +2024,9 @@ void get_star_data(star_data *coordinate, uint8_t *address, uint8_t i) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_star_tracker(adcs_star_track *measurements) {
-    uint8_t telemetry[54];
-    ADCS_returnState state;
-    state = adcs_telemetry(RAW_STAR_TRACKER_ID, telemetry, 54);
-    measurements->detected_stars = telemetry[0];
-    measurements->img_noise = telemetry[1];
-    measurements->invalid_stars = telemetry[2];
-    measurements->identified_stars = telemetry[3];
-    measurements->identification_mode = telemetry[4];
-    measurements->img_dark_val = telemetry[5];
-    for (int i = 0; i < 8; i++) {
-        *(measurements->flags_arr + i) = (telemetry[6] >> i) & 1;
-    }
-    measurements->sample_T = telemetry[8] << 8 | telemetry[7];
-    get_star_data(&measurements->star1, &telemetry[9], 0);
-    get_star_data(&measurements->star2, &telemetry[9], 1);
-    get_star_data(&measurements->star3, &telemetry[9], 2);
-    measurements->capture_t = telemetry[37] << 8 | telemetry[36];        // [ms]
-    measurements->detect_t = telemetry[39] << 8 | telemetry[38];         // [ms]
-    measurements->identification_t = telemetry[41] << 8 | telemetry[40]; // [ms]
-    get_xyz(&measurements->estimated_rate, &telemetry[42], 0.0001);
-    get_xyz(&measurements->estimated_att, &telemetry[48], 0.0001);
-    return state;
+    uint8_t telemetry[RAW_STAR_TRACKER_LEN];
+    return adcs_telemetry_fields(RAW_STAR_TRACKER_ID, telemetry, RAW_STAR_TRACKER_LEN, adcs_star_track_fields,
+                                 ADCS_STAR_TRACK_FIELD_COUNT, measurements);
 }
 
 /**
@@ -1856,81 +2038,40 @@ ADCS_returnState ADCS_get_star_tracker(adcs_star_track *measurements) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_MTM2_measurements(xyz16 *Mag) {
-    uint8_t telemetry[6];
-    ADCS_returnState state;
-    state = adcs_telemetry(MTM2_MEASUREMENTS_ID, telemetry, 6);
-    get_xyz16(Mag, &telemetry[0]);
-    return state;
+    uint8_t telemetry[MTM2_MEASUREMENTS_LEN];
+    return adcs_telemetry_fields(MTM2_MEASUREMENTS_ID, telemetry, MTM2_MEASUREMENTS_LEN, adcs_xyz16_fields,
+                                 ADCS_XYZ16_FIELD_COUNT, Mag);
 }
 
 /******************* ADCS Power & Temperature ********************/
 /**
  * @brief
- * 		A supplementary function for the ADCS power measurements
- * @param measurement
- * 		the measured parameter (Table 154)
- * @param address
- * 		the position in the telemetry frame where the data is located
- * @param coef
- * 		formatted value = rawval * coef;
- */
-void get_current(float *measurement, uint16_t raw, float coef) {
-    *measurement = coef * raw;
-}
-
-/**
- * @brief
- * 		A supplementary function for the ADCS temperature measurements
- * @param measurement
- * 		the measured parameter (Table 154)
- * @param address
- * 		the position in the telemetry frame where the data is located
- * @param coef
- * 		formatted value = rawval * coef;
+ * 		Gets the Power & Temperature measurements.
+ * @param measurements
+ * 		A struct of floats defined in adcs_handler.h
+ * 		Refer to table 154
+ * @return
+ * 		Success of function defined in adcs_types.h
  */
-void get_temp(float *measurement, int16_t raw, float coef) {
-    *measurement = coef * raw;
+ADCS_returnState ADCS_get_power_temp(adcs_pwr_temp *measurements) {
+    uint8_t telemetry[POWER_TEMP_LEN];
+    return adcs_telemetry_fields(POWER_TEMP_ID, telemetry, POWER_TEMP_LEN, adcs_pwr_temp_fields,
+                                 ADCS_PWR_TEMP_FIELD_COUNT, measurements);
 }
 
 /**
  * @brief
- * 		Gets the Power & Temperature measurements.
+ * 		Gets the Power & Temperature measurements without converting them to physical units.
  * @param measurements
- * 		A struct of floats defined in adcs_handler.h
+ * 		The counts as sent, scaled by the ADCS_PWR_TEMP_*_SCALE constants of adcs_frames.h
  * 		Refer to table 154
  * @return
  * 		Success of function defined in adcs_types.h
  */
-ADCS_returnState ADCS_get_power_temp(adcs_pwr_temp *measurements) {
-    uint8_t telemetry[38];
-    ADCS_returnState state;
-    state = adcs_telemetry(POWER_TEMP_ID, telemetry, 38);
-
-    get_current(&measurements->cubesense1_3v3_I, (telemetry[1] << 8) | telemetry[0], 0.1);     // [mA]
-    get_current(&measurements->cubesense1_camSram_I, (telemetry[3] << 8) | telemetry[2], 0.1); // [mA]
-    get_current(&measurements->cubesense2_3v3_I, (telemetry[5] << 8) | telemetry[4], 0.1);     // [mA]
-    get_current(&measurements->cubesense2_camSram_I, (telemetry[7] << 8) | telemetry[6], 0.1); // [mA]
-    get_current(&measurements->cubecontrol_3v3_I, (telemetry[9] << 8) | telemetry[8],
-                0.48828125); // [mA]
-    get_current(&measurements->cubecontrol_5v_I, (telemetry[11] << 8) | telemetry[10],
-                0.48828125); // [mA]
-    get_current(&measurements->cubecontrol_vBat_I, (telemetry[13] << 8) | telemetry[12],
-                0.48828125);                                         // [mA]
-    get_current(&measurements->wheel1_I, (telemetry[15] << 8) | telemetry[14], 0.01);      // [mA]
-    get_current(&measurements->wheel2_I, (telemetry[17] << 8) | telemetry[16], 0.01);      // [mA]
-    get_current(&measurements->wheel3_I, (telemetry[19] << 8) | telemetry[18], 0.01);      // [mA]
-    get_current(&measurements->cubestar_I, (telemetry[21] << 8) | telemetry[20], 0.01);    // [mA]
-    get_current(&measurements->magnetorquer_I, (telemetry[23] << 8) | telemetry[22], 0.1); // [mA]
-
-    get_temp(&measurements->cubestar_temp, (telemetry[25] << 8) | telemetry[24], 0.01); // [C]
-    get_temp(&measurements->MCU_temp, (telemetry[27] << 8) | telemetry[26], 1);         // [C]
-    get_temp(&measurements->MTM_temp, (telemetry[29] << 8) | telemetry[28], 0.1);       // [C]
-    get_temp(&measurements->MTM2_temp, (telemetry[31] << 8) | telemetry[30], 0.1);      // [C]
-    measurements->rate_sensor_temp.x = (telemetry[33] << 8) | telemetry[32];   // [C]
-    measurements->rate_sensor_temp.y = (telemetry[35] << 8) | telemetry[34];   // [C]
-    measurements->rate_sensor_temp.z = (telemetry[37] << 8) | telemetry[36];   // [C]
-
-    return state;
+ADCS_returnState ADCS_get_power_temp_raw(adcs_pwr_temp_raw *measurements) {
+    uint8_t telemetry[POWER_TEMP_LEN];
+    return adcs_telemetry_fields(POWER_TEMP_ID, telemetry, POWER_TEMP_LEN, adcs_pwr_temp_raw_fields,
+                                 ADCS_PWR_TEMP_RAW_FIELD_COUNT, measurements);
 }
 
 /************************* ACP Config Msgs *************************/
@@ -1947,19 +2088,16 @@ ADCS_returnState ADCS_get_power_temp(adcs_pwr_temp *measurements) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_power_control(uint8_t *control) {
-    uint8_t command[4] = {0}; //TODO: FIX power control setting bytes. Right now it only works for cubesense 1
+    uint8_t command[SET_POWER_CONTROL_LEN + 1] = {0}; //TODO: FIX power control setting bytes. Right now it only works for cubesense 1
     command[0] = SET_POWER_CONTROL_ID;
-    //command[1] = 0x10; //sets the cubesense 1 on
-    for (int i = 0; i < 4; i++) {
-        command[1] = command[1] | (*(control + i) << 2*i);
-    }
-    for (int i = 0; i < 4; i++) {
-        command[2] = command[2] | (*(control + 4 + i) << 2*i);
+    adcs_writer tc = adcs_writer_init(&command[1], SET_POWER_CONTROL_LEN);
+    for (int i = 0; i < 10; i++) {
+        adcs_put_bits(&tc, control[i], 2);
     }
-    for (int i = 0; i < 2; i++) {
-        command[3] = command[3] | (*(control + 8 + i) << 2*i);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
     }
-    return adcs_telecommand(command, 4);
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -1974,18 +2112,16 @@ ADCS_returnState ADCS_set_power_control(uint8_t *control) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_power_control(uint8_t *control) {
-    uint8_t telemetry[3];
+    uint8_t telemetry[GET_POWER_CONTROL_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(GET_POWER_CONTROL_ID, telemetry, 3);
+    state = adcs_telemetry(GET_POWER_CONTROL_ID, telemetry, GET_POWER_CONTROL_LEN);
+    adcs_reader tm = adcs_reader_init(telemetry, sizeof(telemetry));
 
-    for (int i = 0; i < 4; i++) {
-        *(control + i) = (telemetry[0] >> 2 * i) & 0x3;
-    }
-    for (int i = 0; i < 4; i++) {
-        *(control + i + 4) = (telemetry[1] >> 2 * i) & 0x3;
+    for (int i = 0; i < 10; i++) {
+        control[i] = adcs_get_bits(&tm, 2);
     }
-    for (int i = 0; i < 2; i++) {
-        *(control + i + 8) = (telemetry[2] >> 2 * i) & 0x3;
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
     }
     return state;
 }
@@ -1999,15 +2135,9 @@ ADCS_returnState ADCS_get_power_control(uint8_t *control) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_attitude_angle(xyz att_angle) {
-    uint8_t command[7];
-    command[0] = SET_ATT_ANGLE_ID;
-    float coef = 0.01;
-    xyz16 raw_val;
-    raw_val.x = att_angle.x / coef;
-    raw_val.y = att_angle.y / coef;
-    raw_val.z = att_angle.z / coef;
-    memcpy(&command[1], &raw_val, 6);
-    return adcs_telecommand(command, 7);
+    uint8_t command[1 + SET_ATT_ANGLE_LEN];
+    return adcs_telecommand_fields(SET_ATT_ANGLE_ID, command, sizeof(command), adcs_att_angle_fields,
+                                   ADCS_ATT_ANGLE_FIELD_COUNT, &att_angle);
 }
 
 /**
@@ -2019,12 +2149,9 @@ ADCS_returnState ADCS_set_attitude_angle(xyz att_angle) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_attitude_angle(xyz *att_angle) {
-    uint8_t telemetry[6];
-    ADCS_returnState state;
-    state = adcs_telemetry(GET_ATT_ANGLE_ID, telemetry, 6);
-    float coef = 0.01;
-    get_xyz(att_angle, &telemetry[0], coef);
-    return state;
+    uint8_t telemetry[GET_ATT_ANGLE_LEN];
+    return adcs_telemetry_fields(GET_ATT_ANGLE_ID, telemetry, GET_ATT_ANGLE_LEN, adcs_att_angle_fields,
+                                 ADCS_ATT_ANGLE_FIELD_COUNT, att_angle);
 }
 
 /**
@@ -2036,10 +2163,9 @@ ADCS_returnState ADCS_get_attitude_angle(xyz *att_angle) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_track_controller(xyz target) {
-    uint8_t command[13];
-    command[0] = SET_TRACK_CTRLER_TARGET_REF_ID;
-    memcpy(&command[1], &target, 6);
-    return adcs_telecommand(command, 13);
+    uint8_t command[1 + SET_TRACK_CTRLER_TARGET_REF_LEN];
+    return adcs_telecommand_fields(SET_TRACK_CTRLER_TARGET_REF_ID, command, sizeof(command), adcs_track_ref_fields,
+                                   ADCS_TRACK_REF_FIELD_COUNT, &target);
 }
 
 /**
@@ -2051,20 +2177,16 @@ ADCS_returnState ADCS_set_track_controller(xyz target) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_track_controller(xyz *target) {
-    uint8_t telemetry[12];
-    ADCS_returnState state;
-    state = adcs_telemetry(GET_TRACK_CTRLER_TARGET_REF_ID, telemetry, 12);
-    memcpy(&target->x, &telemetry[0], 4);
-    memcpy(&target->y, &telemetry[4], 4);
-    memcpy(&target->z, &telemetry[8], 4);
-    return state;
+    uint8_t telemetry[GET_TRACK_CTRLER_TARGET_REF_LEN];
+    return adcs_telemetry_fields(GET_TRACK_CTRLER_TARGET_REF_ID, telemetry, GET_TRACK_CTRLER_TARGET_REF_LEN,
+                                 adcs_track_ref_fields, ADCS_TRACK_REF_FIELD_COUNT, target);
 }
 
 /**
  * @brief
  * 		Log selection and period for SD log 1,2 & UART
- * @param flags_arr
- * 		Up to 80 flags indicating which telemetry frames should be
+ * @param select
+ * 		80 flags indicating which telemetry frames should be
  * logged
  * @param period
  * 		log period (0 for stop)
@@ -2081,21 +2203,21 @@ ADCS_returnState ADCS_get_track_controller(xyz *target) {
  * @return
  * 		Success of function defined in adcs_types.h
  */
-ADCS_returnState ADCS_set_log_config(uint8_t **flags_arr, uint16_t period, uint8_t dest, uint8_t log) {
-    uint8_t command[14] = {0};
+ADCS_returnState ADCS_set_log_config(adcs_log_select select, uint16_t period, uint8_t dest, uint8_t log) {
+    uint8_t command[SET_SD_LOG1_CONFIG_LEN + 1] = {0};
     command[0] = SET_SD_LOG1_CONFIG_ID + (log - 1);
-    for (int j = 0; j < 10; j++) {
-        for (int i = 0; i < 8; i++) {
-            command[j + 1] = command[j + 1] | (*(*flags_arr + (8 * j) + i) << i);
-        }
+    adcs_writer tc = adcs_writer_init(&command[1], SET_SD_LOG1_CONFIG_LEN);
+    adcs_put_bitset(&tc, select.word, 0, ADCS_LOG_SELECT_COUNT);
+    adcs_put_u16(&tc, period);
+    adcs_put_u8(&tc, dest);
+    if (tc.overrun) {
+        return ADCS_INCORRECT_LENGTH;
     }
-    memcpy(&command[11], &period, 2);
-    command[13] = dest;
     ADCS_returnState state;
     if (log == 3) {
-        state = adcs_telecommand(command, 13);
+        state = adcs_telecommand(command, SET_UART_LOG_CONFIG_LEN + 1);
     } else {
-        state = adcs_telecommand(command, 14);
+        state = adcs_telecommand(command, SET_SD_LOG1_CONFIG_LEN + 1);
     }
     return state;
 }
@@ -2103,8 +2225,8 @@ ADCS_returnState ADCS_set_log_config(uint8_t **flags_arr, uint16_t period, uint8
 /**
  * @brief
  * 		Gets the log selection and period for LOG 1,2 & UART.
- * @param flags_arr
- * 		Up to 80 flags indicating which telemetry frames should be
+ * @param select
+ * 		80 flags indicating which telemetry frames should be
  * logged
  * @param period
  * 		log period (0 for stop)
@@ -2121,28 +2243,24 @@ ADCS_returnState ADCS_set_log_config(uint8_t **flags_arr, uint16_t period, uint8
  * @return
  * 		Success of function defined in adcs_types.h
  */
-ADCS_returnState ADCS_get_log_config(uint8_t **flags_arr, uint16_t *period, uint8_t *dest, uint8_t log) {
-    uint8_t telemetry[13];
+ADCS_returnState ADCS_get_log_config(adcs_log_select *select, uint16_t *period, uint8_t *dest, uint8_t log) {
+    uint8_t telemetry[GET_SD_LOG1_CONFIG_LEN];
     ADCS_returnState state;
     uint8_t TM_ID = GET_SD_LOG1_CONFIG_ID + (log - 1);
-    if (TM_ID == GET_UART_LOG_CONFIG_ID) {
-        state = adcs_telemetry(TM_ID, telemetry, 12);
-    } else {
-        state = adcs_telemetry(TM_ID, telemetry, 13);
-    }
-
-    for (int j = 0; j < 10; j++) {
-        for (int i = 0; i < 8; i++) {
-            *(*flags_arr + (8 * j) + i) = (telemetry[j] >> i) & 1;
-        }
-    }
-    *period = telemetry[11] << 8 | telemetry[10];
+    uint32_t len = (TM_ID == GET_UART_LOG_CONFIG_ID) ? GET_UART_LOG_CONFIG_LEN : GET_SD_LOG1_CONFIG_LEN;
+    state = adcs_telemetry(TM_ID, telemetry, len);
+    adcs_reader tm = adcs_reader_init(telemetry, len);
+    adcs_get_bitset(&tm, select->word, 0, ADCS_LOG_SELECT_COUNT);
+    *period = adcs_get_u16(&tm);
     if (TM_ID == GET_UART_LOG_CONFIG_ID) {
         *dest = 2;
     } else {
-        *dest = telemetry[12];
+        *dest = adcs_get_u8(&tm);
     }
 
+    if (tm.overrun) {
+        return ADCS_INCORRECT_LENGTH;
+    }
     return state;
 }
 
@@ -2158,15 +2276,9 @@ ADCS_returnState ADCS_get_log_config(uint8_t **flags_arr, uint16_t *period, uint
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_inertial_ref(xyz iner_ref) {
-    uint8_t command[7];
-    command[0] = SET_INERTIAL_POINT_ID;
-    float coef = 0.0001;
-    xyz16 raw_val;
-    raw_val.x = iner_ref.x / coef;
-    raw_val.y = iner_ref.y / coef;
-    raw_val.z = iner_ref.z / coef;
-    memcpy(&command[1], &raw_val, 6);
-    return adcs_telecommand(command, 7);
+    uint8_t command[1 + SET_INERTIAL_POINT_LEN];
+    return adcs_telecommand_fields(SET_INERTIAL_POINT_ID, command, sizeof(command), adcs_iner_ref_fields,
+                                   ADCS_INER_REF_FIELD_COUNT, &iner_ref);
 }
 
 /**
@@ -2181,12 +2293,9 @@ ADCS_returnState ADCS_set_inertial_ref(xyz iner_ref) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_inertial_ref(xyz *iner_ref) {
-    uint8_t telemetry[6];
-    ADCS_returnState state;
-    state = adcs_telemetry(GET_INERTIAL_POINT_ID, telemetry, 6);
-    float coef = 0.0001;
-    get_xyz(iner_ref, &telemetry[0], coef);
-    return state;
+    uint8_t telemetry[GET_INERTIAL_POINT_LEN];
+    return adcs_telemetry_fields(GET_INERTIAL_POINT_ID, telemetry, GET_INERTIAL_POINT_LEN, adcs_iner_ref_fields,
+                                 ADCS_INER_REF_FIELD_COUNT, iner_ref);
 }
 
 /************************* Configuration *************************/
@@ -2199,10 +2308,9 @@ ADCS_returnState ADCS_get_inertial_ref(xyz *iner_ref) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_sgp4_orbit_params(adcs_sgp4 params) {
-    uint8_t command[65];
-    command[0] = SET_SGP4_ORBIT_PARAMS_ID;
-    memcpy(&command[1], &params, 64);
-    return adcs_telecommand(command, 65);
+    uint8_t command[1 + SET_SGP4_ORBIT_PARAMS_LEN];
+    return adcs_telecommand_fields(SET_SGP4_ORBIT_PARAMS_ID, command, sizeof(command), adcs_sgp4_fields,
+                                   ADCS_SGP4_FIELD_COUNT, &params);
 }
 
 /**
@@ -2214,18 +2322,9 @@ ADCS_returnState ADCS_set_sgp4_orbit_params(adcs_sgp4 params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_sgp4_orbit_params(adcs_sgp4 *params) {
-    uint8_t telemetry[64];
-    ADCS_returnState state;
-    state = adcs_telemetry(GET_SGP4_ORBIT_PARAMS_ID, telemetry, 64);
-    memcpy(&params->inclination, &telemetry[0], 8);
-    memcpy(&params->ECC, &telemetry[8], 8);
-    memcpy(&params->RAAN, &telemetry[16], 8);
-    memcpy(&params->AOP, &telemetry[24], 8);
-    memcpy(&params->Bstar, &telemetry[32], 8);
-    memcpy(&params->MM, &telemetry[40], 8);
-    memcpy(&params->MA, &telemetry[48], 8);
-    memcpy(&params->epoch, &telemetry[56], 8);
-    return state;
+    uint8_t telemetry[GET_SGP4_ORBIT_PARAMS_LEN];
+    return adcs_telemetry_fields(GET_SGP4_ORBIT_PARAMS_ID, telemetry, GET_SGP4_ORBIT_PARAMS_LEN, adcs_sgp4_fields,
+                                 ADCS_SGP4_FIELD_COUNT, params);
 }
 
 /**
@@ -2237,35 +2336,9 @@ ADCS_returnState ADCS_get_sgp4_orbit_params(adcs_sgp4 *params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_system_config(adcs_sysConfig config) {
-    uint8_t command[174];
-    command[0] = SET_SYSTEM_CONFIG_ID;
-    command[1] = (config.special_ctrl_sel << 4) | config.acp_type;
-    command[2] = config.CC_sig_ver;
-    command[3] = config.CC_motor_ver;
-    command[4] = config.CS1_ver;
-    command[5] = config.CS2_ver;
-    command[6] = (config.CS2_cam << 4) | config.CS1_cam;
-    command[7] = config.cubeStar_ver;
-    command[8] = (config.include_MTM2 << 4) | config.GPS;
-    memcpy(&command[9], &config.MTQ_max_dipole, 12);
-    memcpy(&command[21], &config.MTQ_ontime_res, 4);
-    memcpy(&command[25], &config.MTQ_max_ontime, 4);
-    memcpy(&command[29], &config.RW_max_torque, 12);
-    memcpy(&command[41], &config.RW_max_moment, 12);
-    memcpy(&command[53], &config.RW_inertia, 12);
-    memcpy(&command[65], &config.RW_torque_inc, 4);
-    memcpy(&command[69], &config.MTM1, 48);
-    memcpy(&command[117], &config.MTM2, 48);
-    command[165] = (config.CC_signal.pin << 4) | config.CC_signal.port;
-    command[166] = (config.CC_motor.pin << 4) | config.CC_motor.port;
-    command[167] = (config.CC_common.pin << 4) | config.CC_common.port;
-    command[168] = (config.CS1.pin << 4) | config.CS1.port;
-    command[169] = (config.CS2.pin << 4) | config.CS2.port;
-    command[170] = (config.cubeStar.pin << 4) | config.cubeStar.port;
-    command[171] = (config.CW1.pin << 4) | config.CW1.port;
-    command[172] = (config.CW2.pin << 4) | config.CW2.port;
-    command[173] = (config.CW3.pin << 4) | config.CW3.port;
-    return adcs_telecommand(command, 174);
+    uint8_t command[1 + SET_SYSTEM_CONFIG_LEN];
+    return adcs_telecommand_fields(SET_SYSTEM_CONFIG_ID, command, sizeof(command), adcs_sys_config_fields,
+                                   ADCS_SYS_CONFIG_FIELD_COUNT, &config);
 }
 
 /**
@@ -2277,48 +2350,9 @@ ADCS_returnState ADCS_set_system_config(adcs_sysConfig config) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_system_config(adcs_sysConfig *config) {
-    uint8_t telemetry[173];
-    ADCS_returnState state;
-    state = adcs_telemetry(GET_SYSTEM_CONFIG_ID, telemetry, 173);
-    config->acp_type = telemetry[0] & 0xF;
-    config->special_ctrl_sel = (telemetry[0] >> 4) & 0xF;
-    config->CC_sig_ver = telemetry[1];
-    config->CC_motor_ver = telemetry[2];
-    config->CS1_ver = telemetry[3];
-    config->CS2_ver = telemetry[4];
-    config->CS1_cam = telemetry[5] & 0xF;
-    config->CS2_cam = (telemetry[5] >> 4) & 0xF;
-    config->cubeStar_ver = telemetry[6];
-    config->GPS = telemetry[7] & 0xF;
-    config->include_MTM2 = (telemetry[7] >> 4) & 1;
-    memcpy(&config->MTQ_max_dipole, &telemetry[8], 12);
-    memcpy(&config->MTQ_ontime_res, &telemetry[20], 4);
-    memcpy(&config->MTQ_max_ontime, &telemetry[24], 4);
-    memcpy(&config->RW_max_torque, &telemetry[28], 12);
-    memcpy(&config->RW_max_moment, &telemetry[40], 12);
-    memcpy(&config->RW_inertia, &telemetry[52], 12);
-    memcpy(&config->RW_torque_inc, &telemetry[64], 4);
-    memcpy(&config->MTM1, &telemetry[68], 48);
-    memcpy(&config->MTM2, &telemetry[116], 48);
-    config->CC_signal.port = telemetry[164] & 0xF;
-    config->CC_signal.pin = (telemetry[164] >> 4) & 0xF;
-    config->CC_motor.port = telemetry[165] & 0xF;
-    config->CC_motor.pin = (telemetry[165] >> 4) & 0xF;
-    config->CC_common.port = telemetry[166] & 0xF;
-    config->CC_common.pin = (telemetry[166] >> 4) & 0xF;
-    config->CS1.port = telemetry[167] & 0xF;
-    config->CS1.pin = (telemetry[167] >> 4) & 0xF;
-    config->CS2.port = telemetry[168] & 0xF;
-    config->CS2.pin = (telemetry[168] >> 4) & 0xF;
-    config->cubeStar.port = telemetry[169] & 0xF;
-    config->cubeStar.pin = (telemetry[169] >> 4) & 0xF;
-    config->CW1.port = telemetry[170] & 0xF;
-    config->CW1.pin = (telemetry[170] >> 4) & 0xF;
-    config->CW2.port = telemetry[171] & 0xF;
-    config->CW2.pin = (telemetry[171] >> 4) & 0xF;
-    config->CW3.port = telemetry[172] & 0xF;
-    config->CW3.pin = (telemetry[172] >> 4) & 0xF;
-    return state;
+    uint8_t telemetry[GET_SYSTEM_CONFIG_LEN];
+    return adcs_telemetry_fields(GET_SYSTEM_CONFIG_ID, telemetry, GET_SYSTEM_CONFIG_LEN, adcs_sys_config_fields,
+                                 ADCS_SYS_CONFIG_FIELD_COUNT, config);
 }
 
 /**
@@ -2331,10 +2365,9 @@ ADCS_returnState ADCS_get_system_config(adcs_sysConfig *config) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_MTQ_config(xyzu8 params) {
-    uint8_t command[4];
-    command[0] = SET_MTQ_CONFIG_ID;
-    memcpy(&command[1], &params, 3);
-    return adcs_telecommand(command, 4);
+    uint8_t command[1 + SET_MTQ_CONFIG_LEN];
+    return adcs_telecommand_fields(SET_MTQ_CONFIG_ID, command, sizeof(command), adcs_mtq_fields,
+                                   ADCS_MTQ_FIELD_COUNT, &params);
 }
 
 /**
@@ -2365,17 +2398,9 @@ ADCS_returnState ADCS_set_RW_config(uint8_t *RW) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_rate_gyro(rate_gyro_config params) {
-    uint8_t command[11];
-    command[0] = SET_RATE_GYRO_CONFIG_ID;
-    memcpy(&command[1], &params.gyro, 3);
-    float coef = 0.001;
-    xyz16 raw_val;
-    raw_val.x = params.sensor_offset.x / coef;
-    raw_val.y = params.sensor_offset.y / coef;
-    raw_val.z = params.sensor_offset.z / coef;
-    memcpy(&command[4], &raw_val, 6);
-    command[10] = params.rate_sensor_mult;
-    return adcs_telecommand(command, 11);
+    uint8_t command[1 + SET_RATE_GYRO_CONFIG_LEN];
+    return adcs_telecommand_fields(SET_RATE_GYRO_CONFIG_ID, command, sizeof(command), adcs_rate_gyro_fields,
+                                   ADCS_RATE_GYRO_FIELD_COUNT, &params);
 }
 
 /**
@@ -2392,17 +2417,9 @@ ADCS_returnState ADCS_set_rate_gyro(rate_gyro_config params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_css_config(css_config config) {
-    uint8_t command[22];
-    command[0] = SET_CSS_CONFIG_ID;
-    memcpy(&command[1], &config.config[0], 10);
-    uint8_t raw_val[10];
-    float coef = 0.01;
-    for (int i = 0; i < 10; i++) {
-        raw_val[i] = config.rel_scale[i] / coef;
-    }
-    memcpy(&command[11], &raw_val[0], 10);
-    command[21] = config.threshold;
-    return adcs_telecommand(command, 22);
+    uint8_t command[1 + SET_CSS_CONFIG_LEN];
+    return adcs_telecommand_fields(SET_CSS_CONFIG_ID, command, sizeof(command), adcs_css_fields,
+                                   ADCS_CSS_FIELD_COUNT, &config);
 }
 
 /**
@@ -2415,19 +2432,14 @@ ADCS_returnState ADCS_set_css_config(css_config config) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_star_track_config(cubestar_config config) {
-    uint8_t command[54];
-    command[0] = SET_STAR_TRACK_CONFIG_ID;
-    xyz16 raw_val;
-    float coef = 0.01;
-    raw_val.x = config.mounting_angle.x / coef;
-    raw_val.y = config.mounting_angle.y / coef;
-    raw_val.z = config.mounting_angle.z / coef;
-    memcpy(&command[1], &raw_val, 6);
-    memcpy(&command[7], &config.exposure_t, 45);
-    command[52] = (config.loc_predict_en >> 1) | config.module_en;
-    uint8_t search_wid = config.search_wid * 5;
-    command[53] = search_wid;
-    return adcs_telecommand(command, 54);
+    uint8_t command[1 + SET_STAR_TRACK_CONFIG_LEN] = {SET_STAR_TRACK_CONFIG_ID};
+    ADCS_returnState state = adcs_fields_encode(adcs_star_tracker_fields, ADCS_STAR_TRACKER_FIELD_COUNT, &config,
+                                                &command[1], SET_STAR_TRACK_CONFIG_LEN);
+    if (state != ADCS_OK) {
+        return state;
+    }
+    command[53] = config.search_wid * 5;
+    return adcs_telecommand(command, sizeof(command));
 }
 
 /**
@@ -2438,103 +2450,15 @@ ADCS_returnState ADCS_set_star_track_config(cubestar_config config) {
  *      Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_cubesense_config(cubesense_config *config) {
-
-    uint8_t *telemetry = (uint8_t*)pvPortMalloc(112);
+    uint8_t *telemetry = (uint8_t *)pvPortMalloc(GET_CUBESENSE_CONFIG_LEN);
     if (telemetry == NULL) {
         return ADCS_MALLOC_FAILED;
     }
 
-    float coef = 0.01;
-    xyz16 raw_val_angle1, raw_val_angle2;
-    uint16_t raw_boresight_x1, raw_boresight_y1;
-    uint16_t raw_boresight_x2, raw_boresight_y2;
-    //request cubsense configuration and store in telemetry
     ADCS_returnState state;
-    state = adcs_telemetry(GET_CUBESENSE_CONFIG_ID, telemetry, 112);
-
-
-    //point these values to the pre-function structure
-    raw_val_angle1.x = (telemetry[1] << 8) | telemetry[0];
-    raw_val_angle1.y = (telemetry[3] << 8) | telemetry[2];
-    raw_val_angle1.z = (telemetry[5] << 8) | telemetry[4];
-    config->cam1_sense.detect_th = telemetry[6];
-    config->cam1_sense.auto_adjust = telemetry[7];
-    config->cam1_sense.exposure_t = (telemetry[9] << 8) | telemetry[8];
-    raw_boresight_x1 = (telemetry[11] << 8) | telemetry[10];
-
-    raw_boresight_y1 = (telemetry[13] << 8) | telemetry[12];
-    raw_val_angle2.x = (telemetry[15] << 8) | telemetry[14];
-    raw_val_angle2.y = (telemetry[17] << 8) | telemetry[16];
-    raw_val_angle2.z = (telemetry[19] << 8) | telemetry[18];
-
-    config->cam2_sense.detect_th = telemetry[20];
-    config->cam2_sense.auto_adjust = telemetry[21];
-
-    config->cam2_sense.exposure_t = (telemetry[23] << 8) | telemetry[22];
-    raw_boresight_x2 = (telemetry[25] << 8) | telemetry[24];
-    raw_boresight_y2 = (telemetry[27] << 8) | telemetry[26];
-
-    //convert data as per the ADCS datasheet
-    config->cam1_sense.mounting_angle.x = raw_val_angle1.x * coef;
-    config->cam1_sense.mounting_angle.y = raw_val_angle1.y * coef;
-    config->cam1_sense.mounting_angle.z = raw_val_angle1.z * coef;
-    config->cam1_sense.boresight_x = raw_boresight_x1 * coef;
-    config->cam1_sense.boresight_y = raw_boresight_y1 * coef;
-    config->cam2_sense.mounting_angle.x = raw_val_angle2.x * coef;
-    config->cam2_sense.mounting_angle.y = raw_val_angle2.y * coef;
-    config->cam2_sense.mounting_angle.z = raw_val_angle2.z * coef;
-    config->cam2_sense.boresight_x = raw_boresight_x2 * coef;
-    config->cam2_sense.boresight_y = raw_boresight_y2 * coef;
-
-    //no conversion necessary for the following parameters
-    config->nadir_max_deviate = telemetry[28];
-    config->nadir_max_bad_edge = telemetry[29];
-    config->nadir_max_radius = telemetry[30];
-    config->nadir_min_radius = telemetry[31];
-
-    config->cam1_area.area1.x.min = (telemetry[33] << 8) | telemetry[32];
-    config->cam1_area.area1.x.max = (telemetry[35] << 8) | telemetry[34];
-    config->cam1_area.area1.y.min = (telemetry[37] << 8) | telemetry[36];
-    config->cam1_area.area1.y.max = (telemetry[39] << 8) | telemetry[38];
-    config->cam1_area.area2.x.min = (telemetry[41] << 8) | telemetry[40];
-    config->cam1_area.area2.x.max = (telemetry[43] << 8) | telemetry[42];
-    config->cam1_area.area2.y.min = (telemetry[45] << 8) | telemetry[44];
-    config->cam1_area.area2.y.max = (telemetry[47] << 8) | telemetry[46];
-    config->cam1_area.area3.x.min = (telemetry[49] << 8) | telemetry[48];
-    config->cam1_area.area3.x.max = (telemetry[51] << 8) | telemetry[50];
-    config->cam1_area.area3.y.min = (telemetry[53] << 8) | telemetry[52];
-    config->cam1_area.area3.y.max = (telemetry[55] << 8) | telemetry[54];
-    config->cam1_area.area4.x.min = (telemetry[57] << 8) | telemetry[56];
-    config->cam1_area.area4.x.max = (telemetry[59] << 8) | telemetry[58];
-    config->cam1_area.area4.y.min = (telemetry[61] << 8) | telemetry[60];
-    config->cam1_area.area4.y.max = (telemetry[63] << 8) | telemetry[62];
-    config->cam1_area.area5.x.min = (telemetry[65] << 8) | telemetry[64];
-    config->cam1_area.area5.x.max = (telemetry[67] << 8) | telemetry[66];
-    config->cam1_area.area5.y.min = (telemetry[69] << 8) | telemetry[68];
-    config->cam1_area.area5.y.max = (telemetry[71] << 8) | telemetry[70];
-    config->cam2_area.area1.x.min = (telemetry[73] << 8) | telemetry[72];
-    config->cam2_area.area1.x.max = (telemetry[75] << 8) | telemetry[74];
-    config->cam2_area.area1.y.min = (telemetry[77] << 8) | telemetry[76];
-    config->cam2_area.area1.y.max = (telemetry[79] << 8) | telemetry[78];
-    config->cam2_area.area2.x.min = (telemetry[81] << 8) | telemetry[80];
-    config->cam2_area.area2.x.max = (telemetry[83] << 8) | telemetry[82];
-    config->cam2_area.area2.y.min = (telemetry[85] << 8) | telemetry[84];
-    config->cam2_area.area2.y.max = (telemetry[87] << 8) | telemetry[86];
-    config->cam2_area.area3.x.min = (telemetry[89] << 8) | telemetry[88];
-    config->cam2_area.area3.x.max = (telemetry[91] << 8) | telemetry[90];
-    config->cam2_area.area3.y.min = (telemetry[93] << 8) | telemetry[92];
-    config->cam2_area.area3.y.max = (telemetry[95] << 8) | telemetry[94];
-    config->cam2_area.area4.x.min = (telemetry[97] << 8) | telemetry[96];
-    config->cam2_area.area4.x.max = (telemetry[99] << 8) | telemetry[98];
-    config->cam2_area.area4.y.min = (telemetry[101] << 8) | telemetry[100];
-    config->cam2_area.area4.y.max = (telemetry[103] << 8) | telemetry[102];
-    config->cam2_area.area5.x.min = (telemetry[105] << 8) | telemetry[104];
-    config->cam2_area.area5.x.max = (telemetry[107] << 8) | telemetry[106];
-    config->cam2_area.area5.y.min = (telemetry[109] << 8) | telemetry[108];
-    config->cam2_area.area5.y.max = (telemetry[111] << 8) | telemetry[110];
-
+    state = adcs_telemetry_fields(GET_CUBESENSE_CONFIG_ID, telemetry, GET_CUBESENSE_CONFIG_LEN,
+                                  adcs_cubesense_fields, ADCS_CUBESENSE_FIELD_COUNT, config);
     vPortFree(telemetry);
-
     return state;
 }
 
@@ -2546,144 +2470,9 @@ ADCS_returnState ADCS_get_cubesense_config(cubesense_config *config) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_cubesense_config(cubesense_config params) {
-    uint8_t command[113];
-    if (command == NULL) {
-        return ADCS_MALLOC_FAILED;
-    }
-
-    command[0] = SET_CUBESENSE_CONFIG_ID;
-
-    xyz16 raw_val_angle1, raw_val_angle2;
-    uint16_t raw_boresight_x1, raw_boresight_y1;
-    uint16_t raw_boresight_x2, raw_boresight_y2;
-    float coef = 0.01;
-
-    raw_val_angle1.x = params.cam1_sense.mounting_angle.x / coef;
-    raw_val_angle1.y = params.cam1_sense.mounting_angle.y / coef;
-    raw_val_angle1.z = params.cam1_sense.mounting_angle.z / coef;
-    raw_boresight_x1 = params.cam1_sense.boresight_x / coef;
-    raw_boresight_y1 = params.cam1_sense.boresight_y / coef;
-    raw_val_angle2.x = params.cam2_sense.mounting_angle.x / coef;
-    raw_val_angle2.y = params.cam2_sense.mounting_angle.y / coef;
-    raw_val_angle2.z = params.cam2_sense.mounting_angle.z / coef;
-    raw_boresight_x2 = params.cam2_sense.boresight_x / coef;
-    raw_boresight_y2 = params.cam2_sense.boresight_y / coef;
-
-    command[1] = (raw_val_angle1.x) & 0x00FF;
-    command[2] = (raw_val_angle1.x >> 8) & 0x00FF;
-    command[3] = (raw_val_angle1.y) & 0x00FF;
-    command[4] = (raw_val_angle1.y >> 8) & 0x00FF;
-    command[5] = (raw_val_angle1.z) & 0x00FF;
-    command[6] = (raw_val_angle1.z >> 8) & 0x00FF;
-    command[7] = params.cam1_sense.detect_th;
-    command[8] = params.cam1_sense.auto_adjust;
-    command[9] = (params.cam1_sense.exposure_t) & 0x00FF;
-    command[10] = (params.cam1_sense.exposure_t >> 8) & 0x00FF;
-    command[11] = (raw_boresight_x1) & 0x00FF;
-    command[12] = (raw_boresight_x1 >> 8) & 0x00FF;
-    command[13] = (raw_boresight_y1) & 0x00FF;
-    command[14] = (raw_boresight_y1 >> 8) & 0x00FF;
-    command[15] = (raw_val_angle2.x) & 0x00FF;
-    command[16] = (raw_val_angle2.x >> 8) & 0x00FF;
-    command[17] = (raw_val_angle2.y) & 0x00FF;
-    command[18] = (raw_val_angle2.y >> 8) & 0x00FF;
-    command[19] = (raw_val_angle2.z) & 0x00FF;
-    command[20] = (raw_val_angle2.z >> 8) & 0x00FF;
-    command[21] = params.cam2_sense.detect_th;
-    command[22] = params.cam2_sense.auto_adjust;
-    command[23] = (params.cam2_sense.exposure_t) & 0x00FF;
-    command[24] = (params.cam2_sense.exposure_t >> 8) & 0x00FF;
-    command[25] = (raw_boresight_x2) & 0x00FF;
-    command[26] = (raw_boresight_x2 >> 8) & 0x00FF;
-    command[27] = (raw_boresight_y2) & 0x00FF;
-    command[28] = (raw_boresight_y2 >> 8) & 0x00FF;
-    command[29] = params.nadir_max_deviate;
-    command[30] = params.nadir_max_bad_edge;
-    command[31] = params.nadir_max_radius;
-    command[32] = params.nadir_min_radius;
-    command[33] = (params.cam1_area.area1.x.min) & 0x00FF;
-    command[34] = (params.cam1_area.area1.x.min >> 8) & 0x00FF;
-    command[35] = (params.cam1_area.area1.x.max) & 0x00FF;
-    command[36] = (params.cam1_area.area1.x.max >> 8) & 0x00FF;
-    command[37] = (params.cam1_area.area1.y.min ) & 0x00FF;
-    command[38] = (params.cam1_area.area1.y.min >> 8) & 0x00FF;
-    command[39] = (params.cam1_area.area1.y.max) & 0x00FF;
-    command[40] = (params.cam1_area.area1.y.max >> 8) & 0x00FF;
-    command[41] = (params.cam1_area.area2.x.min ) & 0x00FF;
-    command[42] = (params.cam1_area.area2.x.min >> 8) & 0x00FF;
-    command[43] = (params.cam1_area.area2.x.max ) & 0x00FF;
-    command[44] = (params.cam1_area.area2.x.max >> 8) & 0x00FF;
-    command[45] = (params.cam1_area.area2.y.min ) & 0x00FF;
-    command[46] = (params.cam1_area.area2.y.min >> 8) & 0x00FF;
-    command[47] = (params.cam1_area.area2.y.max ) & 0x00FF;
-    command[48] = (params.cam1_area.area2.y.max >> 8) & 0x00FF;
-    command[49] = (params.cam1_area.area3.x.min ) & 0x00FF;
-    command[50] = (params.cam1_area.area3.x.min >> 8) & 0x00FF;
-    command[51] = (params.cam1_area.area3.x.max  ) & 0x00FF;
-    command[52] = (params.cam1_area.area3.x.max >> 8) & 0x00FF;
-    command[53] = (params.cam1_area.area3.y.min ) & 0x00FF;
-    command[54] = (params.cam1_area.area3.y.min >> 8) & 0x00FF;
-    command[55] = (params.cam1_area.area3.y.max  ) & 0x00FF;
-    command[56] = (params.cam1_area.area3.y.max >> 8) & 0x00FF;
-    command[57] = (params.cam1_area.area4.x.min ) & 0x00FF;
-    command[58] = (params.cam1_area.area4.x.min >> 8) & 0x00FF;
-    command[59] = (params.cam1_area.area4.x.max ) & 0x00FF;
-    command[60] = (params.cam1_area.area4.x.max >> 8) & 0x00FF;
-    command[61] = (params.cam1_area.area4.y.min) & 0x00FF;
-    command[62] = (params.cam1_area.area4.y.min >> 8) & 0x00FF;
-    command[63] = (params.cam1_area.area4.y.max ) & 0x00FF;
-    command[64] = (params.cam1_area.area4.y.max >> 8) & 0x00FF;
-    command[65] = (params.cam1_area.area5.x.min ) & 0x00FF;
-    command[66] = (params.cam1_area.area5.x.min >> 8) & 0x00FF;
-    command[67] = (params.cam1_area.area5.x.max ) & 0x00FF;
-    command[68] = (params.cam1_area.area5.x.max >> 8) & 0x00FF;
-    command[69] = (params.cam1_area.area5.y.min ) & 0x00FF;
-    command[70] = (params.cam1_area.area5.y.min >> 8) & 0x00FF;
-    command[71] = (params.cam1_area.area5.y.max ) & 0x00FF;
-    command[72] = (params.cam1_area.area5.y.max >> 8) & 0x00FF;
-    command[73] = (params.cam2_area.area1.x.min ) & 0x00FF;
-    command[74] = (params.cam2_area.area1.x.min >> 8) & 0x00FF;
-    command[75] = (params.cam2_area.area1.x.max ) & 0x00FF;
-    command[76] = (params.cam2_area.area1.x.max >> 8) & 0x00FF;
-    command[77] = (params.cam2_area.area1.y.min ) & 0x00FF;
-    command[78] = (params.cam2_area.area1.y.min >> 8) & 0x00FF;
-    command[79] = (params.cam2_area.area1.y.max ) & 0x00FF;
-    command[80] = (params.cam2_area.area1.y.max >> 8) & 0x00FF;
-    command[81] = (params.cam2_area.area2.x.min ) & 0x00FF;
-    command[82] = (params.cam2_area.area2.x.min >> 8) & 0x00FF;
-    command[83] = (params.cam2_area.area2.x.max ) & 0x00FF;
-    command[84] = (params.cam2_area.area2.x.max >> 8) & 0x00FF;
-    command[85] = (params.cam2_area.area2.y.min ) & 0x00FF;
-    command[86] = (params.cam2_area.area2.y.min >> 8) & 0x00FF;
-    command[87] = (params.cam2_area.area2.y.max ) & 0x00FF;
-    command[88] = (params.cam2_area.area2.y.max >> 8) & 0x00FF;
-    command[89] = (params.cam2_area.area3.x.min ) & 0x00FF;
-    command[90] = (params.cam2_area.area3.x.min >> 8) & 0x00FF;
-    command[91] = (params.cam2_area.area3.x.max ) & 0x00FF;
-    command[92] = (params.cam2_area.area3.x.max >> 8) & 0x00FF;
-    command[93] = (params.cam2_area.area3.y.min ) & 0x00FF;
-    command[94] = (params.cam2_area.area3.y.min >> 8) & 0x00FF;
-    command[95] = (params.cam2_area.area3.y.max ) & 0x00FF;
-    command[96] = (params.cam2_area.area3.y.max >> 8) & 0x00FF;
-    command[97] = (params.cam2_area.area4.x.min ) & 0x00FF;
-    command[98] = (params.cam2_area.area4.x.min >> 8) & 0x00FF;
-    command[99] = (params.cam2_area.area4.x.max ) & 0x00FF;
-    command[100] = (params.cam2_area.area4.x.max >> 8) & 0x00FF;
-    command[101] = (params.cam2_area.area4.y.min ) & 0x00FF;
-    command[102] = (params.cam2_area.area4.y.min >> 8) & 0x00FF;
-    command[103] = (params.cam2_area.area4.y.max ) & 0x00FF;
-    command[104] = (params.cam2_area.area4.y.max >> 8) & 0x00FF;
-    command[105] = (params.cam2_area.area5.x.min ) & 0x00FF;
-    command[106] = (params.cam2_area.area5.x.min >> 8) & 0x00FF;
-    command[107] = (params.cam2_area.area5.x.max ) & 0x00FF;
-    command[108] = (params.cam2_area.area5.x.max >> 8) & 0x00FF;
-    command[109] = (params.cam2_area.area5.y.min ) & 0x00FF;
-    command[110] = (params.cam2_area.area5.y.min >> 8) & 0x00FF;
-    command[111] = (params.cam2_area.area5.y.max ) & 0x00FF;
-    command[112] = (params.cam2_area.area5.y.max >> 8) & 0x00FF;
-
-    ADCS_returnState result = adcs_telecommand(command, 113);
-    return result;
+    uint8_t command[1 + SET_CUBESENSE_CONFIG_LEN];
+    return adcs_telecommand_fields(SET_CUBESENSE_CONFIG_ID, command, sizeof(command), adcs_cubesense_fields,
+                                   ADCS_CUBESENSE_FIELD_COUNT, &params);
 }
 
 /**
@@ -2698,35 +2487,17 @@ ADCS_returnState ADCS_set_cubesense_config(cubesense_config params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_mtm_config(mtm_config params, uint8_t mtm) {
-    uint8_t command[31];
+    uint8_t TC_ID;
     if (mtm == 1) {
-        command[0] = SET_MTM_CONFIG_ID;
+        TC_ID = SET_MTM_CONFIG_ID;
     } else if (mtm == 2) {
-        command[0] = SET_MTM2_CONFIG_ID;
+        TC_ID = SET_MTM2_CONFIG_ID;
     } else {
         return ADCS_INVALID_PARAMETERS;
     }
-    xyz16 raw_val_angle, raw_val_offset;
-    float coef = 0.01;
-    raw_val_angle.x = params.mounting_angle.x / coef;
-    raw_val_angle.y = params.mounting_angle.y / coef;
-    raw_val_angle.z = params.mounting_angle.z / coef;
-    memcpy(&command[1], &raw_val_angle, 6);
-    coef = 0.001;
-    raw_val_offset.x = params.channel_offset.x / coef;
-    raw_val_offset.y = params.channel_offset.y / coef;
-    raw_val_offset.z = params.channel_offset.z / coef;
-    memcpy(&command[7], &raw_val_offset, 6);
-    int16_t cell[9];
-    for (int i = 0; i < 3; i++) {
-        cell[i] = params.sensitivity_mat[4 * i] / coef; // diagonal
-    }
-    for (int i = 0; i < 3; i++) {
-        cell[3 + i] = params.sensitivity_mat[1 + i] / coef;
-        cell[6 + i] = params.sensitivity_mat[5 + i] / coef;
-    }
-    memcpy(&command[13], &cell[0], 18);
-    return adcs_telecommand(command, 31);
+    uint8_t command[1 + SET_MTM_CONFIG_LEN];
+    return adcs_telecommand_fields(TC_ID, command, sizeof(command), adcs_mtm_fields, ADCS_MTM_FIELD_COUNT,
+                                   &params);
 }
 
 /**
@@ -2737,15 +2508,9 @@ ADCS_returnState ADCS_set_mtm_config(mtm_config params, uint8_t mtm) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_detumble_config(detumble_config config) {
-    uint8_t command[15];
-    command[0] = SET_DETUMBLE_PARAM_ID;
-    memcpy(&command[1], &config, 8);
-    int16_t raw_spin_rate;
-    float coef = 0.001;
-    raw_spin_rate = config.spin_rate / coef;
-    memcpy(&command[9], &raw_spin_rate, 2);
-    memcpy(&command[11], &config.fast_bDot, 4);
-    return adcs_telecommand(command, 15);
+    uint8_t command[1 + SET_DETUMBLE_PARAM_LEN];
+    return adcs_telecommand_fields(SET_DETUMBLE_PARAM_ID, command, sizeof(command), adcs_detumble_fields,
+                                   ADCS_DETUMBLE_FIELD_COUNT, &config);
 }
 
 /**
@@ -2756,10 +2521,9 @@ ADCS_returnState ADCS_set_detumble_config(detumble_config config) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_ywheel_config(ywheel_ctrl_config params) {
-    uint8_t command[21];
-    command[0] = SET_YWHEEL_CTRL_PARAM_ID;
-    memcpy(&command[1], &params, 20);
-    return adcs_telecommand(command, 21);
+    uint8_t command[1 + SET_YWHEEL_CTRL_PARAM_LEN];
+    return adcs_telecommand_fields(SET_YWHEEL_CTRL_PARAM_ID, command, sizeof(command), adcs_ywheel_fields,
+                                   ADCS_YWHEEL_FIELD_COUNT, &params);
 }
 
 /**
@@ -2770,11 +2534,9 @@ ADCS_returnState ADCS_set_ywheel_config(ywheel_ctrl_config params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_rwheel_config(rwheel_ctrl_config params) {
-    uint8_t command[14];
-    command[0] = SET_RWHEEL_CTRL_PARAM_ID;
-    memcpy(&command[1], &params, 12);
-    command[13] = (params.auto_transit << 7) | params.sun_point_facet;
-    return adcs_telecommand(command, 14);
+    uint8_t command[1 + SET_RWHEEL_CTRL_PARAM_LEN];
+    return adcs_telecommand_fields(SET_RWHEEL_CTRL_PARAM_ID, command, sizeof(command), adcs_rwheel_fields,
+                                   ADCS_RWHEEL_FIELD_COUNT, &params);
 }
 
 /**
@@ -2785,10 +2547,9 @@ ADCS_returnState ADCS_set_rwheel_config(rwheel_ctrl_config params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_tracking_config(track_ctrl_config params) {
-    uint8_t command[14];
-    command[0] = SET_TRACK_CTRL_ID;
-    memcpy(&command[1], &params, 13);
-    return adcs_telecommand(command, 14);
+    uint8_t command[1 + SET_TRACK_CTRL_LEN];
+    return adcs_telecommand_fields(SET_TRACK_CTRL_ID, command, sizeof(command), adcs_tracking_fields,
+                                   ADCS_TRACKING_FIELD_COUNT, &params);
 }
 
 /**
@@ -2802,33 +2563,24 @@ ADCS_returnState ADCS_set_tracking_config(track_ctrl_config params) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_MoI_mat(moment_inertia_config cell) {
-    uint8_t command[25];
-    command[0] = SET_MOMENT_INERTIA_MAT_ID;
-    memcpy(&command[1], &cell, 24);
-    return adcs_telecommand(command, 25);
+    uint8_t command[1 + SET_MOMENT_INERTIA_MAT_LEN];
+    return adcs_telecommand_fields(SET_MOMENT_INERTIA_MAT_ID, command, sizeof(command), adcs_moi_fields,
+                                   ADCS_MOI_FIELD_COUNT, &cell);
 }
 
 /**
  * @brief
  * 		Sets the estimation noise covariance and sensor mask.
  * 		(Table 200)
- * @param config.select_arr
- * 		All the bool "use" and auto-transit selects in Table 200
+ * @param config.select
+ * 		All the "use" and auto-transit selects in Table 200, named by adcs_estimation_flag
  * @return
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_estimation_config(estimation_config config) {
-    uint8_t command[32];
-    command[0] = SET_ESTIMATE_PARAM;
-    memcpy(&command[1], &config, 28);
-    command[29] = 0;
-    for (int i = 0; i < 6; i++) {
-        command[29] |= (config.select_arr[i] << i);
-    }
-    command[29] |= (config.MTM_mode << 6);
-    command[30] = config.MTM_select | (config.select_arr[7] << 2);
-    command[31] = config.cam_sample_period;
-    return adcs_telecommand(command, 32);
+    uint8_t command[1 + SET_ESTIMATE_PARAM_LEN];
+    return adcs_telecommand_fields(SET_ESTIMATE_PARAM, command, sizeof(command), adcs_estimation_fields,
+                                   ADCS_ESTIMATION_FIELD_COUNT, &config);
 }
 
 /**
@@ -2841,10 +2593,9 @@ ADCS_returnState ADCS_set_estimation_config(estimation_config config) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_set_usercoded_setting(usercoded_setting setting) {
-    uint8_t command[97];
-    command[0] = SET_USERCODED_PARAM_ID;
-    memcpy(&command[1], &setting, 96);
-    return adcs_telecommand(command, 97);
+    uint8_t command[1 + SET_USERCODED_PARAM_LEN];
+    return adcs_telecommand_fields(SET_USERCODED_PARAM_ID, command, sizeof(command), adcs_usercoded_fields,
+                                   ADCS_USERCODED_FIELD_COUNT, &setting);
 }
 
 /**
@@ -2860,44 +2611,9 @@ ADCS_returnState ADCS_set_asgp4_setting(aspg4_setting setting) {
         (setting.vel_sd < 0) | (setting.time_gain < 0) | (setting.max_lag < 0)) {
         return ADCS_INVALID_PARAMETERS;
     }
-    uint8_t command[31];
-    command[0] = SET_ASGP4_PARAM_ID;
-    float coef = 0.001;
-    uint16_t inclination = setting.inclination / coef;
-    memcpy(&command[1], &inclination, 2);
-    uint16_t RAAN = setting.RAAN / coef;
-    memcpy(&command[3], &RAAN, 2);
-    uint16_t ECC = setting.ECC / coef;
-    memcpy(&command[5], &ECC, 2);
-    uint16_t AoP = setting.AoP / coef;
-    memcpy(&command[7], &AoP, 2);
-    uint16_t time = setting.time / coef;
-    memcpy(&command[9], &time, 2);
-    uint16_t pos = setting.pos / coef;
-    memcpy(&command[11], &pos, 2);
-    coef = 0.1;
-    uint8_t max_pos_err = setting.max_pos_err / coef;
-    command[13] = max_pos_err;
-    command[14] = setting.asgp4_filter;
-    coef = 0.0000001;
-    int32_t xp = setting.xp / coef;
-    memcpy(&command[15], &xp, 4);
-    int32_t yp = setting.yp / coef;
-    memcpy(&command[19], &yp, 4);
-    command[23] = setting.gps_rollover;
-    coef = 0.1;
-    uint8_t pos_sd = setting.pos_sd / coef;
-    command[24] = pos_sd;
-    coef = 0.01;
-    uint8_t vel_sd = setting.vel_sd / coef;
-    command[25] = vel_sd;
-    command[26] = setting.min_sat;
-    uint8_t time_gain = setting.time_gain / coef;
-    command[27] = time_gain;
-    uint8_t max_lag = setting.max_lag / coef;
-    command[28] = max_lag;
-    memcpy(&command[29], &setting.min_samples, 2);
-    return adcs_telecommand(command, 31);
+    uint8_t command[1 + SET_ASGP4_PARAM_LEN];
+    return adcs_telecommand_fields(SET_ASGP4_PARAM_ID, command, sizeof(command), adcs_asgp4_setting_fields,
+                                   ADCS_ASGP4_SETTING_FIELD_COUNT, &setting);
 }
 
 /**
@@ -2909,84 +2625,12 @@ ADCS_returnState ADCS_set_asgp4_setting(aspg4_setting setting) {
  * 		Success of function defined in adcs_types.h
  */
 ADCS_returnState ADCS_get_full_config(adcs_config *config) {
-    uint8_t telemetry[504];
-    float coef;
+    uint8_t telemetry[GET_FULL_CONFIG_LEN];
     ADCS_returnState state;
-    state = adcs_telemetry(GET_FULL_CONFIG_ID, telemetry, 504);
-    memcpy(&config->MTQ, &telemetry[0], 3);
-    memcpy(&config->RW[0], &telemetry[3], 4);
-    memcpy(&config->rate_gyro, &telemetry[7], 3);
-    get_xyz(&config->rate_gyro.sensor_offset, &telemetry[10], 0.001);
-    config->rate_gyro.rate_sensor_mult = telemetry[16];
-    memcpy(&config->css, &telemetry[17], 10);
-    coef = 0.01;
-    for (int i = 0; i < 10; i++) {
-        config->css.rel_scale[i] = telemetry[27 + i] * coef;
-    }
-    config->css.threshold = telemetry[37];
-    get_xyz(&config->cubesense.cam1_sense.mounting_angle, &telemetry[38], 0.01);
-    config->cubesense.cam1_sense.detect_th = telemetry[44];
-    config->cubesense.cam1_sense.auto_adjust = telemetry[45] & 1;
-    memcpy(&config->cubesense.cam1_sense.exposure_t, &telemetry[46], 2);
-    config->cubesense.cam1_sense.boresight_x = ((telemetry[49] << 8) | telemetry[48]) * coef;
-    config->cubesense.cam1_sense.boresight_y = ((telemetry[51] << 8) | telemetry[50]) * coef;
-    get_xyz(&config->cubesense.cam2_sense.mounting_angle, &telemetry[52], 0.01);
-    config->cubesense.cam2_sense.detect_th = telemetry[58];
-    config->cubesense.cam2_sense.auto_adjust = telemetry[59] & 1;
-    memcpy(&config->cubesense.cam2_sense.exposure_t, &telemetry[60], 2);
-    config->cubesense.cam2_sense.boresight_x = ((telemetry[63] << 8) | telemetry[62]) * coef;
-    config->cubesense.cam2_sense.boresight_y = ((telemetry[65] << 8) | telemetry[64]) * coef;
-    memcpy(&config->cubesense.nadir_max_deviate, &telemetry[66], 84);
-    get_xyz(&config->MTM1.mounting_angle, &telemetry[150], 0.01);
-    get_xyz(&config->MTM1.channel_offset, &telemetry[156], 0.001);
-    get_3x3(config->MTM1.sensitivity_mat, &telemetry[162], 0.001);
-    get_xyz(&config->MTM2.mounting_angle, &telemetry[180], 0.01);
-    get_xyz(&config->MTM2.channel_offset, &telemetry[186], 0.001);
-    get_3x3(config->MTM2.sensitivity_mat, &telemetry[192], 0.001);
-    get_xyz(&config->star_tracker.mounting_angle, &telemetry[210], 0.01);
-    memcpy(&config->star_tracker.exposure_t, &telemetry[216], 45);
-    config->star_tracker.module_en = telemetry[261] & 0x1;
-    config->star_tracker.loc_predict_en = telemetry[261] & 0x2; // second bit
-    config->star_tracker.search_wid = telemetry[262] / 5;
-    memcpy(&config->detumble, &telemetry[263], 8);
-    coef = 0.001;
-    config->detumble.spin_rate = uint82int16(telemetry[271], telemetry[272]) * coef;
-    memcpy(&config->detumble.fast_bDot, &telemetry[273], 4);
-    memcpy(&config->ywheel, &telemetry[277], 20);
-    memcpy(&config->rwheel, &telemetry[297], 12);
-    config->rwheel.sun_point_facet = telemetry[309] & 0x7F; // 7 bits
-    config->rwheel.auto_transit = telemetry[309] & 0x80;    // 8th bit
-    memcpy(&config->tracking, &telemetry[310],
-           65); // tracking + MoI + partially estimation
-    for (int i = 0; i < 6; i++) {
-        config->estimation.select_arr[i] = (telemetry[375] >> i) & 1;
-    }
-    config->estimation.MTM_mode = (telemetry[375] >> 6) & 0x3;
-    config->estimation.MTM_select = telemetry[376] & 0x3;
-    config->estimation.select_arr[7] = (telemetry[376] >> 2) & 1;
-    config->estimation.cam_sample_period = telemetry[377];
-    coef = 0.001;
-    config->aspg4.inclination = ((telemetry[379] << 8) | telemetry[378]) * coef;
-    config->aspg4.RAAN = ((telemetry[381] << 8) | telemetry[380]) * coef;
-    config->aspg4.ECC = ((telemetry[383] << 8) | telemetry[382]) * coef;
-    config->aspg4.AoP = ((telemetry[385] << 8) | telemetry[384]) * coef;
-    config->aspg4.time = ((telemetry[387] << 8) | telemetry[386]) * coef;
-    config->aspg4.pos = ((telemetry[389] << 8) | telemetry[388]) * coef;
-    coef = 0.1;
-    config->aspg4.max_pos_err = telemetry[390] * coef;
-    config->aspg4.asgp4_filter = telemetry[391];
-    coef = 0.0000001;
-    config->aspg4.xp = uint82int32(&telemetry[392]) * coef;
-    config->aspg4.yp = uint82int32(&telemetry[396]) * coef;
-    config->aspg4.gps_rollover = telemetry[400];
-    coef = 0.1;
-    config->aspg4.pos_sd = telemetry[401] * coef;
-    coef = 0.01;
-    config->aspg4.vel_sd = telemetry[402] * coef;
-    config->aspg4.min_sat = telemetry[403];
-    config->aspg4.time_gain = telemetry[404] * coef;
-    config->aspg4.max_lag = telemetry[405] * coef;
-    config->aspg4.min_samples = (telemetry[407] << 8) | telemetry[406];
-    memcpy(&config->usercoded, &telemetry[408], 96);
+    state = adcs_telemetry_fields(GET_FULL_CONFIG_ID, telemetry, GET_FULL_CONFIG_LEN, adcs_full_config_fields,
+                                  ADCS_FULL_CONFIG_FIELD_COUNT, config);
+    if (state == ADCS_OK) {
+        config->star_tracker.search_wid = telemetry[262] / 5;
+    }
     return state;
 }
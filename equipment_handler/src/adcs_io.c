@@ -18,48 +18,495 @@
  */
 
 #include "adcs_io.h"
+#include "adcs_cursor.h"
+#include "adcs_deadline.h"
+#include "adcs_frame.h"
+#include "adcs_frames.h"
+#include "adcs_handler.h"
+#include "adcs_lane.h"
+#include "adcs_ring.h"
+#include "adcs_stats.h"
 #include "adcs_types.h"
 
 #include "FreeRTOS.h"
+#include "HL_i2c.h"
 #include "HL_sci.h"
-#include "i2c_io.h"
-#include "os_queue.h"
+#include "HL_sys_dma.h"
 #include "os_semphr.h"
 #include "os_task.h"
 #include "system.h"
 #include <stdbool.h>
 #include <string.h>
 
-#define ADCS_QUEUE_LENGTH 100
-#define ITEM_SIZE 1
+// Undefine to fall back to one receive interrupt per byte
+#define ADCS_UART_RX_DMA
 
-static QueueHandle_t adcsQueue;
+// Power of two; holds a full 504 byte config reply plus a run of burst packets if the task is preempted
+#define ADCS_RX_RING_SIZE 2048
+
+#if defined(ADCS_UART_RX_DMA)
+// DMA channel and request line depend on which SCI the ADCS is wired to (see device DMA request map)
+#ifndef ADCS_RX_DMA_CH
+#define ADCS_RX_DMA_CH DMA_CH0
+#endif
+#ifndef ADCS_RX_DMA_REQ
+#define ADCS_RX_DMA_REQ DMA_REQ28
+#endif
+
+#define ADCS_RX_HALF (ADCS_RX_RING_SIZE / 2)    // bytes between the half and full ring interrupts
+#define ADCS_RX_IDLE_MAX_TICKS pdMS_TO_TICKS(8) // longest sleep while waiting for a reply to start
+#define SCI_SET_RX_DMA (1U << 17)
+#define SCI_SET_RX_DMA_ALL (1U << 18)
+#else
 static uint8_t adcsBuffer;
+#endif
+
+// Undefine to read every I2C telemetry frame through the I2C driver
+#define ADCS_I2C_RX_DMA
+
+#if defined(ADCS_I2C_RX_DMA)
+#ifndef ADCS_I2C_RX_DMA_CH
+#define ADCS_I2C_RX_DMA_CH DMA_CH1
+#endif
+#ifndef ADCS_I2C_RX_DMA_REQ
+#define ADCS_I2C_RX_DMA_REQ DMA_REQ10
+#endif
+
+#define ADCS_I2C_DMA_MIN_LEN 16 // shorter frames finish before a DMA channel is set up
+#define I2C_RX_DMA_EN 1U
+#endif
+
+// Check the Communication Status after this many clean I2C telemetry reads
+#define ADCS_I2C_COMMS_CHECK_PERIOD 32
+
+static uint8_t adcs_rx_buffer[ADCS_RX_RING_SIZE];
+static adcs_ring rx_ring;
+
+// Wake-up for the task blocked in uart_rx_wait, given once rx_wake_count bytes are buffered
+static SemaphoreHandle_t rx_semphr;
+static volatile bool rx_waiting;
+static volatile uint32_t rx_wake_count;
+
+// End-of-message tracking, updated by whoever publishes bytes into the ring
+static bool rx_esc_pending;
+static volatile uint32_t rx_eom_pos; // ring position just after the newest ESC EOM
+
+#if defined(ADCS_UART_RX_DMA)
+static volatile uint32_t rx_dma_halves; // half and full ring interrupts of the receive channel since init
+#endif
+
+// Transmit arena: ESC SOM, body with every ESC doubled, ESC EOM
+static uint8_t tx_frame[ADCS_FRAME_ENCODED_MAX(ADCS_MAX_TC_LEN)];
+
+// UART transaction in progress: one deadline covers transmit and receive
+typedef struct {
+    uint8_t id;
+    TickType_t start;
+    TickType_t deadline;
+} uart_xfer;
+
+// Wire bytes of the UART transaction in progress, for adcs_stats
+static uint32_t xfer_sent;
+static uint32_t xfer_received;
+
 static SemaphoreHandle_t tx_semphr;
-static SemaphoreHandle_t uart_mutex;
+static adcs_lane_arbiter uart_lanes; // one transaction at a time, real-time requests first
+
+// The ADCS I2C bus is driven directly so the TM ID write and the read share one transaction
+static SemaphoreHandle_t i2c_mutex;
+static SemaphoreHandle_t i2c_dma_semphr;
+static uint32_t i2c_reads_unchecked;
+static bool i2c_suspect; // a read failed or the comms status reported an error
+
+/**
+ * @brief
+ *      Follow the ESC stuffing of the incoming stream so ESC EOM is only matched at a frame end
+ * @return
+ *      true if byte completed an end-of-message marker
+ */
+static bool uart_rx_track(uint8_t byte) {
+    if (rx_esc_pending) {
+        rx_esc_pending = false;
+        return byte == ADCS_EOM;
+    }
+    rx_esc_pending = (byte == ADCS_ESC_CHAR);
+    return false;
+}
+
+#if defined(ADCS_UART_RX_DMA)
+/**
+ * @brief
+ *      Configure a DMA channel to copy every received SCI byte into the receive ring.
+ * @details
+ *      The channel runs in auto-init mode so it wraps around the ring forever. Interrupts
+ *      are only raised at half and full ring, everything in between is picked up by
+ *      sampling the DMA write pointer.
+ */
+static void uart_rx_dma_init(void) {
+    g_dmaCTRL ctrl_pkt;
+
+#if ((__little_endian__ == 1) || (__LITTLE_ENDIAN__ == 1))
+    ctrl_pkt.SADD = (uint32)(&(ADCS_SCI->RD));
+#else
+    ctrl_pkt.SADD = (uint32)(&(ADCS_SCI->RD)) + 3; // received byte sits in the LSB of RD
+#endif
+    ctrl_pkt.DADD = (uint32)adcs_rx_buffer;
+    ctrl_pkt.CHCTRL = 0;
+    ctrl_pkt.FRCNT = ADCS_RX_RING_SIZE;
+    ctrl_pkt.ELCNT = 1;
+    ctrl_pkt.ELDOFFSET = 0;
+    ctrl_pkt.ELSOFFSET = 0;
+    ctrl_pkt.FRDOFFSET = 0;
+    ctrl_pkt.FRSOFFSET = 0;
+    ctrl_pkt.PORTASGN = PORTB_READ_PORTA_WRITE;
+    ctrl_pkt.RDSIZE = ACCESS_8_BIT;
+    ctrl_pkt.WRSIZE = ACCESS_8_BIT;
+    ctrl_pkt.TTYPE = FRAME_TRANSFER;
+    ctrl_pkt.ADDMODERD = ADDR_FIXED;
+    ctrl_pkt.ADDMODEWR = ADDR_INC1;
+    ctrl_pkt.AUTOINIT = AUTOINIT_ON;
+
+    dmaReqAssign(ADCS_RX_DMA_CH, ADCS_RX_DMA_REQ);
+    dmaSetCtrlPacket(ADCS_RX_DMA_CH, ctrl_pkt);
+    dmaEnableInterrupt(ADCS_RX_DMA_CH, HBC, DMA_INTA);
+    dmaEnableInterrupt(ADCS_RX_DMA_CH, BTC, DMA_INTA);
+    dmaSetChEnable(ADCS_RX_DMA_CH, DMA_HW);
+    ADCS_SCI->SETINT = SCI_SET_RX_DMA | SCI_SET_RX_DMA_ALL;
+}
+
+/**
+ * @brief
+ *      Publish whatever the DMA has written since the last call and scan it for end-of-message.
+ * @details
+ *      The DMA is the real producer but cannot move the ring head itself, so the consumer
+ *      does it on the DMA's behalf. Only ever called from task context.
+ *
+ *      The write pointer alone cannot tell one lap of the ring from several, so the count
+ *      of half and full ring interrupts gives the bytes written since init. If that is more
+ *      than a ring ahead of the reader, unread bytes were overwritten: the ring is flushed.
+ * @return
+ *      ADCS_UART_FAILED if the DMA lapped the reader, the frame being received is lost
+ */
+static ADCS_returnState uart_rx_sync(void) {
+    uint32_t addr = dmaRAMREG->WCP[ADCS_RX_DMA_CH].CDADDR;
+    uint32_t base = (uint32_t)adcs_rx_buffer;
+    if (addr < base || addr >= base + ADCS_RX_RING_SIZE) {
+        return ADCS_OK; // channel has not transferred anything yet
+    }
+    uint32_t pos = addr - base;
+    uint32_t halves = rx_dma_halves;
+    if ((halves & 1) != pos / ADCS_RX_HALF) {
+        halves++; // the pointer crossed into the other half, its interrupt is not served yet
+    }
+    uint32_t written = halves * ADCS_RX_HALF + pos % ADCS_RX_HALF;
+    uint32_t head = rx_ring.head;
+
+    if (written - rx_ring.tail > ADCS_RX_RING_SIZE) {
+        adcs_ring_produced(&rx_ring, written - head);
+        adcs_ring_flush(&rx_ring);
+        rx_esc_pending = false;
+        rx_eom_pos = rx_ring.tail;
+        return ADCS_UART_FAILED;
+    }
+    uint32_t fresh = written - head;
+    for (uint32_t i = 0; i < fresh; i++) {
+        if (uart_rx_track(adcs_rx_buffer[(head + i) & rx_ring.mask])) {
+            rx_eom_pos = head + i + 1;
+        }
+    }
+    adcs_ring_produced(&rx_ring, fresh);
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      How long a waiter for missing more bytes sleeps before sampling the DMA write pointer
+ * @details
+ *      The SCI has no idle-line interrupt, so the sleep is the wire time of the missing
+ *      bytes. While nothing arrives, e.g. before the ADCS starts replying, it doubles up to
+ *      ADCS_RX_IDLE_MAX_TICKS. The half and full ring interrupts end it early.
+ * @param idle
+ *      Previous sleep if it brought no bytes, otherwise 0
+ */
+static TickType_t uart_rx_sleep_ticks(uint32_t missing, TickType_t idle) {
+    TickType_t wire = pdMS_TO_TICKS((missing * 10 * 1000 + ADCS_UART_BAUD - 1) / ADCS_UART_BAUD);
+    TickType_t backoff = (2 * idle < ADCS_RX_IDLE_MAX_TICKS) ? 2 * idle : ADCS_RX_IDLE_MAX_TICKS;
+    TickType_t sleep = (wire > backoff) ? wire : backoff;
+    return (sleep > 0) ? sleep : 1;
+}
+#else
+static ADCS_returnState uart_rx_sync(void) { return ADCS_OK; }
+
+// Every byte interrupts and the ISR wakes the waiter once its condition holds, the sleep is only a backstop
+static TickType_t uart_rx_sleep_ticks(uint32_t missing, TickType_t idle) {
+    (void)missing;
+    (void)idle;
+    return pdMS_TO_TICKS(UART_TIMEOUT_MS);
+}
+#endif
+
+/**
+ * @brief
+ *      Ticks left until deadline, 0 once it has passed
+ */
+static TickType_t ticks_left(TickType_t deadline) {
+    int32_t left = (int32_t)(deadline - xTaskGetTickCount());
+    return (left > 0) ? (TickType_t)left : 0;
+}
+
+/**
+ * @brief
+ *      Block until the ring holds at least count unread bytes or a complete message
+ * @details
+ *      The waiting task sleeps on rx_semphr until count bytes are buffered or an
+ *      end-of-message arrives, or the transaction deadline passes. With the receive DMA it
+ *      is woken by the half and full ring interrupts and otherwise samples the write pointer
+ *      once the missing bytes can have arrived, see uart_rx_sleep_ticks.
+ * @return
+ *      ADCS_UART_FAILED on timeout or if the DMA lapped the reader
+ */
+static ADCS_returnState uart_rx_wait(uint32_t count, TickType_t deadline) {
+    ADCS_returnState state = uart_rx_sync();
+    uint32_t seen = adcs_ring_count(&rx_ring);
+    TickType_t sleep = 0;
+
+    while (state == ADCS_OK && adcs_ring_count(&rx_ring) < count &&
+           (int32_t)(rx_eom_pos - rx_ring.tail) <= 0) {
+        TickType_t left = ticks_left(deadline);
+        if (left == 0) {
+            return ADCS_UART_FAILED;
+        }
+        uint32_t have = adcs_ring_count(&rx_ring);
+        sleep = uart_rx_sleep_ticks(count - have, (have == seen) ? sleep : 0);
+        seen = have;
+
+        rx_wake_count = count;
+        rx_waiting = true;
+        state = uart_rx_sync();
+        if (state == ADCS_OK && adcs_ring_count(&rx_ring) < count) {
+            xSemaphoreTake(rx_semphr, (left < sleep) ? left : sleep);
+        }
+        rx_waiting = false;
+        if (state == ADCS_OK) {
+            state = uart_rx_sync();
+        }
+    }
+    return state;
+}
+
+/**
+ * @brief
+ *      Discard anything left in the ring from an earlier transaction
+ */
+static void uart_rx_flush(void) {
+    (void)uart_rx_sync(); // a lap only loses bytes that are being dropped anyway
+    adcs_ring_flush(&rx_ring);
+    rx_eom_pos = rx_ring.tail;
+    xSemaphoreTake(rx_semphr, 0); // drop a wake-up given after the last wait timed out
+}
+
+/**
+ * @brief
+ *      Feed the ring to parser until it reports anything but ADCS_FRAME_INCOMPLETE
+ * @param needed
+ *      Bytes still expected for the frame, ignoring stuffing, used to size wake-ups
+ */
+static ADCS_returnState uart_rx_parse(adcs_frame_parser *parser, uint32_t *needed, TickType_t deadline,
+                                      ADCS_frameState *frame) {
+    for (;;) {
+        const uint8_t *data;
+        uint32_t consumed;
+
+        ADCS_returnState state = uart_rx_sync();
+        if (state != ADCS_OK) {
+            return state;
+        }
+        uint32_t available = adcs_ring_peek(&rx_ring, &data);
+        if (available == 0) {
+            state = uart_rx_wait(*needed, deadline);
+            if (state != ADCS_OK) {
+                return state;
+            }
+            continue;
+        }
+
+        *frame = adcs_frame_parse(parser, data, available, &consumed);
+        adcs_ring_read(&rx_ring, NULL, consumed);
+        xfer_received += consumed;
+        *needed = (*needed > consumed) ? *needed - consumed : 1;
+        if (*frame != ADCS_FRAME_INCOMPLETE) {
+            return ADCS_OK;
+        }
+    }
+}
+
+/**
+ * @brief
+ *      Receive one frame, de-stuffing it straight from the ring into the caller's buffer
+ * @details
+ *      Bytes are parsed as they arrive, so the frame completes as soon as ESC EOM is on
+ *      the wire and a reply of the wrong length is rejected without waiting for a timeout.
+ *      Leading garbage and frames with another ID are skipped.
+ * @param id
+ *      Expected TC/TM ID of the frame
+ * @param payload
+ *      Where the payload (bytes after the ID) is written
+ * @param length
+ *      Expected payload length
+ * @param deadline
+ *      Tick count by which the frame must be complete
+ */
+static ADCS_returnState uart_rx_frame(uint8_t id, uint8_t *payload, uint32_t length, TickType_t deadline) {
+    adcs_frame_parser parser;
+    uint32_t needed = length + 5;
+    adcs_frame_parser_init(&parser, payload, length);
+
+    for (;;) {
+        ADCS_frameState frame;
+        ADCS_returnState state = uart_rx_parse(&parser, &needed, deadline, &frame);
+        if (state != ADCS_OK) {
+            return state;
+        }
+
+        if (parser.id != id) {
+            // A download packet that was still streaming when this request took the link (dropping
+            // it leaves a hole the download re-requests), or the late reply to an earlier
+            // transaction that timed out. One longer than payload overflows part way through, so
+            // it is drained to its own end rather than parsed afresh from the middle.
+            if (frame == ADCS_FRAME_OVERFLOW) {
+                adcs_frame_parser_skip(&parser);
+            } else {
+                adcs_frame_parser_init(&parser, payload, length);
+            }
+            continue;
+        }
+        if (frame == ADCS_FRAME_OVERFLOW) {
+            return ADCS_INCORRECT_LENGTH;
+        }
+        return (parser.length == length) ? ADCS_OK : ADCS_INCORRECT_LENGTH;
+    }
+}
+
+/**
+ * @brief
+ *      Receive one download burst packet, placing its data directly at its offset in the block
+ * @details
+ *      The parser stops after the 2 byte packet counter, and the rest of the frame is de-stuffed
+ *      from the ring straight into image. Packets already in the hole map, or beyond length
+ *      bytes, are not written so a damaged repeat cannot spoil data that arrived intact.
+ * @param hole_map
+ *      ADCS_HOLE_MAP_LEN byte map, bit n of byte n / 8 is set once packet n has arrived
+ * @param image
+ *      Download block being assembled
+ * @param length
+ *      Size of image in bytes, at most ADCS_DL_BLOCK_LEN
+ * @param added
+ *      Set if the packet filled a hole, cleared for a repeat or one beyond length
+ */
+static ADCS_returnState uart_rx_packet(uint8_t *hole_map, uint8_t *image, uint32_t length, TickType_t deadline,
+                                       bool *added) {
+    adcs_frame_parser parser;
+    uint8_t counter[2];
+    uint32_t needed = 2 + ADCS_DL_PACKET_LEN + 5;
+    uint16_t packet = 0;
+    bool placed = false;
+
+    *added = false;
+    adcs_frame_parser_init(&parser, counter, sizeof(counter));
+    adcs_frame_parser_split(&parser);
+
+    for (;;) {
+        ADCS_frameState frame;
+        ADCS_returnState state = uart_rx_parse(&parser, &needed, deadline, &frame);
+        if (state != ADCS_OK) {
+            return state;
+        }
+
+        if (frame == ADCS_FRAME_SPLIT) {
+            uint32_t offset;
+            adcs_reader tm = adcs_reader_init(counter, sizeof(counter));
+            packet = adcs_get_u16(&tm);
+            offset = (uint32_t)packet * ADCS_DL_PACKET_LEN;
+            placed = (parser.id == FILE_DL_BUFFER_ID && offset < length &&
+                      !((hole_map[packet / 8] >> (packet % 8)) & 1));
+            if (placed) {
+                uint32_t room = length - offset;
+                adcs_frame_parser_set_tail(&parser, image + offset,
+                                           (room < ADCS_DL_PACKET_LEN) ? room : ADCS_DL_PACKET_LEN);
+            }
+            continue;
+        }
+
+        if (parser.id != FILE_DL_BUFFER_ID) {
+            return ADCS_INVALID_ID;
+        }
+        if (parser.length != 2 + ADCS_DL_PACKET_LEN) {
+            return ADCS_INCORRECT_LENGTH; // short packet, its bytes stay a hole
+        }
+        if (placed) {
+            hole_map[packet / 8] |= 1 << (packet % 8);
+        }
+        *added = placed;
+        return ADCS_OK;
+    }
+}
 
 /**
  * @Brief
  *      Initialize ADCS driver
  */
 void init_adcs_io() {
-    sciSetBaudrate(ADCS_SCI, 115200);
+    sciSetBaudrate(ADCS_SCI, ADCS_UART_BAUD);
     tx_semphr = xSemaphoreCreateBinary();
-    adcsQueue = xQueueCreate(ADCS_QUEUE_LENGTH, ITEM_SIZE);
-    uart_mutex = xSemaphoreCreateMutex();
+    adcs_lane_init(&uart_lanes);
+    i2c_mutex = xSemaphoreCreateMutex();
+    i2c_dma_semphr = xSemaphoreCreateBinary();
+    rx_semphr = xSemaphoreCreateBinary();
+    i2c_reads_unchecked = 0;
+    i2c_suspect = false;
+    adcs_ring_init(&rx_ring, adcs_rx_buffer, ADCS_RX_RING_SIZE);
+    rx_waiting = false;
+    rx_esc_pending = false;
+    rx_eom_pos = 0;
+#if defined(ADCS_UART_RX_DMA)
+    rx_dma_halves = 0;
+    uart_rx_dma_init();
+#else
     adcsBuffer = 0;
     sciReceive(ADCS_SCI, 1, &adcsBuffer);
+#endif
+#if defined(ADCS_I2C_RX_DMA)
+    dmaReqAssign(ADCS_I2C_RX_DMA_CH, ADCS_I2C_RX_DMA_REQ);
+    dmaEnableInterrupt(ADCS_I2C_RX_DMA_CH, BTC, DMA_INTA);
+#endif
+
+    adcs_register_transport(ADCS_TRANSPORT_UART, &adcs_uart_transport);
+    adcs_register_transport(ADCS_TRANSPORT_I2C, &adcs_i2c_transport);
+    adcs_register_transport(ADCS_TRANSPORT_LOOPBACK, &adcs_loopback_transport);
+    adcs_select_transport(ADCS_DEFAULT_TRANSPORT);
 }
 
 void adcs_sciNotification(sciBASE_t *sci, int flags) {
     portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 
     switch (flags) {
-    case SCI_RX_INT:
-        xQueueSendToBackFromISR(adcsQueue, &adcsBuffer, &xHigherPriorityTaskWoken);
+#if !defined(ADCS_UART_RX_DMA)
+    case SCI_RX_INT: {
+        bool eom = uart_rx_track(adcsBuffer);
+        adcs_ring_put(&rx_ring, adcsBuffer); // a full ring drops the byte, the frame then times out
+        if (eom) {
+            rx_eom_pos = rx_ring.head;
+        }
         sciReceive(sci, 1, &adcsBuffer);
+        // Wake the waiting task only once enough bytes, or a whole message, have arrived
+        if (rx_waiting && (eom || adcs_ring_count(&rx_ring) >= rx_wake_count)) {
+            rx_waiting = false;
+            xSemaphoreGiveFromISR(rx_semphr, &xHigherPriorityTaskWoken);
+        }
         portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
         break;
+    }
+#endif
     case SCI_TX_INT:
         xSemaphoreGiveFromISR(tx_semphr, &xHigherPriorityTaskWoken);
         portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
@@ -69,6 +516,59 @@ void adcs_sciNotification(sciBASE_t *sci, int flags) {
     }
 }
 
+/**
+ * @brief
+ *      Start a UART transaction, called with the link held
+ * @param wire_bytes
+ *      Bytes to send plus bytes expected back, sizes the deadline
+ */
+static void uart_xfer_begin(uart_xfer *xfer, uint8_t id, uint32_t wire_bytes) {
+    xfer_sent = 0;
+    xfer_received = 0;
+    xfer->id = id;
+    xfer->start = xTaskGetTickCount();
+    xfer->deadline = xfer->start + pdMS_TO_TICKS(adcs_deadline_budget_ms(id, wire_bytes));
+}
+
+/**
+ * @brief
+ *      Record the finished transaction against its TC/TM ID, called with the link held
+ */
+static void uart_xfer_end(const uart_xfer *xfer, ADCS_returnState state) {
+    uint32_t rtt_ms = (xTaskGetTickCount() - xfer->start) * portTICK_PERIOD_MS;
+    adcs_stats_record(xfer->id, xfer_sent, xfer_received, rtt_ms, state == ADCS_UART_FAILED);
+    if (state == ADCS_UART_FAILED) {
+        adcs_deadline_expired(xfer->id);
+    } else {
+        adcs_deadline_observe(xfer->id, rtt_ms);
+    }
+}
+
+/**
+ * @brief
+ *      Frame a message in the static transmit arena and send it
+ * @details
+ *      Header, stuffed body and trailer are gathered into tx_frame so the whole
+ *      frame goes out in a single interrupt-driven transfer without touching the heap.
+ *      Must be called with the link held.
+ * @param body
+ *      TC/TM ID followed by any parameters
+ * @param length
+ *      Length of body (at most ADCS_MAX_TC_LEN)
+ * @param deadline
+ *      Tick count by which the transfer must have completed
+ */
+static ADCS_returnState uart_tx_frame(const uint8_t *body, uint32_t length, TickType_t deadline) {
+    uint32_t pos = adcs_frame_encode(tx_frame, body, length);
+
+    xfer_sent += pos;
+    sciSend(ADCS_SCI, pos, tx_frame);
+    if (xSemaphoreTake(tx_semphr, ticks_left(deadline)) != pdTRUE) {
+        return ADCS_UART_FAILED;
+    }
+    return ADCS_OK;
+}
+
 /**
  * @brief
  * 		Send telecommand via UART protocol
@@ -79,38 +579,325 @@ void adcs_sciNotification(sciBASE_t *sci, int flags) {
  *
  */
 ADCS_returnState send_uart_telecommand(uint8_t *command, uint32_t length) {
-    if(xSemaphoreTake(uart_mutex, UART_TIMEOUT_MS) != pdTRUE) {
-          return ADCS_UART_FAILED;
-    } //  TODO: create response if it times out.
-
-    uint8_t *frame = (uint8_t *)pvPortMalloc(sizeof(uint8_t)*(length+4));
-    *frame = ADCS_ESC_CHAR;
-    *(frame+1) = ADCS_SOM;
-    memcpy((frame+2), command, length);
-    *(frame+length+2) = ADCS_ESC_CHAR;
-    *(frame+length+3) = ADCS_EOM;
+    if (length == 0 || length > ADCS_MAX_TC_LEN) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    if (!adcs_lane_acquire(&uart_lanes, adcs_lane_of(command[0]), pdMS_TO_TICKS(UART_TIMEOUT_MS))) {
+        return ADCS_UART_FAILED;
+    }
 
     // Note TC_ID here is included in the command
-    sciSend(ADCS_SCI, length+4, frame);
-    if(xSemaphoreTake(tx_semphr, UART_TIMEOUT_MS) != pdTRUE) {
+    uart_rx_flush();
+    uart_xfer xfer;
+    uart_xfer_begin(&xfer, command[0], (length + 4) + 6);
+    ADCS_returnState state = uart_tx_frame(command, length, xfer.deadline);
+
+    // Reply is ESC SOM TC_ID <TC error flag> ESC EOM
+    uint8_t reply = 1;
+    if (state == ADCS_OK) {
+        state = uart_rx_frame(command[0], &reply, 1, xfer.deadline);
+    }
+    uart_xfer_end(&xfer, state);
+    adcs_lane_release(&uart_lanes);
+
+    if (state != ADCS_OK) {
+        return state;
+    }
+    ADCS_returnState TC_err_flag = (ADCS_returnState) reply;
+    return TC_err_flag;
+}
+
+/**
+ * @brief
+ *      Send up to ADCS_TC_WINDOW telecommands back to back, then collect their acknowledges
+ * @details
+ *      The ADCS acknowledges UART telecommands in the order it receives them, so each frame
+ *      can go out while the one before is still being processed; the acknowledges queue in
+ *      the receive ring meanwhile. The link is held for the whole window.
+ * @param commands
+ *      count telecommands of length bytes each (TC ID included), back to back
+ * @return
+ *      ADCS_OK if every telecommand was acknowledged without error, otherwise the first failure
+ */
+ADCS_returnState send_uart_telecommands(uint8_t *commands, uint32_t length, uint32_t count) {
+    if (length == 0 || length > ADCS_MAX_TC_LEN || count == 0 || count > ADCS_TC_WINDOW) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    if (!adcs_lane_acquire(&uart_lanes, adcs_lane_of(commands[0]), pdMS_TO_TICKS(UART_TIMEOUT_MS))) {
+        return ADCS_UART_FAILED;
+    }
+
+    // Each telecommand gets the deadline of a single one, counted from when its frame starts out
+    uart_rx_flush();
+    uart_xfer xfer;
+    uart_xfer_begin(&xfer, commands[0], (length + 4) + 6);
+    TickType_t budget = xfer.deadline - xfer.start;
+    TickType_t started[ADCS_TC_WINDOW];
+    ADCS_returnState state = ADCS_OK;
+    uint32_t sent = 0;
+    while (state == ADCS_OK && sent < count) {
+        started[sent] = xTaskGetTickCount();
+        state = uart_tx_frame(&commands[sent * length], length, started[sent] + budget);
+        sent += (state == ADCS_OK);
+    }
+
+    // Reply to each is ESC SOM TC_ID <TC error flag> ESC EOM, in order
+    ADCS_returnState result = state;
+    uint32_t acked = 0;
+    while (acked < sent) {
+        uint8_t reply = 1;
+        state = uart_rx_frame(commands[acked * length], &reply, 1, started[acked] + budget);
+        if (state != ADCS_OK) {
+            break;
+        }
+        if (result == ADCS_OK) {
+            result = (ADCS_returnState)reply;
+        }
+        acked++;
+    }
+
+    // The last acknowledge is waited for like a single telecommand's, so that round trip is the
+    // one timed. Acknowledges missing after others came back are lost frames, not a slower ADCS.
+    xfer.start = started[(sent > 0) ? sent - 1 : 0];
+    if (acked > 0 && acked < sent) {
+        uint32_t rtt_ms = (xTaskGetTickCount() - xfer.start) * portTICK_PERIOD_MS;
+        adcs_stats_record(xfer.id, xfer_sent, xfer_received, rtt_ms, false);
+    } else {
+        uart_xfer_end(&xfer, state);
+    }
+    adcs_lane_release(&uart_lanes);
+
+    return (state != ADCS_OK) ? state : result;
+}
+
+/**
+ * @brief
+ *      Wait for a bit in the I2C status register, giving up on NACK, lost arbitration or the deadline
+ * @param poll_ticks
+ *      0 to spin for events a byte time away, otherwise how long to sleep between checks
+ */
+static bool i2c_wait_status(uint32_t flag, TickType_t poll_ticks, TickType_t deadline) {
+    while ((ADCS_I2C->STR & flag) == 0) {
+        if ((ADCS_I2C->STR & (I2C_NACK_INT | I2C_AL_INT)) != 0 || ticks_left(deadline) == 0) {
+            return false;
+        }
+        if (poll_ticks == 0) {
+            taskYIELD();
+        } else {
+            vTaskDelay(poll_ticks);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief
+ *      Release the bus after a failed transfer
+ */
+static void i2c_abort(void) {
+    i2cSetStop(ADCS_I2C);
+    ADCS_I2C->STR = I2C_NACK_INT | I2C_AL_INT; // write one to clear
+    i2cClearSCD(ADCS_I2C);
+}
+
+#if defined(ADCS_I2C_RX_DMA)
+/**
+ * @brief
+ *      Point the I2C receive DMA channel at buffer for one length byte transfer
+ * @details
+ *      The receive interrupt is masked meanwhile so the driver's ISR does not race the DMA for DRR.
+ */
+static void i2c_rx_dma_start(uint8_t *buffer, uint32_t length) {
+    g_dmaCTRL ctrl_pkt;
+
+#if ((__little_endian__ == 1) || (__LITTLE_ENDIAN__ == 1))
+    ctrl_pkt.SADD = (uint32)(&(ADCS_I2C->DRR));
+#else
+    ctrl_pkt.SADD = (uint32)(&(ADCS_I2C->DRR)) + 3; // received byte sits in the LSB of DRR
+#endif
+    ctrl_pkt.DADD = (uint32)buffer;
+    ctrl_pkt.CHCTRL = 0;
+    ctrl_pkt.FRCNT = length;
+    ctrl_pkt.ELCNT = 1;
+    ctrl_pkt.ELDOFFSET = 0;
+    ctrl_pkt.ELSOFFSET = 0;
+    ctrl_pkt.FRDOFFSET = 0;
+    ctrl_pkt.FRSOFFSET = 0;
+    ctrl_pkt.PORTASGN = PORTB_READ_PORTA_WRITE;
+    ctrl_pkt.RDSIZE = ACCESS_8_BIT;
+    ctrl_pkt.WRSIZE = ACCESS_8_BIT;
+    ctrl_pkt.TTYPE = FRAME_TRANSFER;
+    ctrl_pkt.ADDMODERD = ADDR_FIXED;
+    ctrl_pkt.ADDMODEWR = ADDR_INC1;
+    ctrl_pkt.AUTOINIT = AUTOINIT_OFF;
+
+    xSemaphoreTake(i2c_dma_semphr, 0); // drop a completion left by an earlier timed out transfer
+    i2cDisableNotification(ADCS_I2C, I2C_RX_INT);
+    dmaSetCtrlPacket(ADCS_I2C_RX_DMA_CH, ctrl_pkt);
+    dmaSetChEnable(ADCS_I2C_RX_DMA_CH, DMA_HW);
+    ADCS_I2C->DMACR = I2C_RX_DMA_EN;
+}
+
+static void i2c_rx_dma_stop(void) {
+    ADCS_I2C->DMACR = 0;
+    i2cEnableNotification(ADCS_I2C, I2C_RX_INT);
+}
+#endif
+
+#if defined(ADCS_UART_RX_DMA) || defined(ADCS_I2C_RX_DMA)
+void adcs_dmaNotification(dmaInterrupt_t inttype, uint32 channel) {
+    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+
+#if defined(ADCS_UART_RX_DMA)
+    if (channel == ADCS_RX_DMA_CH && (inttype == HBC || inttype == BTC)) {
+        rx_dma_halves++; // counted even with no waiter, uart_rx_sync needs it to spot a lap
+        if (rx_waiting) {
+            xSemaphoreGiveFromISR(rx_semphr, &xHigherPriorityTaskWoken);
+        }
+    }
+#endif
+#if defined(ADCS_I2C_RX_DMA)
+    if (channel == ADCS_I2C_RX_DMA_CH && inttype == BTC) {
+        xSemaphoreGiveFromISR(i2c_dma_semphr, &xHigherPriorityTaskWoken);
+    }
+#endif
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+#endif
+
+/**
+ * @brief
+ *      Write a whole telecommand frame in one transaction, called with i2c_mutex held
+ */
+static ADCS_returnState i2c_write_frame(uint8_t *command, uint32_t length) {
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(ADCS_I2C_TIMEOUT_MS);
+
+    i2cSetSlaveAdd(ADCS_I2C, ADCS_I2C_ADDR);
+    i2cSetDirection(ADCS_I2C, I2C_TRANSMITTER);
+    i2cSetCount(ADCS_I2C, length);
+    i2cSetMode(ADCS_I2C, I2C_MASTER);
+    i2cSetStop(ADCS_I2C);
+    i2cSetStart(ADCS_I2C);
+    i2cSend(ADCS_I2C, length, command);
+
+    if (!i2c_wait_status(I2C_SCD_INT, 1, deadline)) {
+        i2c_abort();
         return ADCS_UART_FAILED;
-    } // TODO: create response if it times out.
+    }
+    i2cClearSCD(ADCS_I2C);
+    return ADCS_OK;
+}
 
-    int received = 0;
-    uint8_t reply[6] = {1};
+/**
+ * @brief
+ *      Read a telemetry frame: write TM_ID, then a repeated start reads length bytes and stops.
+ *      Called with i2c_mutex held.
+ * @details
+ *      Frames of at least ADCS_I2C_DMA_MIN_LEN bytes are moved by DMA, the task sleeps until
+ *      the block completes.
+ */
+static ADCS_returnState i2c_read_frame(uint8_t TM_ID, uint8_t *telemetry, uint32_t length) {
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(ADCS_I2C_TIMEOUT_MS);
+    bool ok = true;
 
-    xQueueReset(adcsQueue);
+    // No stop after the ID, so the bus is kept for the read
+    i2cSetSlaveAdd(ADCS_I2C, ADCS_I2C_ADDR);
+    i2cSetDirection(ADCS_I2C, I2C_TRANSMITTER);
+    i2cSetCount(ADCS_I2C, 1);
+    i2cSetMode(ADCS_I2C, I2C_MASTER);
+    i2cSetStart(ADCS_I2C);
+    i2cSend(ADCS_I2C, 1, &TM_ID);
+    if (!i2c_wait_status(I2C_ARDY_INT, 0, deadline)) {
+        i2c_abort();
+        return ADCS_UART_FAILED;
+    }
+
+    i2cSetDirection(ADCS_I2C, I2C_RECEIVER);
+    i2cSetCount(ADCS_I2C, length);
+    i2cSetMode(ADCS_I2C, I2C_MASTER);
+    i2cSetStop(ADCS_I2C);
+#if defined(ADCS_I2C_RX_DMA)
+    if (length >= ADCS_I2C_DMA_MIN_LEN) {
+        i2c_rx_dma_start(telemetry, length);
+        i2cSetStart(ADCS_I2C);
+        ok = (xSemaphoreTake(i2c_dma_semphr, ticks_left(deadline)) == pdTRUE);
+        i2c_rx_dma_stop();
+    } else
+#endif
+    {
+        i2cSetStart(ADCS_I2C);
+        i2cReceive(ADCS_I2C, length, telemetry);
+    }
+
+    if (!ok || !i2c_wait_status(I2C_SCD_INT, 1, deadline)) {
+        i2c_abort();
+        return ADCS_UART_FAILED;
+    }
+    i2cClearSCD(ADCS_I2C);
+    return ADCS_OK;
+}
 
-    while (received < 6) {
-        if(xQueueReceive(adcsQueue, reply+received, UART_TIMEOUT_MS) == pdFAIL){
+/**
+ * @brief
+ *      Read the Communication Status and check its I2C telemetry error flag, called with i2c_mutex held
+ * @details
+ *      The flag is set when a telemetry read did not match the frame length (CubeADCS Firmware
+ *      Manual section 5.3.1) and clears once read, so it covers every read since the last check.
+ */
+static ADCS_returnState i2c_check_comms(void) {
+    uint8_t comms[COMMS_STAT_LEN];
+    ADCS_returnState state = i2c_read_frame(COMMS_STAT_ID, comms, COMMS_STAT_LEN);
+    if (state != ADCS_OK) {
+        return state;
+    }
+    uint16_t tc_count, tm_count;
+    adcs_comms_flags flags;
+    state = adcs_decode_comms_stat(comms, sizeof(comms), &tc_count, &tm_count, &flags);
+    if (state != ADCS_OK) {
+        return state;
+    }
+    return adcs_bitset_test(flags.word, ADCS_COMMS_I2C_TM_ERR) ? ADCS_INCORRECT_LENGTH : ADCS_OK;
+}
+
+// Delay before each TC acknowledge poll, the last entry repeats until ADCS_I2C_ACK_TIMEOUT_MS
+static const uint16_t i2c_ack_backoff_ms[] = ADCS_I2C_ACK_BACKOFF_MS;
+
+/**
+ * @brief
+ *      Poll the TC Acknowledge telemetry until the ADCS reports command id processed
+ * @details
+ *      The task sleeps between polls so the bus and CPU are free for others while the
+ *      ADCS works through the telecommand.
+ * @param id
+ *      ID of the telecommand that was sent
+ * @param tc_ack
+ *      Last TC Acknowledge frame read, valid when ADCS_OK is returned
+ * @return
+ *      ADCS_OK once processed, ADCS_UART_FAILED if ADCS_I2C_ACK_TIMEOUT_MS passed first
+ */
+static ADCS_returnState i2c_wait_tc_ack(uint8_t id, uint8_t tc_ack[4]) {
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(ADCS_I2C_ACK_TIMEOUT_MS);
+    uint32_t step = 0;
+
+    for (;;) {
+        TickType_t left = ticks_left(deadline);
+        TickType_t delay = pdMS_TO_TICKS(i2c_ack_backoff_ms[step]);
+        if (left == 0) {
             return ADCS_UART_FAILED;
-        }else{
-            received++;
+        }
+        vTaskDelay((delay < left) ? delay : left);
+        if (step + 1 < sizeof(i2c_ack_backoff_ms) / sizeof(i2c_ack_backoff_ms[0])) {
+            step++;
+        }
+
+        // Byte 0 is the last TC ID, byte 1 bit 0 the Processed flag. A failed read says nothing, poll again
+        if (request_i2c_telemetry(LAST_TC_ACK_ID, tc_ack, 4) != ADCS_OK) {
+            continue;
+        }
+        if (tc_ack[0] == id && (tc_ack[1] & 1)) {
+            return ADCS_OK;
         }
     }
-    ADCS_returnState TC_err_flag = (ADCS_returnState) reply[3];
-    xSemaphoreGive(uart_mutex);
-    return TC_err_flag;
 }
 
 /**
@@ -120,25 +907,35 @@ ADCS_returnState send_uart_telecommand(uint8_t *command, uint32_t length) {
  * 		Telecommand frame
  * @param length
  * 		Length of the data (in bytes)
- *
+ * @return
+ * 		TC Error flag of the acknowledge, or ADCS_UART_FAILED if it never arrived
  */
 ADCS_returnState send_i2c_telecommand(uint8_t *command, uint32_t length) {
-    // Send telecommand
-    i2c_Send(ADCS_I2C, ADCS_I2C_ADDR, length, command);
+    TickType_t start = xTaskGetTickCount();
 
-    // Poll TC Acknowledge Telemetry Format until the Processed flag equals 1.
-    bool processed = false;
-    uint8_t tc_ack[4];
-    while (!processed) {
-        request_i2c_telemetry(LAST_TC_ACK_ID, tc_ack, 4);
-        processed = tc_ack[1] & 1;
+    if (length == 0 || length > ADCS_MAX_TC_LEN) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    if (xSemaphoreTake(i2c_mutex, pdMS_TO_TICKS(ADCS_I2C_TIMEOUT_MS)) != pdTRUE) {
+        return ADCS_UART_FAILED;
     }
+    ADCS_returnState state = i2c_write_frame(command, length);
+    xSemaphoreGive(i2c_mutex);
+    TickType_t written = xTaskGetTickCount();
 
-    // Confirm telecommand validity by checking the TC Error flag of the last read TC Acknowledge Telemetry Format.
-    request_i2c_telemetry(LAST_TC_ACK_ID, tc_ack, 4);
-    ADCS_returnState TC_err_flag = (ADCS_returnState) tc_ack[2];
+    // Wait for the Processed flag, the TC Error flag comes from the same acknowledge frame
+    uint8_t tc_ack[4] = {0};
+    if (state == ADCS_OK) {
+        state = i2c_wait_tc_ack(command[0], tc_ack);
+    }
+    if (state == ADCS_OK) {
+        state = (ADCS_returnState)tc_ack[2];
+    }
 
-    return TC_err_flag;
+    // The telecommand is timed up to its write, the acknowledge polls are accounted under LAST_TC_ACK_ID
+    // by request_i2c_telemetry. An acknowledge that never came still counts as a failure of the telecommand.
+    adcs_stats_record(command[0], length, 0, (written - start) * portTICK_PERIOD_MS, state == ADCS_UART_FAILED);
+    return state;
 }
 
 /**
@@ -153,75 +950,57 @@ ADCS_returnState send_i2c_telecommand(uint8_t *command, uint32_t length) {
  * 
  */
 ADCS_returnState request_uart_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length) {
-    if(xSemaphoreTake(uart_mutex, UART_TIMEOUT_MS) != pdTRUE){
-        return ADCS_UART_FAILED;
+    if (length > ADCS_MAX_TM_LEN) {
+        return ADCS_INCORRECT_LENGTH;
     }
-
-    uint8_t frame[5];
-    frame[0] = ADCS_ESC_CHAR;
-    frame[1] = ADCS_SOM;
-    frame[2] = TM_ID;
-    frame[3] = ADCS_ESC_CHAR;
-    frame[4] = ADCS_EOM;
-
-    sciSend(ADCS_SCI, 5, frame);
-    if(xSemaphoreTake(tx_semphr, UART_TIMEOUT_MS) != pdTRUE){
+    if (!adcs_lane_acquire(&uart_lanes, adcs_lane_of(TM_ID), pdMS_TO_TICKS(UART_TIMEOUT_MS))) {
         return ADCS_UART_FAILED;
     }
 
-    int received = 0;
-    uint8_t *reply = (uint8_t*)pvPortMalloc(length+5);
-    if (reply == NULL) {
-        return ADCS_MALLOC_FAILED;
-    }
-
-    xQueueReset(adcsQueue);
-
-    while (received < length + 5) {
-        if(xQueueReceive(adcsQueue, reply+received, UART_TIMEOUT_MS) == pdFAIL){
-            return ADCS_UART_FAILED;
-        }else{
-            received++;
-        }
-    }
+    uart_rx_flush();
+    uart_xfer xfer;
+    uart_xfer_begin(&xfer, TM_ID, 5 + (length + 5));
+    ADCS_returnState state = uart_tx_frame(&TM_ID, 1, xfer.deadline);
 
-    for (int i = 0; i < length; i++) {
-        *(telemetry + i) = reply[3 + i];
+    // Reply is ESC SOM TM_ID <telemetry> ESC EOM
+    if (state == ADCS_OK) {
+        state = uart_rx_frame(TM_ID, telemetry, length, xfer.deadline);
     }
-    vPortFree(reply);
-    xSemaphoreGive(uart_mutex);
+    uart_xfer_end(&xfer, state);
+    adcs_lane_release(&uart_lanes);
 
-    return ADCS_OK;
+    return state;
 }
 
 /**
  * @brief
- *      Receive packet sent by ADCS from file download request
+ *      Receive one packet of a download burst
  * @param hole_map
- *      Map that captures which packets have been sent, and which have not
+ *      ADCS_HOLE_MAP_LEN byte map of the packets received so far, updated
  * @param image_bytes
- *    the actual image data
- *
+ *      Download block, the packet's data is written at packet counter * ADCS_DL_PACKET_LEN
+ * @param length_bytes
+ *      Size of image_bytes, at most ADCS_DL_BLOCK_LEN
+ * @param added
+ *      Set if the packet filled a hole in hole_map
+ * @return
+ *      ADCS_OK for a whole download packet, ADCS_UART_FAILED once the burst has gone quiet
  */
-ADCS_returnState receive_uart_packet(uint8_t *hole_map, uint8_t *image_bytes) {
-    int received = 0;
-    uint16_t pixel = 0;
-    uint8_t reply[22+5] = {0};
-
-    while (received < (22+5)) {
-        if(xQueueReceive(adcsQueue, reply+received, UART_TIMEOUT_MS) == pdFAIL){
-            return ADCS_UART_FAILED;
-        }else{
-            received++;
-        }
+ADCS_returnState receive_uart_packet(uint8_t *hole_map, uint8_t *image_bytes, uint32_t length_bytes, bool *added) {
+    *added = false;
+    if (length_bytes > ADCS_DL_BLOCK_LEN) {
+        return ADCS_INVALID_PARAMETERS;
     }
-    pixel = reply[4]*256 + reply[3];
-    *hole_map = *hole_map | 0x1 << pixel;
-//    for (int i = 0; i < 20; i++) {
-//        *(image_bytes + pixel + i) = reply[4 + i];
-//    }
-    xSemaphoreGive(uart_mutex);
-    return ADCS_OK;
+    // One packet per acquisition, so real-time requests can get in between packets
+    if (!adcs_lane_acquire(&uart_lanes, ADCS_LANE_BULK, pdMS_TO_TICKS(UART_TIMEOUT_MS))) {
+        return ADCS_UART_FAILED;
+    }
+    uart_xfer xfer;
+    uart_xfer_begin(&xfer, FILE_DL_BUFFER_ID, 2 + ADCS_DL_PACKET_LEN + 5);
+    ADCS_returnState state = uart_rx_packet(hole_map, image_bytes, length_bytes, xfer.deadline, added);
+    uart_xfer_end(&xfer, state);
+    adcs_lane_release(&uart_lanes);
+    return state;
 }
 
 /**
@@ -236,16 +1015,43 @@ ADCS_returnState receive_uart_packet(uint8_t *hole_map, uint8_t *image_bytes) {
  *
  */
 ADCS_returnState request_i2c_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length) {
-    i2c_Receive(ADCS_I2C, TM_ID, length, telemetry);
-
-    // Read error flag from Communication Status telemetry frame
-    // to determine if an incorrect number of bytes are read.
-    // Should this check be done here?
-    // (Refer to CubeADCS Firmware Manual section 5.3.1)
+    if (length > ADCS_MAX_TM_LEN) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    if (xSemaphoreTake(i2c_mutex, pdMS_TO_TICKS(ADCS_I2C_TIMEOUT_MS)) != pdTRUE) {
+        return ADCS_UART_FAILED;
+    }
+    TickType_t start = xTaskGetTickCount();
+    ADCS_returnState state = i2c_read_frame(TM_ID, telemetry, length);
 
-    // uint8_t err_reply[6];
-    // i2c_receive(err_reply, COMMS_STAT_ID, 6);
-    // uint8_t TL_err_flag = (err_reply[4] >> 3) & 1;
+    // Length errors only show up in the Communication Status, which costs a read of its own:
+    // check it periodically, and after every read while something looks wrong
+    if (state != ADCS_OK) {
+        i2c_suspect = true;
+    } else if (i2c_suspect || ++i2c_reads_unchecked >= ADCS_I2C_COMMS_CHECK_PERIOD) {
+        state = i2c_check_comms();
+        i2c_reads_unchecked = 0;
+        i2c_suspect = (state != ADCS_OK);
+    }
 
-    return ADCS_OK;
+    adcs_stats_record(TM_ID, 1, length, (xTaskGetTickCount() - start) * portTICK_PERIOD_MS,
+                      state == ADCS_UART_FAILED);
+    xSemaphoreGive(i2c_mutex);
+    return state;
 }
+
+const adcs_transport adcs_uart_transport = {
+    .name = "uart",
+    .send_telecommand = send_uart_telecommand,
+    .send_telecommands = send_uart_telecommands,
+    .request_telemetry = request_uart_telemetry,
+    .receive_packet = receive_uart_packet,
+};
+
+const adcs_transport adcs_i2c_transport = {
+    .name = "i2c",
+    .send_telecommand = send_i2c_telecommand,
+    .send_telecommands = NULL, // every I2C telecommand has its acknowledge polled
+    .request_telemetry = request_i2c_telemetry,
+    .receive_packet = NULL, // the ADCS only streams download bursts over UART
+};
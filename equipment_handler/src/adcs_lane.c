@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_lane.c
+ * @brief
+ *      Two-class arbitration of an ADCS link between control-loop traffic and bulk transfers.
+ */
+
+#include "adcs_lane.h"
+
+#include <os_task.h>
+
+/**
+ * @brief
+ *      Create the handover semaphores, the link starts free
+ * @return
+ *      ADCS_MALLOC_FAILED if the semaphores could not be allocated
+ */
+ADCS_returnState adcs_lane_init(adcs_lane_arbiter *arbiter) {
+    arbiter->busy = false;
+    for (int lane = 0; lane < ADCS_LANE_COUNT; lane++) {
+        arbiter->waiting[lane] = 0;
+        arbiter->handover[lane] = xSemaphoreCreateBinary();
+        if (arbiter->handover[lane] == NULL) {
+            return ADCS_MALLOC_FAILED;
+        }
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Take the link for one transaction
+ * @param lane
+ *      Priority class of the transaction
+ * @param timeout
+ *      Ticks to wait for the link
+ * @return
+ *      true once the caller owns the link, false on timeout
+ */
+bool adcs_lane_acquire(adcs_lane_arbiter *arbiter, ADCS_lane lane, TickType_t timeout) {
+    taskENTER_CRITICAL();
+    bool outranked = false;
+    for (int higher = 0; higher < lane; higher++) {
+        outranked = outranked || (arbiter->waiting[higher] != 0);
+    }
+    if (!arbiter->busy && !outranked) {
+        arbiter->busy = true;
+        taskEXIT_CRITICAL();
+        return true;
+    }
+    arbiter->waiting[lane]++;
+    taskEXIT_CRITICAL();
+
+    if (xSemaphoreTake(arbiter->handover[lane], timeout) == pdTRUE) {
+        return true;
+    }
+
+    // Timed out, unless a release picked this lane in the meantime and its handover is on the way
+    taskENTER_CRITICAL();
+    bool handed_over = (arbiter->waiting[lane] == 0);
+    if (!handed_over) {
+        arbiter->waiting[lane]--;
+    }
+    taskEXIT_CRITICAL();
+    if (handed_over) {
+        xSemaphoreTake(arbiter->handover[lane], portMAX_DELAY);
+    }
+    return handed_over;
+}
+
+/**
+ * @brief
+ *      Pass the link to the highest priority waiter, or mark it free
+ */
+void adcs_lane_release(adcs_lane_arbiter *arbiter) {
+    int next = ADCS_LANE_COUNT;
+
+    taskENTER_CRITICAL();
+    for (int lane = 0; lane < ADCS_LANE_COUNT && next == ADCS_LANE_COUNT; lane++) {
+        if (arbiter->waiting[lane] != 0) {
+            arbiter->waiting[lane]--;
+            next = lane;
+        }
+    }
+    if (next == ADCS_LANE_COUNT) {
+        arbiter->busy = false;
+    }
+    taskEXIT_CRITICAL();
+
+    if (next != ADCS_LANE_COUNT) {
+        xSemaphoreGive(arbiter->handover[next]); // the link stays busy, now owned by the waiter
+    }
+}
+
+/**
+ * @brief
+ *      Priority class of a TC/TM ID
+ */
+ADCS_lane adcs_lane_of(uint8_t id) {
+    // Hole maps 1 to 8
+    if ((id > SET_HOLE_MAP_ID && id <= SET_HOLE_MAP_ID + 8) || (id > GET_HOLE_MAP_ID && id <= GET_HOLE_MAP_ID + 8)) {
+        return ADCS_LANE_BULK;
+    }
+
+    switch (id) {
+    case ERASE_FILE_ID:
+    case LOAD_FILE_DOWNLOAD_BLOCK_ID:
+    case ADVANCE_FILE_LIST_READ_POINTER_ID:
+    case INITIATE_FILE_UPLOAD_ID:
+    case FILE_UPLOAD_PACKET_ID:
+    case FINALIZE_UPLOAD_BLOCK_ID:
+    case RESET_UPLOAD_BLOCK_ID:
+    case RESET_FILE_LIST_READ_POINTER_ID:
+    case INITIATE_DOWNLOAD_BURST_ID:
+    case FILE_DL_BUFFER_ID:
+    case DL_BLOCK_STAT_ID:
+    case FILE_INFO_ID:
+    case INIT_UPLOAD_STAT_ID:
+    case FINIALIZE_UPLOAD_STAT_ID:
+    case UPLOAD_CRC16_ID:
+    case GET_FULL_CONFIG_ID:
+    case GET_SYSTEM_CONFIG_ID:
+        return ADCS_LANE_BULK;
+    default:
+        return ADCS_LANE_REALTIME;
+    }
+}
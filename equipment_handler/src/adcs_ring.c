@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_ring.c
+ */
+
+#include "adcs_ring.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// Keeps buffer accesses on the right side of the index update that publishes them
+#if defined(__TI_COMPILER_VERSION__)
+#define RING_BARRIER() __asm(" dmb")
+#elif defined(__GNUC__)
+#define RING_BARRIER() __sync_synchronize()
+#else
+#define RING_BARRIER()
+#endif
+
+/**
+ * @brief
+ *      Initialize an empty ring
+ * @param buf
+ *      Backing storage
+ * @param size
+ *      Size of buf in bytes, must be a power of two
+ */
+void adcs_ring_init(adcs_ring *ring, uint8_t *buf, uint32_t size) {
+    ring->buf = buf;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+}
+
+/**
+ * @brief
+ *      Append one byte. Producer only.
+ * @return
+ *      false if the ring is full and the byte was dropped
+ */
+bool adcs_ring_put(adcs_ring *ring, uint8_t byte) {
+    uint32_t head = ring->head;
+    if (head - ring->tail > ring->mask) {
+        return false;
+    }
+    ring->buf[head & ring->mask] = byte;
+    RING_BARRIER();
+    ring->head = head + 1;
+    return true;
+}
+
+/**
+ * @brief
+ *      Publish count bytes that were written into the buffer by someone else (e.g. DMA)
+ */
+void adcs_ring_produced(adcs_ring *ring, uint32_t count) {
+    RING_BARRIER();
+    ring->head += count;
+}
+
+/**
+ * @brief
+ *      Number of unread bytes
+ */
+uint32_t adcs_ring_count(const adcs_ring *ring) { return ring->head - ring->tail; }
+
+/**
+ * @brief
+ *      Look at the unread bytes without taking them. Consumer only.
+ * @param data
+ *      Set to the oldest unread byte
+ * @return
+ *      Number of unread bytes that are contiguous in memory from data
+ */
+uint32_t adcs_ring_peek(const adcs_ring *ring, const uint8_t **data) {
+    uint32_t tail = ring->tail;
+    uint32_t available = ring->head - tail;
+    uint32_t start = tail & ring->mask;
+    RING_BARRIER();
+    *data = &ring->buf[start];
+    if (available > ring->mask + 1 - start) {
+        available = ring->mask + 1 - start;
+    }
+    return available;
+}
+
+/**
+ * @brief
+ *      Take up to count bytes out of the ring. Consumer only.
+ * @param dst
+ *      Destination buffer, or NULL to discard the bytes
+ * @return
+ *      Number of bytes taken
+ */
+uint32_t adcs_ring_read(adcs_ring *ring, uint8_t *dst, uint32_t count) {
+    uint32_t tail = ring->tail;
+    uint32_t available = ring->head - tail;
+    if (count > available) {
+        count = available;
+    }
+    RING_BARRIER();
+    if (dst != NULL) {
+        uint32_t start = tail & ring->mask;
+        uint32_t first = ring->mask + 1 - start;
+        if (first > count) {
+            first = count;
+        }
+        memcpy(dst, &ring->buf[start], first);
+        memcpy(dst + first, &ring->buf[0], count - first);
+    }
+    RING_BARRIER();
+    ring->tail = tail + count;
+    return count;
+}
+
+/**
+ * @brief
+ *      Drop everything currently unread. Consumer only.
+ */
+void adcs_ring_flush(adcs_ring *ring) { ring->tail = ring->head; }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_stats.c
+ * @brief
+ *      Per TC/TM ID link statistics, recorded by the I/O layer for every transaction
+ */
+
+#include "adcs_stats.h"
+
+#include <string.h>
+#include "FreeRTOS.h"
+#include "os_task.h"
+
+static adcs_id_stats id_stats[256];
+
+static uint32_t rtt_bucket(uint32_t rtt_ms) {
+    uint32_t bucket = 0;
+    while (rtt_ms != 0 && bucket < ADCS_STATS_BUCKETS - 1) {
+        rtt_ms >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * @brief
+ *      Account one transaction
+ * @param id
+ *      TC/TM ID the transaction was for
+ * @param sent
+ *      Bytes put on the link
+ * @param received
+ *      Bytes taken off the link
+ * @param rtt_ms
+ *      Time from the start of transmission until the reply was complete (or the call gave up)
+ * @param timed_out
+ *      true if no complete reply arrived
+ */
+void adcs_stats_record(uint8_t id, uint32_t sent, uint32_t received, uint32_t rtt_ms, bool timed_out) {
+    adcs_id_stats *stats = &id_stats[id];
+    uint32_t bucket = rtt_bucket(rtt_ms);
+
+    taskENTER_CRITICAL();
+    stats->calls++;
+    stats->timeouts += timed_out ? 1 : 0;
+    stats->bytes_sent += sent;
+    stats->bytes_received += received;
+    if (stats->rtt_hist[bucket] != UINT16_MAX) {
+        stats->rtt_hist[bucket]++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief
+ *      Copy out a consistent snapshot of the statistics for one ID
+ */
+void adcs_stats_get(uint8_t id, adcs_id_stats *stats) {
+    taskENTER_CRITICAL();
+    memcpy(stats, &id_stats[id], sizeof(*stats));
+    taskEXIT_CRITICAL();
+}
+
+void adcs_stats_reset(void) {
+    for (uint32_t id = 0; id < 256; id++) {
+        taskENTER_CRITICAL();
+        memset(&id_stats[id], 0, sizeof(id_stats[id]));
+        taskEXIT_CRITICAL();
+    }
+}
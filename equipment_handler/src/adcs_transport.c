@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_transport.c
+ */
+
+#include "adcs_transport.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define LOOPBACK_BUFFER_SIZE 512
+
+static const adcs_transport *transports[ADCS_TRANSPORT_COUNT] = {
+    [ADCS_TRANSPORT_LOOPBACK] = &adcs_loopback_transport,
+};
+static const adcs_transport *volatile active; // none until a transport is selected
+
+/**
+ * @brief
+ *      Make a transport available for selection
+ * @param id
+ *      Slot the transport is registered under
+ * @param transport
+ *      Operations of the transport, must stay valid for the life of the program
+ */
+void adcs_register_transport(ADCS_transportId id, const adcs_transport *transport) {
+    if (id < ADCS_TRANSPORT_COUNT) {
+        transports[id] = transport;
+    }
+}
+
+/**
+ * @brief
+ *      Look up a registered transport, e.g. to use a second bus alongside the active one
+ * @return
+ *      The transport, or NULL if none is registered under id
+ */
+const adcs_transport *adcs_get_transport(ADCS_transportId id) {
+    if (id >= ADCS_TRANSPORT_COUNT) {
+        return NULL;
+    }
+    return transports[id];
+}
+
+/**
+ * @brief
+ *      Route adcs_telecommand/adcs_telemetry through another registered transport
+ * @return
+ *      ADCS_INVALID_PARAMETERS if nothing is registered under id
+ */
+ADCS_returnState adcs_select_transport(ADCS_transportId id) {
+    const adcs_transport *transport = adcs_get_transport(id);
+    if (transport == NULL) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    active = transport;
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Transport currently used by adcs_telecommand/adcs_telemetry
+ * @return
+ *      NULL until one has been selected
+ */
+const adcs_transport *adcs_active_transport(void) { return active; }
+
+/*************************** Loopback transport ***************************/
+// Acknowledges every telecommand and answers any telemetry request with the
+// parameters of the last telecommand, zero padded. Lets the handler be exercised
+// and timed without an ADCS attached.
+static uint8_t loopback_buffer[LOOPBACK_BUFFER_SIZE];
+static uint32_t loopback_length;
+
+static ADCS_returnState loopback_telecommand(uint8_t *command, uint32_t length) {
+    if (length == 0 || length - 1 > LOOPBACK_BUFFER_SIZE) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    loopback_length = length - 1;
+    memcpy(loopback_buffer, command + 1, loopback_length);
+    return ADCS_OK;
+}
+
+static ADCS_returnState loopback_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length) {
+    (void)TM_ID;
+    uint32_t copy = (length < loopback_length) ? length : loopback_length;
+    memcpy(telemetry, loopback_buffer, copy);
+    memset(telemetry + copy, 0, length - copy);
+    return ADCS_OK;
+}
+
+const adcs_transport adcs_loopback_transport = {
+    .name = "loopback",
+    .send_telecommand = loopback_telecommand,
+    .send_telecommands = NULL,
+    .request_telemetry = loopback_telemetry,
+    .receive_packet = NULL,
+};
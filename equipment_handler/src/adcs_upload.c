@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_upload.c
+ * @brief
+ *      Block by block upload of a file from the OBC filesystem to the ADCS.
+ *
+ *      A block is streamed as File Upload Packets without a round trip per acknowledge,
+ *      then the ADCS upload hole map is read back and only the packets it lacks are sent
+ *      again. Once the hole map is full the block is finalized, and the CRC the ADCS
+ *      computed over it is checked against the local one.
+ */
+
+#include "adcs_upload.h"
+#include "adcs_crc16.h"
+#include "adcs_file_index.h"
+#include "adcs_handler.h"
+#include "adcs_transport.h"
+
+#include "FreeRTOS.h"
+#include "os_task.h"
+#include "redposix.h"
+#include <string.h>
+
+#define HOLE_MAP_READ_ATTEMPTS 3
+
+typedef ADCS_returnState (*upload_stat)(bool *busy, bool *err);
+
+static const uint16_t upload_backoff_ms[] = ADCS_UPLOAD_POLL_BACKOFF_MS;
+
+static bool hole_map_test(const uint8_t *hole_map, uint32_t packet) {
+    return (hole_map[packet / 8] >> (packet % 8)) & 1;
+}
+
+static bool hole_map_full(const uint8_t *hole_map, uint32_t packets) {
+    for (uint32_t i = 0; i < packets; i++) {
+        if (!hole_map_test(hole_map, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static ADCS_returnState init_stat(bool *busy, bool *err) {
+    *err = false;
+    return ADCS_get_init_upload_stat(busy);
+}
+
+/**
+ * @brief
+ *      Poll an upload status, backing off, until the ADCS is no longer busy
+ * @return
+ *      ADCS_INVALID_PARAMETERS if the ADCS reports an error, ADCS_UART_FAILED if it is still
+ *      busy after timeout_ms
+ */
+static ADCS_returnState upload_wait(upload_stat stat, uint32_t timeout_ms) {
+    uint32_t waited = 0;
+    uint32_t step = 0;
+
+    for (;;) {
+        bool busy, err;
+        ADCS_returnState state = stat(&busy, &err);
+        if (state != ADCS_OK) {
+            return state;
+        }
+        if (!busy) {
+            return err ? ADCS_INVALID_PARAMETERS : ADCS_OK;
+        }
+        if (waited >= timeout_ms) {
+            return ADCS_UART_FAILED;
+        }
+        vTaskDelay(pdMS_TO_TICKS(upload_backoff_ms[step]));
+        waited += upload_backoff_ms[step];
+        if (step + 1 < sizeof(upload_backoff_ms) / sizeof(upload_backoff_ms[0])) {
+            step++;
+        }
+    }
+}
+
+/**
+ * @brief
+ *      Send the packets of block not yet in hole_map, a window at a time
+ * @details
+ *      Send failures are left to the hole map read that follows.
+ * @param hole_map
+ *      Packets the ADCS already has, NULL to send them all
+ */
+static void upload_send(const uint8_t *block, const uint8_t *hole_map, uint32_t packets) {
+    uint16_t window[ADCS_TC_WINDOW];
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < packets; i++) {
+        if (hole_map != NULL && hole_map_test(hole_map, i)) {
+            continue;
+        }
+        window[count++] = i;
+        if (count == ADCS_TC_WINDOW) {
+            ADCS_file_upload_packets(block, window, count);
+            count = 0;
+        }
+    }
+    if (count > 0) {
+        ADCS_file_upload_packets(block, window, count);
+    }
+}
+
+/**
+ * @brief
+ *      Read the part of the ADCS upload hole map that covers packets
+ * @details
+ *      The acknowledge of a packet whose telecommand timed out can still arrive and answer
+ *      the next request in place of its hole map, so a failed read is tried again. On failure
+ *      the parts read so far are updated and the rest keep their earlier contents.
+ */
+static ADCS_returnState hole_map_read(uint8_t *hole_map, uint32_t packets) {
+    for (uint32_t first = 0; first < packets; first += 16 * 8) {
+        uint8_t part[16];
+        ADCS_returnState state;
+        int attempt = 0;
+        do {
+            // A failed read may still have filled part, only a good one is copied into hole_map
+            state = ADCS_get_hole_map(part, (uint8_t)(first / (16 * 8) + 1));
+        } while (state != ADCS_OK && ++attempt < HOLE_MAP_READ_ATTEMPTS);
+        if (state != ADCS_OK) {
+            return state;
+        }
+        memcpy(&hole_map[first / 8], part, sizeof(part));
+    }
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Upload one block and have the ADCS write it at offset
+ * @param block
+ *      Block data, padded with zeros to a whole number of packets
+ */
+static ADCS_returnState upload_block(uint8_t file_dest, uint32_t offset, const uint8_t *block, uint16_t length) {
+    uint32_t packets = (length + ADCS_DL_PACKET_LEN - 1) / ADCS_DL_PACKET_LEN;
+    uint8_t hole_map[ADCS_HOLE_MAP_LEN] = {0}; // only ever holds what a good read reported
+    bool fresh = true;
+
+    ADCS_returnState state = ADCS_reset_upload_block();
+    if (state != ADCS_OK) {
+        return state;
+    }
+    for (int pass = 0; pass < ADCS_UPLOAD_MAX_PASSES; pass++) {
+        upload_send(block, fresh ? NULL : hole_map, packets);
+        fresh = false;
+        state = hole_map_read(hole_map, packets);
+        if (state == ADCS_UART_FAILED) {
+            continue;
+        }
+        if (state != ADCS_OK) {
+            return state;
+        }
+        if (!hole_map_full(hole_map, packets)) {
+            state = ADCS_UART_FAILED;
+            continue;
+        }
+
+        state = ADCS_finalize_upload_block(file_dest, offset, length);
+        if (state == ADCS_OK) {
+            state = upload_wait(ADCS_get_finalize_upload_stat, ADCS_UPLOAD_FINALIZE_TIMEOUT_MS);
+        }
+        uint16_t crc16;
+        if (state == ADCS_OK) {
+            state = ADCS_get_upload_crc16_checksum(&crc16);
+        }
+        if (state == ADCS_UART_FAILED) {
+            continue; // a lost reply costs a pass, finalizing again is harmless
+        }
+        if (state != ADCS_OK) {
+            return state;
+        }
+        if (crc16 == adcs_crc16(block, length)) {
+            return ADCS_OK;
+        }
+
+        // Damaged on the way, a packet TC carries no check of its own: send the block again
+        state = ADCS_reset_upload_block();
+        if (state != ADCS_OK) {
+            return state;
+        }
+        state = ADCS_CRC_ERROR;
+        fresh = true;
+    }
+    return state;
+}
+
+/**
+ * @brief
+ *      Upload a file from the OBC filesystem to an ADCS file destination
+ * @param path
+ *      Source file on the OBC filesystem
+ * @param file_dest
+ *      Destination as for ADCS_initiate_file_upload (EEPROM, program slot or SD user file)
+ * @return
+ *      ADCS_OK once every block is written and matches its CRC. ADCS_CRC_ERROR if a block
+ *      kept failing its CRC, ADCS_UART_FAILED if packets kept going missing or the ADCS
+ *      stayed busy, ADCS_INVALID_PARAMETERS if it reported an upload error.
+ */
+ADCS_returnState adcs_upload_file(const char *path, uint8_t file_dest) {
+    return adcs_upload_file_from(path, file_dest, 0, NULL, NULL);
+}
+
+/**
+ * @brief
+ *      Upload a file, or carry on with an upload the ADCS already has the start of
+ * @details
+ *      From offset 0 the upload is initiated first. From a later offset the ADCS is taken to
+ *      still be in the upload the earlier blocks went to, so nothing it holds is disturbed;
+ *      if it has been reset since, finalizing the first block fails with
+ *      ADCS_INVALID_PARAMETERS and the upload has to start over from 0.
+ * @param offset
+ *      Where to start, a multiple of ADCS_DL_BLOCK_LEN
+ * @param checkpoint
+ *      Called after each block with the offset done so far, NULL if not needed. An error
+ *      from it stops the upload and is returned.
+ * @return
+ *      As adcs_upload_file
+ */
+ADCS_returnState adcs_upload_file_from(const char *path, uint8_t file_dest, uint32_t offset,
+                                       adcs_upload_checkpoint checkpoint, void *context) {
+    if (offset % ADCS_DL_BLOCK_LEN != 0) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    int32_t fd = red_open(path, RED_O_RDONLY);
+    if (fd < 0) {
+        return ADCS_FS_FAILED;
+    }
+    int64_t size = red_lseek(fd, 0, RED_SEEK_END);
+    if (size < 0 || red_lseek(fd, offset, RED_SEEK_SET) != (int64_t)offset) {
+        red_close(fd);
+        return ADCS_FS_FAILED;
+    }
+    uint8_t *block = (uint8_t *)pvPortMalloc(ADCS_DL_BLOCK_LEN);
+    if (block == NULL) {
+        red_close(fd);
+        return ADCS_MALLOC_FAILED;
+    }
+
+    ADCS_returnState state = ADCS_OK;
+    if (offset == 0) {
+        state = ADCS_initiate_file_upload(file_dest, ADCS_UPLOAD_INIT_BLOCK_SIZE);
+        if (state == ADCS_OK) {
+            state = upload_wait(init_stat, ADCS_UPLOAD_INIT_TIMEOUT_MS);
+        }
+    }
+    while (state == ADCS_OK && offset < size) {
+        uint32_t remaining = size - offset;
+        uint16_t length = (remaining < ADCS_DL_BLOCK_LEN) ? remaining : ADCS_DL_BLOCK_LEN;
+        uint32_t padded = (length + ADCS_DL_PACKET_LEN - 1) / ADCS_DL_PACKET_LEN * ADCS_DL_PACKET_LEN;
+
+        if (red_read(fd, block, length) != (int32_t)length) {
+            state = ADCS_FS_FAILED;
+            break;
+        }
+        memset(block + length, 0, padded - length);
+        state = upload_block(file_dest, offset, block, length);
+        if (state == ADCS_OK) {
+            offset += length;
+            if (checkpoint != NULL) {
+                state = checkpoint(context, offset);
+            }
+        }
+    }
+
+    vPortFree(block);
+    red_close(fd);
+    if (state == ADCS_OK) {
+        adcs_file_index_invalidate(); // an SD user file may have been added
+    }
+    return state;
+}
@@ -14,7 +14,7 @@
 
 // Performs all tests used in TX2-AC-025 Ver 1.00 ADCS Binary Testing Plan with the OBC
 
-// Make sure to define either "USE_UART" or "USE_I2C" in adcs_handler.c depending on which interface is being tested
+// Make sure to select the interface being tested with adcs_select_transport()
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -117,29 +117,29 @@ void binaryTest_Bootloader(void){
     // Test must be executed within 5 seconds of turning on ADCS
     ADCS_returnState test_returnState = ADCS_OK;
     uint16_t uptime = 0;
-    uint8_t flags_arr[12];
+    adcs_boot_flags boot_flags;
 
     printf("Running ADCS_get_bootloader_state...\n");
-    test_returnState = ADCS_get_bootloader_state(&uptime, flags_arr);
+    test_returnState = ADCS_get_bootloader_state(&uptime, &boot_flags);
     if(test_returnState != ADCS_OK){
         printf("ADCS_get_bootloader_state returned %d \n", test_returnState);
         while(1);
     }
 
     printf("uptime = %d \n", uptime);
-    printf("flags_arr:\n");
-    printf("sram1 = %d \n", flags_arr[0]);
-    printf("sram2 = %d \n", flags_arr[1]);
-    printf("sram_latch_not_recovered = %d \n", flags_arr[2]);
-    printf("sram_latch_recovered = %d \n", flags_arr[3]);
-    printf("sd_initial_err = %d \n", flags_arr[4]);
-    printf("sd_read_err = %d \n", flags_arr[5]);
-    printf("sd_write_err = %d \n", flags_arr[6]);
-    printf("external_flash_err = %d \n", flags_arr[7]);
-    printf("internal_flash_err = %d \n", flags_arr[8]);
-    printf("eeprom_err = %d \n", flags_arr[9]);
-    printf("bad_boot_reg = %d \n", flags_arr[10]);
-    printf("comms_radio_err = %d \n\n", flags_arr[11]);
+    printf("flags:\n");
+    printf("sram1 = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SRAM1_ERR));
+    printf("sram2 = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SRAM2_ERR));
+    printf("sram_latch_not_recovered = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SRAM_LATCH_NOT_RECOVERED));
+    printf("sram_latch_recovered = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SRAM_LATCH_RECOVERED));
+    printf("sd_initial_err = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SD_INITIAL_ERR));
+    printf("sd_read_err = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SD_READ_ERR));
+    printf("sd_write_err = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_SD_WRITE_ERR));
+    printf("external_flash_err = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_EXTERNAL_FLASH_ERR));
+    printf("internal_flash_err = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_INTERNAL_FLASH_ERR));
+    printf("eeprom_err = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_EEPROM_ERR));
+    printf("bad_boot_reg = %d \n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_BAD_BOOT_REG));
+    printf("comms_radio_err = %d \n\n", adcs_bitset_test(boot_flags.word, ADCS_BOOT_COMMS_RADIO_ERR));
 
     //Continuing test Section 4.1 Bootloader, Table 4-1 in test plan.
     uint8_t mcu_reset_cause = 0;
@@ -180,10 +180,10 @@ void binaryTest_Bootloader(void){
     //Continuing test Section 4.1 Bootloader, Table 4-1 in test plan.
     uint16_t TC_num = 0;
     uint16_t TM_num = 0;
-    memset(&flags_arr, 0 , 12);
+    adcs_comms_flags comms_flags = {0};
 
     printf("Running ADCS_get_comms_stat...\n");
-    test_returnState = ADCS_get_comms_stat(&TC_num, &TM_num, flags_arr); // TODO: fix this
+    test_returnState = ADCS_get_comms_stat(&TC_num, &TM_num, &comms_flags);
     if(test_returnState != ADCS_OK){
         printf("ADCS_get_comms_stat returned %d \n", test_returnState);
         while(1);
@@ -191,7 +191,9 @@ void binaryTest_Bootloader(void){
 
     printf("TC_num = %d \n", TC_num);
     printf("TM_num = %d \n", TM_num);
-    printf("flags: %d %d %d %d %d %d", flags_arr[0],flags_arr[1],flags_arr[2],flags_arr[3],flags_arr[4],flags_arr[5]);
+    printf("flags: %d %d %d %d %d %d", adcs_bitset_test(comms_flags.word, 0), adcs_bitset_test(comms_flags.word, 1),
+           adcs_bitset_test(comms_flags.word, 2), adcs_bitset_test(comms_flags.word, 3),
+           adcs_bitset_test(comms_flags.word, 4), adcs_bitset_test(comms_flags.word, 5));
 
     printf("\n");
 }
@@ -272,10 +274,10 @@ void binaryTest_CubeACP(void){
     //Continuing test Section 4.2 CubeACP, Table 4-2 in test plan.
     uint16_t TC_num = 0;
     uint16_t TM_num = 0;
-    uint8_t flags_arr = 0;
+    adcs_comms_flags comms_flags = {0};
 
     printf("Running ADCS_get_comms_stat...\n");
-    test_returnState = ADCS_get_comms_stat(&TC_num, &TM_num, &flags_arr);
+    test_returnState = ADCS_get_comms_stat(&TC_num, &TM_num, &comms_flags);
     if(test_returnState != ADCS_OK){
         printf("ADCS_get_comms_stat returned %d \n", test_returnState);
         while(1);
@@ -283,7 +285,7 @@ void binaryTest_CubeACP(void){
 
     printf("TC_num = %d \n", TC_num);
     printf("TM_num = %d \n", TM_num);
-    printf("flags_arr (decimal form, not binary) = %d \n", flags_arr);
+    printf("comms_flags (decimal form, not binary) = %d \n", (int)comms_flags.word[0]);
 
     //Continuing test Section 4.2 CubeACP, Table 4-2 in test plan.
     uint32_t unix_t = 0;
@@ -365,7 +367,7 @@ void binaryTest_CubeACP(void){
     //need to test if all other flags == 0. Simpler to do in code than via human.
     uint8_t all_other_adcs_states_equal_zero = 0;
     for(int i = 0; i<36; i++){//I think this is the right range.
-        if(test_adcs_state.flags_arr[i] != 0){
+        if(adcs_bitset_test(test_adcs_state.flags.word, i)){
             break;
         }
         if(i == 35){
@@ -390,10 +392,10 @@ void binaryTest_CubeACP(void){
     //Test Section 4.2 CubeACP, Table 4-4 in test plan.
     TC_num = 0;
     TM_num = 0;
-    flags_arr = 0;
+    memset(&comms_flags, 0, sizeof(comms_flags));
 
     printf("Running ADCS_get_comms_stat...\n");
-    test_returnState = ADCS_get_comms_stat(&TC_num, &TM_num, &flags_arr);
+    test_returnState = ADCS_get_comms_stat(&TC_num, &TM_num, &comms_flags);
     if(test_returnState != ADCS_OK){
         printf("ADCS_get_comms_stat returned %d \n", test_returnState);
         while(1);
@@ -441,7 +443,7 @@ void binaryTest_CubeACP(void){
             //skip index
         }
         else{
-            if(test_adcs_state.flags_arr[i] != 0){
+            if(adcs_bitset_test(test_adcs_state.flags.word, i)){
                 break;
             }
             if(i == 35){
@@ -469,7 +471,7 @@ void binaryTest_CubeACP(void){
     printf("att_estimate mode = %d \n", test_adcs_state.att_estimate_mode);
     printf("att_ctrl_mode = %d \n", test_adcs_state.att_ctrl_mode);
     printf("run_mode = %d \n", test_adcs_state.run_mode);
-    printf("Sun is Above Local horizon = %d \n", test_adcs_state.flags_arr[11]);
+    printf("Sun is Above Local horizon = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 11));
 
 
     printf("\n");
@@ -590,12 +592,12 @@ void binaryTest_CubeSense1(void){
     printf("att_estimate mode = %d \n", test_adcs_state.att_estimate_mode);
     printf("att_ctrl_mode = %d \n", test_adcs_state.att_ctrl_mode);
     printf("run_mode = %d \n", test_adcs_state.run_mode);
-    printf("CubeSense1 Enabled = %d \n", test_adcs_state.flags_arr[2]);
-    printf("Sun is Above Local Horizon = %d \n", test_adcs_state.flags_arr[11]);
+    printf("CubeSense1 Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 2));
+    printf("Sun is Above Local Horizon = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 11));
     //need to test if all flags other than CubeSense1 Enabled and Sun is Above Local Horizon are == 0. Simpler to do in code than via human.
     uint8_t all_other_adcs_states_equal_zero = 0;
     for(int i = 0; i<36; i++){//I think this is the right range.
-        if(((i == 2) | (i == 11)) & (test_adcs_state.flags_arr[i] != 0)){
+        if(((i == 2) | (i == 11)) & (adcs_bitset_test(test_adcs_state.flags.word, i))){
             break;
         }
         if(i == 35){
@@ -919,7 +921,7 @@ void binaryTest_CubeSense1(void){
     // 7. Send Initiate Download Burst
     printf("Running ADCS_initiate_download_burst...\n");
     test_returnState = ADCS_initiate_download_burst(msg_length, ignore_hole_map);
-    ADCS_receive_download_burst(&hole_map, &image_bytes, length_bytes);
+    test_returnState = ADCS_receive_download_burst(hole_map, image_bytes, length_bytes);
 
 
     printf("hole_map = %x\r\n", *hole_map);
@@ -1022,12 +1024,12 @@ void binaryTest_CubeSense2(void){
     printf("att_estimate mode = %d \n", test_adcs_state.att_estimate_mode);
     printf("att_ctrl_mode = %d \n", test_adcs_state.att_ctrl_mode);
     printf("run_mode = %d \n", test_adcs_state.run_mode);
-    printf("CubeSense2 Enabled = %d \n", test_adcs_state.flags_arr[2]);
-    printf("Sun is Above Local Horizon = %d \n", test_adcs_state.flags_arr[11]);
+    printf("CubeSense2 Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 2));
+    printf("Sun is Above Local Horizon = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 11));
     //need to test if all flags other than CubeSense2 Enabled and Sun is Above Local Horizon are == 0. Simpler to do in code than via human.
     uint8_t all_other_adcs_states_equal_zero = 0;
     for(int i = 0; i<36; i++){//I think this is the right range.
-        if(((i == 2) | (i == 11)) & (test_adcs_state.flags_arr[i] != 0)){
+        if(((i == 2) | (i == 11)) & (adcs_bitset_test(test_adcs_state.flags.word, i))){
             break;
         }
         if(i == 35){
@@ -1261,13 +1263,13 @@ void binaryTest_CubeControl_Sgn_MCU(void) {
     printf("att_estimate mode = %d \n", test_adcs_state.att_estimate_mode);
     printf("att_ctrl_mode = %d \n", test_adcs_state.att_ctrl_mode);
     printf("run_mode = %d \n", test_adcs_state.run_mode);
-    printf("CubeControl Signal Enabled = %d \n", test_adcs_state.flags_arr[0]);
+    printf("CubeControl Signal Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 0));
 
     //need to test if all other flags == 0. Simpler to do in code than via human.
     // CHANGED TO A MANUAL HUMAN CHECK AT THIS POINT
     uint8_t all_other_adcs_states_equal_zero = 1;
 //    for(int i = 0; i<36; i++){//I think this is the right range.
-//        if(!((i == 0)) && test_adcs_state.flags_arr[i] != 0){
+//        if(!((i == 0)) && adcs_bitset_test(test_adcs_state.flags.word, i)){
 //            break;
 //        }
 //        if(i == 35){
@@ -1445,12 +1447,12 @@ void binaryTest_CubeControl_Motor_MCU(void) {
     printf("att_estimate mode = %d \n", test_adcs_state.att_estimate_mode);
     printf("att_ctrl_mode = %d \n", test_adcs_state.att_ctrl_mode);
     printf("run_mode = %d \n", test_adcs_state.run_mode);
-    printf("CubeControl Motor Enabled = %d \n", test_adcs_state.flags_arr[1]);
+    printf("CubeControl Motor Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 1));
 
     //need to test if all other flags == 0. Simpler to do in code than via human.
     uint8_t all_other_adcs_states_equal_zero = 0;
     for(int i = 0; i<36; i++){//I think this is the right range.
-        if(test_adcs_state.flags_arr[i] != 0){
+        if(adcs_bitset_test(test_adcs_state.flags.word, i)){
             break;
         }
         if(i == 35){
@@ -1634,7 +1636,7 @@ void CubeMag_Common_Test(bool signalMCU){
             while(1);
         }
 
-        printf("Magnetometer Range Error = %d \n", test_adcs_state.flags_arr[10]);
+        printf("Magnetometer Range Error = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 10));
     }
 
     // Familiarise the axes of both magnetometers, as shown in Appendix A at the end of  this document.
@@ -1941,20 +1943,20 @@ void ReactionWheels_Common_Test(uint8_t wheel_number){
     printf("run_mode = %d \n", test_adcs_state.run_mode);
 
     if(wheel_number == 1){
-        printf("CubeWheel1 Signal Enabled = %d \n", test_adcs_state.flags_arr[4]);
+        printf("CubeWheel1 Signal Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 4));
     }
     else if(wheel_number == 2){
-        printf("CubeWheel2 Signal Enabled = %d \n", test_adcs_state.flags_arr[5]);
+        printf("CubeWheel2 Signal Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 5));
     }
     else if(wheel_number == 3){
-        printf("CubeWheel3 Signal Enabled = %d \n", test_adcs_state.flags_arr[6]);
+        printf("CubeWheel3 Signal Enabled = %d \n", adcs_bitset_test(test_adcs_state.flags.word, 6));
     }
 
 
     //need to test if all other flags == 0. Simpler to do in code than via human.
 //    uint8_t all_other_adcs_states_equal_zero = 0;
 //    for(int i = 0; i<36; i++){//I think this is the right range.
-//        if(test_adcs_state.flags_arr[i] != 0){
+//        if(adcs_bitset_test(test_adcs_state.flags.word, i)){
 //            break;
 //        }
 //        if(i == 35){
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <os_queue.h>
+
+#include "adcs_async.h"
+#include "unity.h"
+
+/*
+ * The service task runs on its own thread over a small fake of the FreeRTOS queue, so a
+ * waiter on the test thread can reuse its request the moment done is set, as a task on
+ * another core or of higher priority would.
+ */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queued = PTHREAD_COND_INITIALIZER;
+static adcs_request *slots[ADCS_REQUEST_QUEUE_LEN];
+static uint32_t head, tail;
+static pthread_t service;
+static TaskFunction_t service_task;
+
+static int waiter_task; // stands in for the submitting task's handle
+static volatile uint32_t notified;
+static volatile uint32_t bad_notify;
+static volatile uint32_t callback_after_done;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t size) {
+    (void)length;
+    (void)size;
+    return (QueueHandle_t)slots;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t wait) {
+    (void)queue;
+    (void)wait;
+    pthread_mutex_lock(&lock);
+    slots[tail++ % ADCS_REQUEST_QUEUE_LEN] = *(adcs_request *const *)item;
+    pthread_cond_signal(&queued);
+    pthread_mutex_unlock(&lock);
+    return pdPASS;
+}
+
+static void unlock(void *arg) {
+    (void)arg;
+    pthread_mutex_unlock(&lock);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait) {
+    (void)queue;
+    (void)wait;
+    pthread_mutex_lock(&lock);
+    pthread_cleanup_push(unlock, NULL); // tearDown cancels the wait
+    while (head == tail) {
+        pthread_cond_wait(&queued, &lock);
+    }
+    *(adcs_request **)item = slots[head++ % ADCS_REQUEST_QUEUE_LEN];
+    pthread_cleanup_pop(1);
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint16_t depth, void *param, UBaseType_t priority,
+                       TaskHandle_t *handle) {
+    (void)name;
+    (void)depth;
+    (void)param;
+    (void)priority;
+    (void)handle;
+    service_task = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task != (TaskHandle_t)&waiter_task) {
+        bad_notify++;
+    }
+    notified++;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+    (void)clear;
+    (void)wait;
+    return 0;
+}
+
+TickType_t xTaskGetTickCount(void) { return 0; }
+
+ADCS_returnState adcs_telemetry(uint8_t TM_ID, uint8_t *reply, uint32_t length) {
+    memset(reply, TM_ID, length);
+    return ADCS_OK;
+}
+
+ADCS_returnState adcs_telecommand(uint8_t *command, uint32_t length) {
+    (void)command;
+    (void)length;
+    return ADCS_OK;
+}
+
+static void *service_thread(void *arg) {
+    (void)arg;
+    service_task(NULL);
+    return NULL;
+}
+
+static void check_callback(adcs_request *request) {
+    if (request->done) {
+        callback_after_done++;
+    }
+}
+
+void setUp(void) {
+    head = tail = 0;
+    notified = bad_notify = callback_after_done = 0;
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, adcs_async_init());
+    pthread_create(&service, NULL, service_thread, NULL);
+}
+
+void tearDown(void) {
+    pthread_cancel(service);
+    pthread_join(service, NULL);
+}
+
+void test_ADCS_async_callback_runs_before_done(void) {
+    uint8_t reply[4];
+    adcs_request request = {0};
+    request.callback = check_callback;
+    request.notify = (TaskHandle_t)&waiter_task;
+
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, adcs_submit_telemetry(&request, 0x92, reply, sizeof(reply), 0));
+    while (!request.done || notified == 0) {
+    }
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, request.result);
+    TEST_ASSERT_EQUAL_HEX8(0x92, reply[3]);
+    TEST_ASSERT_EQUAL_UINT32(0, callback_after_done);
+    TEST_ASSERT_EQUAL_UINT32(0, bad_notify);
+}
+
+void test_ADCS_async_request_reused_once_done(void) {
+    uint8_t reply[4];
+    const uint32_t rounds = 20000;
+
+    for (uint32_t i = 0; i < rounds; i++) {
+        adcs_request request = {0};
+        request.callback = check_callback;
+        request.notify = (TaskHandle_t)&waiter_task;
+        TEST_ASSERT_EQUAL_INT(ADCS_OK, adcs_submit_telemetry(&request, 0x92, reply, sizeof(reply), 0));
+        while (!request.done) {
+        }
+        // The waiter's storage is handed to something else as soon as the request completes
+        memset(&request, 0xA5, sizeof(request));
+    }
+    while (notified < rounds) {
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, callback_after_done);
+    TEST_ASSERT_EQUAL_UINT32(0, bad_notify);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_bitset.h"
+#include "unity.h"
+
+#define FLAGS 52
+
+static uint32_t set[ADCS_BITSET_WORDS(FLAGS)];
+
+void setUp(void) {
+    memset(set, 0, sizeof(set));
+}
+
+void tearDown(void) {}
+
+void test_ADCS_bitset_test_and_assign(void) {
+    adcs_bitset_assign(set, 0, true);
+    adcs_bitset_assign(set, 33, true);
+    adcs_bitset_assign(set, 51, true);
+    adcs_bitset_assign(set, 0, false);
+
+    TEST_ASSERT_FALSE(adcs_bitset_test(set, 0));
+    TEST_ASSERT_TRUE(adcs_bitset_test(set, 33));
+    TEST_ASSERT_TRUE(adcs_bitset_test(set, 51));
+    TEST_ASSERT_EQUAL_HEX32(0, set[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x80002, set[1]);
+}
+
+void test_ADCS_bitset_any_all(void) {
+    TEST_ASSERT_FALSE(adcs_bitset_any(set, FLAGS));
+    adcs_bitset_assign(set, 40, true);
+    TEST_ASSERT_TRUE(adcs_bitset_any(set, FLAGS));
+    TEST_ASSERT_FALSE(adcs_bitset_all(set, FLAGS));
+
+    for (int i = 0; i < FLAGS; i++) {
+        adcs_bitset_assign(set, i, true);
+    }
+    TEST_ASSERT_TRUE(adcs_bitset_all(set, FLAGS));
+    TEST_ASSERT_TRUE(adcs_bitset_all(set, 32)); // a whole word
+    adcs_bitset_assign(set, 51, false);
+    TEST_ASSERT_FALSE(adcs_bitset_all(set, FLAGS));
+}
+
+void test_ADCS_bitset_diff(void) {
+    uint32_t before[ADCS_BITSET_WORDS(FLAGS)] = {0x5, 0x100};
+    uint32_t changed[ADCS_BITSET_WORDS(FLAGS)];
+
+    memcpy(set, before, sizeof(set));
+    TEST_ASSERT_FALSE(adcs_bitset_diff(before, set, changed, FLAGS));
+    adcs_bitset_assign(set, 2, false);
+    adcs_bitset_assign(set, 45, true);
+    TEST_ASSERT_TRUE(adcs_bitset_diff(before, set, changed, FLAGS));
+    TEST_ASSERT_EQUAL_HEX32(0x4, changed[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x2000, changed[1]);
+}
+
+void test_ADCS_bitset_frame_roundtrip(void) {
+    // 36 flags from bit 4, then 12 from bit 6 of byte 6, as in the ADCS state frame
+    const uint8_t frame[] = {0xF0, 0x21, 0x43, 0x65, 0x87, 0x00, 0xC0, 0xAB, 0x01};
+    uint8_t encoded[sizeof(frame)] = {0};
+
+    memset(set, 0xFF, sizeof(set)); // stale bits past flag 51 are cleared by the read
+    adcs_reader tm = adcs_reader_init(frame, sizeof(frame));
+    adcs_get_skip_bits(&tm, 4);
+    adcs_get_bitset(&tm, set, 0, 36);
+    adcs_get_skip(&tm, 1);
+    adcs_get_skip_bits(&tm, 6);
+    adcs_get_bitset(&tm, set, 40, 12);
+    TEST_ASSERT_FALSE(tm.overrun);
+    TEST_ASSERT_EQUAL_HEX32(0x7654321F, set[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x6AF08, set[1]); // flags 32-35, then 40-51
+
+    adcs_writer tc = adcs_writer_init(encoded, sizeof(encoded));
+    adcs_put_bits(&tc, 0, 4);
+    adcs_put_bitset(&tc, set, 0, 36);
+    adcs_put_skip(&tc, 1);
+    adcs_put_skip_bits(&tc, 6);
+    adcs_put_bitset(&tc, set, 40, 12);
+    TEST_ASSERT_FALSE(tc.overrun);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&frame[1], &encoded[1], sizeof(frame) - 1);
+}
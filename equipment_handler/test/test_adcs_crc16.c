@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdint.h>
+
+#include "adcs_crc16.h"
+#include "adcs_types.h"
+#include "unity.h"
+
+static uint8_t data[ADCS_DL_PACKET_LEN * 7 + 3];
+
+void setUp(void) {
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 31 + 7);
+    }
+}
+
+void tearDown(void) {}
+
+void test_ADCS_crc16_check_value(void) {
+    const uint8_t check[] = "123456789";
+
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, adcs_crc16(check, 9));
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, adcs_crc16_update_bytewise(ADCS_CRC16_INIT, check, 9));
+    TEST_ASSERT_EQUAL_HEX16(ADCS_CRC16_INIT, adcs_crc16(check, 0));
+}
+
+void test_ADCS_crc16_sliced_matches_bytewise(void) {
+    // Every length and alignment, so the tail after the four byte steps is covered too
+    for (uint32_t start = 0; start < 4; start++) {
+        for (uint32_t len = 0; len + start <= sizeof(data); len++) {
+            TEST_ASSERT_EQUAL_HEX16(adcs_crc16_update_bytewise(ADCS_CRC16_INIT, data + start, len),
+                                    adcs_crc16_update(ADCS_CRC16_INIT, data + start, len));
+        }
+    }
+}
+
+void test_ADCS_crc16_per_packet(void) {
+    uint16_t crc = ADCS_CRC16_INIT;
+
+    for (uint32_t pos = 0; pos < sizeof(data); pos += ADCS_DL_PACKET_LEN) {
+        uint32_t len = sizeof(data) - pos < ADCS_DL_PACKET_LEN ? sizeof(data) - pos : ADCS_DL_PACKET_LEN;
+        crc = adcs_crc16_update(crc, data + pos, len);
+    }
+    TEST_ASSERT_EQUAL_HEX16(adcs_crc16(data, sizeof(data)), crc);
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_cursor.h"
+#include "unity.h"
+
+static const uint8_t frame[] = {
+    0x34, 0x12,                                     // 0x1234
+    0x9C, 0xFF,                                     // -100
+    0x78, 0x56, 0x34, 0x12,                         // 0x12345678
+    0xFE, 0xFF, 0xFF, 0xFF,                         // -2
+    0x00, 0x00, 0xC0, 0x3F,                         // 1.5f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, // 10.0
+    0xC5, 0x07,                                     // flag 1, 2 bits 2, 3 bits 0x18 spanning, then 0x00
+    0xAB,                                           // a byte after the bit fields
+};
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_ADCS_cursor_reads_little_endian(void) {
+    adcs_reader tm = adcs_reader_init(frame, sizeof(frame));
+
+    TEST_ASSERT_EQUAL_HEX16(0x1234, adcs_get_u16(&tm));
+    TEST_ASSERT_EQUAL_INT16(-100, adcs_get_i16(&tm));
+    TEST_ASSERT_EQUAL_UINT32(0x12345678, adcs_get_u32(&tm));
+    TEST_ASSERT_EQUAL_INT32(-2, adcs_get_i32(&tm));
+    TEST_ASSERT_EQUAL_FLOAT(1.5f, adcs_get_f32(&tm));
+    TEST_ASSERT_TRUE(adcs_get_f64(&tm) == 10.0);
+    TEST_ASSERT_FALSE(tm.overrun);
+}
+
+void test_ADCS_cursor_bits_span_bytes_and_realign(void) {
+    adcs_reader tm = adcs_reader_init(frame, sizeof(frame));
+
+    adcs_get_skip(&tm, 24);
+    TEST_ASSERT_TRUE(adcs_get_flag(&tm));
+    TEST_ASSERT_EQUAL_UINT8(2, adcs_get_bits(&tm, 2));
+    adcs_get_skip_bits(&tm, 2);
+    TEST_ASSERT_EQUAL_UINT8(0x1E, adcs_get_bits(&tm, 5)); // bits 5-9
+    // The next byte-sized value starts after the partly read byte
+    TEST_ASSERT_EQUAL_HEX8(0xAB, adcs_get_u8(&tm));
+    TEST_ASSERT_FALSE(tm.overrun);
+}
+
+void test_ADCS_cursor_overrun_latches(void) {
+    adcs_reader tm = adcs_reader_init(frame, 3);
+
+    TEST_ASSERT_EQUAL_HEX16(0x1234, adcs_get_u16(&tm));
+    TEST_ASSERT_EQUAL_HEX16(0, adcs_get_u16(&tm)); // one byte left
+    TEST_ASSERT_TRUE(tm.overrun);
+    // A read that would have fit still reads zero once overrun
+    TEST_ASSERT_EQUAL_HEX8(0, adcs_get_u8(&tm));
+    TEST_ASSERT_FALSE(adcs_get_flag(&tm));
+}
+
+void test_ADCS_cursor_writes_roundtrip(void) {
+    uint8_t encoded[sizeof(frame)] = {0};
+    adcs_writer tc = adcs_writer_init(encoded, sizeof(encoded));
+
+    adcs_put_u16(&tc, 0x1234);
+    adcs_put_i16(&tc, -100);
+    adcs_put_u32(&tc, 0x12345678);
+    adcs_put_i32(&tc, -2);
+    adcs_put_f32(&tc, 1.5f);
+    adcs_put_f64(&tc, 10.0);
+    adcs_put_flag(&tc, true);
+    adcs_put_bits(&tc, 2, 2);
+    adcs_put_skip_bits(&tc, 2);
+    adcs_put_bits(&tc, 0xFE, 5); // only the low 5 bits are written
+    adcs_put_u8(&tc, 0xAB);
+
+    TEST_ASSERT_FALSE(tc.overrun);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(frame, encoded, 24);
+    TEST_ASSERT_EQUAL_HEX8(0xC5, encoded[24]);
+    TEST_ASSERT_EQUAL_HEX8(0x03, encoded[25]);
+    TEST_ASSERT_EQUAL_HEX8(0xAB, encoded[26]);
+}
+
+void test_ADCS_cursor_write_keeps_other_bits(void) {
+    uint8_t encoded[2] = {0xFF, 0xFF};
+    adcs_writer tc = adcs_writer_init(encoded, sizeof(encoded));
+
+    adcs_put_skip_bits(&tc, 6);
+    adcs_put_bits(&tc, 0, 4);
+
+    TEST_ASSERT_EQUAL_HEX8(0x3F, encoded[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFC, encoded[1]);
+}
+
+void test_ADCS_cursor_overrun_writes_nothing(void) {
+    uint8_t encoded[4] = {0};
+    adcs_writer tc = adcs_writer_init(encoded, 3);
+
+    adcs_put_u16(&tc, 0x1234);
+    adcs_put_u16(&tc, 0x5678);
+    adcs_put_u8(&tc, 0x9A);
+
+    TEST_ASSERT_TRUE(tc.overrun);
+    TEST_ASSERT_EQUAL_HEX8(0x34, encoded[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x12, encoded[1]);
+    TEST_ASSERT_EQUAL_HEX8(0, encoded[2]);
+    TEST_ASSERT_EQUAL_HEX8(0, encoded[3]);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdint.h>
+
+#include "adcs_deadline.h"
+#include "adcs_io.h"
+#include "unity.h"
+
+void setUp(void) { adcs_deadline_reset(); }
+
+void tearDown(void) {}
+
+void test_ADCS_deadline_unsampled_uses_ceiling(void) {
+    // 1152 bytes take 100 ms at 115200 baud
+    TEST_ASSERT_EQUAL_UINT32(100 + UART_TIMEOUT_MS, adcs_deadline_budget_ms(0x80, 1152));
+}
+
+void test_ADCS_deadline_converges_to_rtt(void) {
+    for (int i = 0; i < 50; i++) {
+        adcs_deadline_observe(0x80, 40);
+    }
+    // srtt settles on 40 ms and rttvar decays, floored at wire time plus margin
+    TEST_ASSERT_UINT32_WITHIN(3, 40, adcs_deadline_budget_ms(0x80, 10));
+    // Other IDs are unaffected
+    TEST_ASSERT_EQUAL_UINT32(1 + UART_TIMEOUT_MS, adcs_deadline_budget_ms(0x81, 10));
+}
+
+void test_ADCS_deadline_margin_floor(void) {
+    for (int i = 0; i < 50; i++) {
+        adcs_deadline_observe(0x80, 0);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100 + ADCS_DEADLINE_MARGIN_MS, adcs_deadline_budget_ms(0x80, 1152));
+}
+
+void test_ADCS_deadline_widens_on_expiry(void) {
+    for (int i = 0; i < 50; i++) {
+        adcs_deadline_observe(0x80, 40);
+    }
+    uint32_t before = adcs_deadline_budget_ms(0x80, 10);
+    adcs_deadline_expired(0x80);
+    adcs_deadline_expired(0x80);
+    uint32_t after = adcs_deadline_budget_ms(0x80, 10);
+
+    TEST_ASSERT_TRUE(after > before);
+    TEST_ASSERT_TRUE(after <= 1 + UART_TIMEOUT_MS);
+}
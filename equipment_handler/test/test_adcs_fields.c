@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_bitset.h"
+#include "adcs_fields.h"
+#include "unity.h"
+
+typedef struct {
+    uint8_t mode;
+    uint32_t flags[ADCS_BITSET_WORDS(10)];
+    float angle[3];
+    uint16_t count;
+    int32_t pos;
+    float level;
+    float gain;
+    double epoch;
+} decoded;
+
+static const adcs_field fields[] = {
+    ADCS_BITS(0, 4, 4, decoded, mode),
+    ADCS_FLAGS(0, 0, 4, decoded, flags, 0),
+    ADCS_FLAGS(1, 6, 6, decoded, flags, 4), // crosses into the next byte
+    ADCS_FIELD(3, ADCS_FIELD_I16_F, 3, 0.01f, decoded, angle),
+    ADCS_FIELD(9, ADCS_FIELD_U16, 1, 0, decoded, count),
+    ADCS_FIELD(11, ADCS_FIELD_I32, 1, 0, decoded, pos),
+    ADCS_FIELD(15, ADCS_FIELD_U16_F, 1, 0.5f, decoded, level),
+    ADCS_FIELD(17, ADCS_FIELD_F32, 1, 0, decoded, gain),
+    ADCS_FIELD(21, ADCS_FIELD_F64, 1, 0, decoded, epoch),
+};
+
+static const uint8_t frame[] = {
+    0x95,                                           // mode 9, flags 1 0 1 0
+    0x40, 0x0B,                                     // flags 1 0 1 1 0 1
+    0x64, 0x00, 0x9C, 0xFF, 0x00, 0x80,             // 1.00, -1.00, -327.68
+    0x34, 0x12,                                     // 0x1234
+    0xFE, 0xFF, 0xFF, 0xFF,                         // -2
+    0xFF, 0xFF,                                     // 65535 * 0.5, unsigned
+    0x00, 0x00, 0xC0, 0x3F,                         // 1.5f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, // 10.0
+};
+
+static decoded out;
+
+void setUp(void) {
+    memset(&out, 0xAA, sizeof(out));
+}
+
+void tearDown(void) {}
+
+void test_ADCS_fields_decode_fields(void) {
+    TEST_ASSERT_EQUAL(ADCS_OK,
+                      adcs_fields_decode(fields, ADCS_FIELD_COUNT(fields), frame, sizeof(frame), &out));
+    TEST_ASSERT_EQUAL_UINT8(9, out.mode);
+    TEST_ASSERT_EQUAL_HEX32(0x2D5, out.flags[0] & 0x3FF); // 1 0 1 0 1 0 1 1 0 1 from flag 0
+    TEST_ASSERT_FLOAT_WITHIN(0.0001, 1.0, out.angle[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001, -1.0, out.angle[1]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001, -327.68, out.angle[2]);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, out.count);
+    TEST_ASSERT_EQUAL_INT32(-2, out.pos);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001, 32767.5, out.level);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001, 1.5, out.gain);
+    TEST_ASSERT_TRUE(out.epoch == 10.0);
+}
+
+void test_ADCS_fields_decode_rejects_short_frame(void) {
+    // The double at the end no longer fits
+    TEST_ASSERT_EQUAL(ADCS_INCORRECT_LENGTH,
+                      adcs_fields_decode(fields, ADCS_FIELD_COUNT(fields), frame, sizeof(frame) - 1, &out));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, out.count);
+}
+
+void test_ADCS_fields_encode_roundtrip(void) {
+    uint8_t encoded[sizeof(frame)] = {0};
+
+    TEST_ASSERT_EQUAL(ADCS_OK,
+                      adcs_fields_decode(fields, ADCS_FIELD_COUNT(fields), frame, sizeof(frame), &out));
+    TEST_ASSERT_EQUAL(ADCS_OK,
+                      adcs_fields_encode(fields, ADCS_FIELD_COUNT(fields), &out, encoded, sizeof(encoded)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(frame, encoded, sizeof(frame));
+}
+
+void test_ADCS_fields_encode_rounds_and_saturates(void) {
+    uint8_t encoded[sizeof(frame)] = {0};
+    const uint8_t angle[] = {0x0B, 0x00, 0xF5, 0xFF, 0xFF, 0x7F}; // 11, -11, 32767
+    const uint8_t level[] = {0x00, 0x00};                         // 0, unsigned
+
+    memset(&out, 0, sizeof(out));
+    out.angle[0] = 0.105f;
+    out.angle[1] = -0.105f;
+    out.angle[2] = 1000.0f;
+    out.level = -3.0f;
+    out.mode = 0x1F; // only the low 4 bits fit
+
+    TEST_ASSERT_EQUAL(ADCS_OK,
+                      adcs_fields_encode(fields, ADCS_FIELD_COUNT(fields), &out, encoded, sizeof(encoded)));
+    TEST_ASSERT_EQUAL_HEX8(0xF0, encoded[0]);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(angle, &encoded[3], sizeof(angle));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(level, &encoded[15], sizeof(level));
+    TEST_ASSERT_EQUAL(ADCS_INCORRECT_LENGTH,
+                      adcs_fields_encode(fields, ADCS_FIELD_COUNT(fields), &out, encoded, sizeof(encoded) - 1));
+}
+
+// The same frame read without scaling, the way the _raw getters read it
+typedef struct {
+    int16_t angle[3];
+    uint16_t level;
+} counts;
+
+static const adcs_field raw_fields[] = {
+    ADCS_FIELD(3, ADCS_FIELD_I16, 3, 0, counts, angle),
+    ADCS_FIELD(15, ADCS_FIELD_U16, 1, 0, counts, level),
+};
+
+void test_ADCS_fields_raw_counts_scale_to_decoded(void) {
+    counts raw;
+    const int16_t angle[] = {100, -100, -32768};
+
+    TEST_ASSERT_EQUAL(ADCS_OK,
+                      adcs_fields_decode(raw_fields, ADCS_FIELD_COUNT(raw_fields), frame, sizeof(frame), &raw));
+    TEST_ASSERT_EQUAL(ADCS_OK,
+                      adcs_fields_decode(fields, ADCS_FIELD_COUNT(fields), frame, sizeof(frame), &out));
+    TEST_ASSERT_EQUAL_INT16_ARRAY(angle, raw.angle, 3);
+    TEST_ASSERT_EQUAL_UINT16(65535, raw.level);
+    for (int k = 0; k < 3; k++) {
+        TEST_ASSERT_EQUAL_FLOAT(out.angle[k], raw.angle[k] * 0.01f);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(out.level, raw.level * 0.5f);
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_frame.h"
+#include "unity.h"
+
+static uint8_t payload[4];
+static adcs_frame_parser parser;
+
+void setUp(void) {
+    memset(payload, 0, sizeof(payload));
+    adcs_frame_parser_init(&parser, payload, sizeof(payload));
+}
+
+void tearDown(void) {}
+
+void test_ADCS_frame_unstuffs_escape(void) {
+    uint8_t wire[] = {0x1F, 0x7F, 0x80, 0x01, 0x1F, 0x1F, 0x02, 0x1F, 0xFF};
+    uint8_t expected[] = {0x01, 0x1F, 0x02};
+    uint32_t consumed;
+
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, wire, sizeof(wire), &consumed));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(wire), consumed);
+    TEST_ASSERT_EQUAL_UINT8(0x80, parser.id);
+    TEST_ASSERT_EQUAL_UINT32(3, parser.length);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, payload, 3);
+}
+
+void test_ADCS_frame_resyncs_after_garbage(void) {
+    // Stale bytes and a truncated frame ahead of the real one
+    uint8_t wire[] = {0x55, 0xFF, 0x1F, 0x7F, 0x81, 0x09, 0x1F, 0x7F, 0x82, 0x05, 0x1F, 0xFF};
+    uint32_t consumed;
+
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, wire, sizeof(wire), &consumed));
+    TEST_ASSERT_EQUAL_UINT8(0x82, parser.id);
+    TEST_ASSERT_EQUAL_UINT32(1, parser.length);
+    TEST_ASSERT_EQUAL_UINT8(0x05, payload[0]);
+}
+
+void test_ADCS_frame_split_across_calls(void) {
+    uint8_t wire[] = {0x1F, 0x7F, 0x80, 0x1F, 0x1F, 0x1F, 0xFF, 0xAA};
+    uint32_t consumed;
+
+    // Split in the middle of an escape sequence
+    TEST_ASSERT_EQUAL(ADCS_FRAME_INCOMPLETE, adcs_frame_parse(&parser, wire, 4, &consumed));
+    TEST_ASSERT_EQUAL_UINT32(4, consumed);
+    // Completes early and leaves the trailing byte for the next frame
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, wire + 4, 4, &consumed));
+    TEST_ASSERT_EQUAL_UINT32(3, consumed);
+    TEST_ASSERT_EQUAL_UINT32(1, parser.length);
+    TEST_ASSERT_EQUAL_UINT8(0x1F, payload[0]);
+}
+
+void test_ADCS_frame_overflow(void) {
+    uint8_t wire[] = {0x1F, 0x7F, 0x80, 1, 2, 3, 4, 5, 0x1F, 0xFF};
+    uint32_t consumed;
+
+    TEST_ASSERT_EQUAL(ADCS_FRAME_OVERFLOW, adcs_frame_parse(&parser, wire, sizeof(wire), &consumed));
+}
+
+void test_ADCS_frame_encode_roundtrip(void) {
+    uint8_t body[] = {0x80, 0x1F, 0x02};
+    uint8_t frame[ADCS_FRAME_ENCODED_MAX(3)];
+    uint8_t expected[] = {0x1F, 0x7F, 0x80, 0x1F, 0x1F, 0x02, 0x1F, 0xFF};
+    uint32_t consumed;
+
+    uint32_t len = adcs_frame_encode(frame, body, 3);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(expected), len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, frame, len);
+
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, frame, len, &consumed));
+    TEST_ASSERT_EQUAL_UINT8(0x80, parser.id);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(body + 1, payload, 2);
+}
+
+void test_ADCS_frame_split_places_tail(void) {
+    // Two byte header, then the rest goes where the header says
+    uint8_t wire[] = {0x1F, 0x7F, 0xF1, 0x01, 0x00, 0xAA, 0x1F, 0x1F, 0xBB, 0xCC, 0x1F, 0xFF};
+    uint8_t image[6] = {0};
+    uint8_t expected[] = {0, 0, 0, 0xAA, 0x1F, 0};
+    uint32_t consumed;
+    uint32_t pos = 0;
+
+    adcs_frame_parser_init(&parser, payload, 2);
+    adcs_frame_parser_split(&parser);
+    TEST_ASSERT_EQUAL(ADCS_FRAME_SPLIT, adcs_frame_parse(&parser, wire, sizeof(wire), &consumed));
+    pos += consumed;
+    TEST_ASSERT_EQUAL_UINT8(1, payload[0]);
+
+    // Room for two of the four remaining bytes, the others are counted but dropped
+    adcs_frame_parser_set_tail(&parser, image + 3 * payload[0], 2);
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, wire + pos, sizeof(wire) - pos, &consumed));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(wire), pos + consumed);
+    TEST_ASSERT_EQUAL_UINT32(6, parser.length);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, image, sizeof(image));
+}
+
+void test_ADCS_frame_skip_drains_stuffed_payload(void) {
+    // A longer frame of another ID whose payload holds a stuffed ESC followed by SOM, then the awaited one
+    uint8_t wire[] = {0x1F, 0x7F, 0xF1, 1, 2, 3, 4, 5, 0x1F, 0x1F, 0x7F, 0x92, 6, 0x1F, 0xFF,
+                      0x1F, 0x7F, 0x92, 0xA1, 0xA2, 0xA3, 0xA4, 0x1F, 0xFF};
+    uint8_t expected[] = {0xA1, 0xA2, 0xA3, 0xA4};
+    uint32_t consumed;
+    uint32_t pos = 0;
+
+    TEST_ASSERT_EQUAL(ADCS_FRAME_OVERFLOW, adcs_frame_parse(&parser, wire, sizeof(wire), &consumed));
+    pos += consumed;
+    TEST_ASSERT_EQUAL_UINT8(0xF1, parser.id);
+
+    adcs_frame_parser_skip(&parser);
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, wire + pos, sizeof(wire) - pos, &consumed));
+    pos += consumed;
+    TEST_ASSERT_EQUAL_UINT8(0xF1, parser.id);
+    TEST_ASSERT_EQUAL_UINT32(15, pos);
+
+    adcs_frame_parser_init(&parser, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(ADCS_FRAME_COMPLETE, adcs_frame_parse(&parser, wire + pos, sizeof(wire) - pos, &consumed));
+    TEST_ASSERT_EQUAL_UINT8(0x92, parser.id);
+    TEST_ASSERT_EQUAL_UINT32(4, parser.length);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, payload, sizeof(expected));
+}
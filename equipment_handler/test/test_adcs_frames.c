@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+// Generated by tools/adcs_gen.py from tools/adcs_frames.json, do not edit.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_fields.h"
+#include "adcs_frames.h"
+#include "adcs_handler.h"
+#include "unity.h"
+
+typedef union {
+    adcs_state adcs_state;
+    adcs_state_raw adcs_state_raw;
+    xyz xyz;
+    adcs_measures adcs_measures;
+    adcs_measures_raw adcs_measures_raw;
+    adcs_actuator adcs_actuator;
+    adcs_estimate adcs_estimate;
+    adcs_estimate_raw adcs_estimate_raw;
+    adcs_asgp4 adcs_asgp4;
+    adcs_raw_sensor adcs_raw_sensor;
+    adcs_raw_gps adcs_raw_gps;
+    adcs_star_track adcs_star_track;
+    xyz16 xyz16;
+    adcs_pwr_temp adcs_pwr_temp;
+    adcs_pwr_temp_raw adcs_pwr_temp_raw;
+    adcs_sgp4 adcs_sgp4;
+    adcs_sysConfig adcs_sysConfig;
+    cubesense_config cubesense_config;
+    xyzu8 xyzu8;
+    rate_gyro_config rate_gyro_config;
+    css_config css_config;
+    mtm_config mtm_config;
+    cubestar_config cubestar_config;
+    detumble_config detumble_config;
+    ywheel_ctrl_config ywheel_ctrl_config;
+    rwheel_ctrl_config rwheel_ctrl_config;
+    track_ctrl_config track_ctrl_config;
+    moment_inertia_config moment_inertia_config;
+    estimation_config estimation_config;
+    aspg4_setting aspg4_setting;
+    usercoded_setting usercoded_setting;
+    adcs_config adcs_config;
+} any_block;
+
+static uint8_t frame[GET_FULL_CONFIG_LEN];
+static uint8_t encoded[GET_FULL_CONFIG_LEN];
+static any_block decoded;
+static any_block redecoded;
+
+void setUp(void) {
+    memset(&decoded, 0, sizeof(decoded));
+    memset(&redecoded, 0, sizeof(redecoded));
+    memset(encoded, 0, sizeof(encoded));
+}
+
+void tearDown(void) {}
+
+/*
+ * Decodes a pseudo-random frame, encodes the result and decodes that again: both decodes must agree.
+ * Scaled 32 bit values are kept within float precision so the round trip is exact.
+ */
+static void roundtrip(const adcs_field *fields, uint32_t count, uint32_t length) {
+    uint32_t seed = length;
+    for (uint32_t i = 0; i < length; i++) {
+        seed = seed * 1103515245 + 12345;
+        frame[i] = seed >> 16;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t k = 0; fields[i].type == ADCS_FIELD_I32_F && k < fields[i].count; k++) {
+            frame[fields[i].wire + 4 * k + 3] = 0;
+            frame[fields[i].wire + 4 * k + 2] &= 0x7F;
+        }
+    }
+
+    TEST_ASSERT_EQUAL(ADCS_OK, adcs_fields_decode(fields, count, frame, length, &decoded));
+    TEST_ASSERT_EQUAL(ADCS_OK, adcs_fields_encode(fields, count, &decoded, encoded, length));
+    TEST_ASSERT_EQUAL(ADCS_OK, adcs_fields_decode(fields, count, encoded, length, &redecoded));
+    TEST_ASSERT_EQUAL_MEMORY(&decoded, &redecoded, sizeof(decoded));
+}
+
+void test_ADCS_frames_state_roundtrip(void) {
+    roundtrip(adcs_state_fields, ADCS_STATE_FIELD_COUNT, ADCS_STATE_LEN);
+}
+
+void test_ADCS_frames_state_raw_roundtrip(void) {
+    roundtrip(adcs_state_raw_fields, ADCS_STATE_RAW_FIELD_COUNT, ADCS_STATE_LEN);
+}
+
+void test_ADCS_frames_llh_roundtrip(void) {
+    roundtrip(adcs_llh_fields, ADCS_LLH_FIELD_COUNT, SATELLITE_POSITION_LLH_LEN);
+}
+
+void test_ADCS_frames_measures_roundtrip(void) {
+    roundtrip(adcs_measures_fields, ADCS_MEASURES_FIELD_COUNT, ADCS_MEASUREMENTS_LEN);
+}
+
+void test_ADCS_frames_measures_raw_roundtrip(void) {
+    roundtrip(adcs_measures_raw_fields, ADCS_MEASURES_RAW_FIELD_COUNT, ADCS_MEASUREMENTS_LEN);
+}
+
+void test_ADCS_frames_actuator_roundtrip(void) {
+    roundtrip(adcs_actuator_fields, ADCS_ACTUATOR_FIELD_COUNT, ACTUATOR_LEN);
+}
+
+void test_ADCS_frames_estimate_roundtrip(void) {
+    roundtrip(adcs_estimate_fields, ADCS_ESTIMATE_FIELD_COUNT, ESTIMATION_LEN);
+}
+
+void test_ADCS_frames_estimate_raw_roundtrip(void) {
+    roundtrip(adcs_estimate_raw_fields, ADCS_ESTIMATE_RAW_FIELD_COUNT, ESTIMATION_LEN);
+}
+
+void test_ADCS_frames_asgp4_roundtrip(void) {
+    roundtrip(adcs_asgp4_fields, ADCS_ASGP4_FIELD_COUNT, ASGP4_TLEs_LEN);
+}
+
+void test_ADCS_frames_raw_sensor_roundtrip(void) {
+    roundtrip(adcs_raw_sensor_fields, ADCS_RAW_SENSOR_FIELD_COUNT, RAW_SENSOR_MEASUREMENTS_LEN);
+}
+
+void test_ADCS_frames_raw_gps_roundtrip(void) {
+    roundtrip(adcs_raw_gps_fields, ADCS_RAW_GPS_FIELD_COUNT, RAW_GPS_MEASUREMENTS_LEN);
+}
+
+void test_ADCS_frames_star_track_roundtrip(void) {
+    roundtrip(adcs_star_track_fields, ADCS_STAR_TRACK_FIELD_COUNT, RAW_STAR_TRACKER_LEN);
+}
+
+void test_ADCS_frames_xyz16_roundtrip(void) {
+    roundtrip(adcs_xyz16_fields, ADCS_XYZ16_FIELD_COUNT, SET_MAGNETORQUER_OUTPUT_LEN);
+}
+
+void test_ADCS_frames_pwr_temp_roundtrip(void) {
+    roundtrip(adcs_pwr_temp_fields, ADCS_PWR_TEMP_FIELD_COUNT, POWER_TEMP_LEN);
+}
+
+void test_ADCS_frames_pwr_temp_raw_roundtrip(void) {
+    roundtrip(adcs_pwr_temp_raw_fields, ADCS_PWR_TEMP_RAW_FIELD_COUNT, POWER_TEMP_LEN);
+}
+
+void test_ADCS_frames_att_angle_roundtrip(void) {
+    roundtrip(adcs_att_angle_fields, ADCS_ATT_ANGLE_FIELD_COUNT, SET_ATT_ANGLE_LEN);
+}
+
+void test_ADCS_frames_track_ref_roundtrip(void) {
+    roundtrip(adcs_track_ref_fields, ADCS_TRACK_REF_FIELD_COUNT, SET_TRACK_CTRLER_TARGET_REF_LEN);
+}
+
+void test_ADCS_frames_iner_ref_roundtrip(void) {
+    roundtrip(adcs_iner_ref_fields, ADCS_INER_REF_FIELD_COUNT, SET_INERTIAL_POINT_LEN);
+}
+
+void test_ADCS_frames_sgp4_roundtrip(void) {
+    roundtrip(adcs_sgp4_fields, ADCS_SGP4_FIELD_COUNT, SET_SGP4_ORBIT_PARAMS_LEN);
+}
+
+void test_ADCS_frames_sys_config_roundtrip(void) {
+    roundtrip(adcs_sys_config_fields, ADCS_SYS_CONFIG_FIELD_COUNT, SET_SYSTEM_CONFIG_LEN);
+}
+
+void test_ADCS_frames_cubesense_roundtrip(void) {
+    roundtrip(adcs_cubesense_fields, ADCS_CUBESENSE_FIELD_COUNT, SET_CUBESENSE_CONFIG_LEN);
+}
+
+void test_ADCS_frames_mtq_roundtrip(void) {
+    roundtrip(adcs_mtq_fields, ADCS_MTQ_FIELD_COUNT, SET_MTQ_CONFIG_LEN);
+}
+
+void test_ADCS_frames_rate_gyro_roundtrip(void) {
+    roundtrip(adcs_rate_gyro_fields, ADCS_RATE_GYRO_FIELD_COUNT, SET_RATE_GYRO_CONFIG_LEN);
+}
+
+void test_ADCS_frames_css_roundtrip(void) {
+    roundtrip(adcs_css_fields, ADCS_CSS_FIELD_COUNT, SET_CSS_CONFIG_LEN);
+}
+
+void test_ADCS_frames_mtm_roundtrip(void) {
+    roundtrip(adcs_mtm_fields, ADCS_MTM_FIELD_COUNT, SET_MTM_CONFIG_LEN);
+}
+
+void test_ADCS_frames_star_tracker_roundtrip(void) {
+    roundtrip(adcs_star_tracker_fields, ADCS_STAR_TRACKER_FIELD_COUNT, SET_STAR_TRACK_CONFIG_LEN);
+}
+
+void test_ADCS_frames_detumble_roundtrip(void) {
+    roundtrip(adcs_detumble_fields, ADCS_DETUMBLE_FIELD_COUNT, SET_DETUMBLE_PARAM_LEN);
+}
+
+void test_ADCS_frames_ywheel_roundtrip(void) {
+    roundtrip(adcs_ywheel_fields, ADCS_YWHEEL_FIELD_COUNT, SET_YWHEEL_CTRL_PARAM_LEN);
+}
+
+void test_ADCS_frames_rwheel_roundtrip(void) {
+    roundtrip(adcs_rwheel_fields, ADCS_RWHEEL_FIELD_COUNT, SET_RWHEEL_CTRL_PARAM_LEN);
+}
+
+void test_ADCS_frames_tracking_roundtrip(void) {
+    roundtrip(adcs_tracking_fields, ADCS_TRACKING_FIELD_COUNT, SET_TRACK_CTRL_LEN);
+}
+
+void test_ADCS_frames_moi_roundtrip(void) {
+    roundtrip(adcs_moi_fields, ADCS_MOI_FIELD_COUNT, SET_MOMENT_INERTIA_MAT_LEN);
+}
+
+void test_ADCS_frames_estimation_roundtrip(void) {
+    roundtrip(adcs_estimation_fields, ADCS_ESTIMATION_FIELD_COUNT, SET_ESTIMATE_PARAM_LEN);
+}
+
+void test_ADCS_frames_asgp4_setting_roundtrip(void) {
+    roundtrip(adcs_asgp4_setting_fields, ADCS_ASGP4_SETTING_FIELD_COUNT, SET_ASGP4_PARAM_LEN);
+}
+
+void test_ADCS_frames_usercoded_roundtrip(void) {
+    roundtrip(adcs_usercoded_fields, ADCS_USERCODED_FIELD_COUNT, SET_USERCODED_PARAM_LEN);
+}
+
+void test_ADCS_frames_full_config_roundtrip(void) {
+    roundtrip(adcs_full_config_fields, ADCS_FULL_CONFIG_FIELD_COUNT, GET_FULL_CONFIG_LEN);
+}
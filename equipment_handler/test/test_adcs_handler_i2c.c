@@ -14,13 +14,12 @@
 
 //Basic I2C functionality test
 
-// Make sure to define "USE_I2C" in adcs_handler.c to pass tests
-
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "adcs_frames.h"
 #include "adcs_handler.h"
 #include "adcs_io.h"
 #include "mock_uart_i2c.h"
@@ -28,7 +27,11 @@
 
 uint8_t TC_ID_array[] = {1, 4, 5, 6, 33, 108, 112, 113, 114, 115, 116, 117, 118, 119};
 
-void setUp(void) {}
+void setUp(void) {
+    // init_adcs_io is not run against the mocks, so register the transport under test here
+    adcs_register_transport(ADCS_TRANSPORT_I2C, &adcs_i2c_transport);
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, adcs_select_transport(ADCS_TRANSPORT_I2C));
+}
 
 void tearDown(void) {}
 
@@ -86,3 +89,33 @@ void test_ADCS_I2C_request(void) {
     TEST_ASSERT_EQUAL_UINT16(runtime_s, runtime_s_f);
     TEST_ASSERT_EQUAL_UINT16(runtime_ms, runtime_ms_f);
 }
+
+void test_ADCS_I2C_download_burst_rejected(void) {
+    uint8_t hole_map[ADCS_HOLE_MAP_LEN] = {0};
+    uint8_t block[ADCS_DL_PACKET_LEN];
+
+    // No bus traffic is expected: the burst is only ever streamed over UART
+    TEST_ASSERT_EQUAL_INT(ADCS_INVALID_PARAMETERS, ADCS_initiate_download_burst(ADCS_DL_PACKET_LEN, true));
+    TEST_ASSERT_EQUAL_INT(ADCS_INVALID_PARAMETERS, ADCS_receive_download_burst(hole_map, block, sizeof(block)));
+}
+
+void test_ADCS_I2C_comms_stat_tm_error(void) {
+    // TC count 3, TM count 0x0102, only the I2C telemetry read error flag (bit 1) set
+    uint8_t reply[COMMS_STAT_LEN] = {3, 0, 0x02, 0x01, 1 << ADCS_COMMS_I2C_TM_ERR, 0};
+    uint16_t TC_num, TM_num;
+    adcs_comms_flags flags;
+
+    i2c_receive_ExpectAnyArgs();
+    i2c_receive_ReturnArrayThruPtr_data(reply, COMMS_STAT_LEN);
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, ADCS_get_comms_stat(&TC_num, &TM_num, &flags));
+
+    TEST_ASSERT_EQUAL_UINT16(3, TC_num);
+    TEST_ASSERT_EQUAL_UINT16(0x0102, TM_num);
+    for (int flag = 0; flag < ADCS_COMMS_FLAG_COUNT; flag++) {
+        TEST_ASSERT_EQUAL(flag == ADCS_COMMS_I2C_TM_ERR, adcs_bitset_test(flags.word, flag));
+    }
+
+    // The I2C read check decodes with the same helper, which rejects a short frame
+    TEST_ASSERT_EQUAL_INT(ADCS_INCORRECT_LENGTH,
+                          adcs_decode_comms_stat(reply, COMMS_STAT_LEN - 2, &TC_num, &TM_num, &flags));
+}
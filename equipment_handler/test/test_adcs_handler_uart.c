@@ -12,8 +12,6 @@
  * GNU General Public License for more details.
  */
 
-// Make sure to define "USE_I2C" in adcs_handler.c to pass tests
-
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -26,7 +24,11 @@
 
 uint8_t TC_ID_array[] = {1, 4, 5, 6, 33, 108, 112, 113, 114, 115, 116, 117, 118, 119};
 
-void setUp(void) {}
+void setUp(void) {
+    // init_adcs_io is not run against the mocks, so register the transport under test here
+    adcs_register_transport(ADCS_TRANSPORT_UART, &adcs_uart_transport);
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, adcs_select_transport(ADCS_TRANSPORT_UART));
+}
 
 void tearDown(void) {}
 
@@ -115,14 +117,14 @@ void test_ADCS_BootLoader_telemetries(void) {
     reply[10] = ADCS_EOM;
 
     uint16_t uptime_f;
-    uint8_t flags_arr[11];
+    adcs_boot_flags boot_flags;
     uart_send_Expect(request, 5);
     uart_receive_ExpectAnyArgs();
     uart_receive_ReturnArrayThruPtr_data(reply, 11);
-    ADCS_get_bootloader_state(&uptime_f, flags_arr);
+    ADCS_get_bootloader_state(&uptime_f, &boot_flags);
     TEST_ASSERT_EQUAL_UINT16(uptime_f, uptime);
-    uint8_t flags_f[11] = {1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0}; // 7 2 1
-    TEST_ASSERT_EQUAL_UINT8_ARRAY(flags_arr, flags_f, 11);
+    TEST_ASSERT_EQUAL_HEX32(flags, boot_flags.word[0]);
+    TEST_ASSERT_TRUE(adcs_bitset_test(boot_flags.word, ADCS_BOOT_INTERNAL_FLASH_ERR));
 
     // Program info
     uint8_t index = 5;
@@ -242,7 +244,9 @@ void test_ADCS_ACP_telemetries(void) {
     uint8_t flags_f[52] = {0, 1, 0, 1, 1, 1, 1, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
                            0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0};
     // A723CF150	0x16E7(2LSB)1
-    TEST_ASSERT_EQUAL_UINT8_ARRAY(data.flags_arr, flags_f, 36);
+    for (int i = 0; i < 36; i++) {
+        TEST_ASSERT_EQUAL_UINT8(flags_f[i], adcs_bitset_test(data.flags.word, i));
+    }
     TEST_ASSERT_EQUAL_UINT8(data.MTM_sample_mode, 3);
     TEST_ASSERT_FLOAT_WITHIN(0.001, data.est_angle.x, anglex * 0.01);
     TEST_ASSERT_FLOAT_WITHIN(0.001, data.est_angle.z, anglez * 0.01);
@@ -369,7 +373,6 @@ void test_ADCS_ACP_telemetries(void) {
     reply[2] = RAW_STAR_TRACKER_ID;
     uint8_t flags = 0x5B;
     reply[9] = flags;
-    uint8_t flags_star[11] = {1, 1, 0, 1, 1, 0, 1, 0}; // B 5
     star_data star_y;
     star_y.confidence = 54;
     star_y.magnitude = 36;
@@ -392,7 +395,7 @@ void test_ADCS_ACP_telemetries(void) {
     uart_receive_ExpectAnyArgs();
     uart_receive_ReturnArrayThruPtr_data(reply, 59);
     ADCS_get_star_tracker(&star_tracker);
-    TEST_ASSERT_EQUAL_UINT8_ARRAY(star_tracker.flags_arr, flags_star, 8);
+    TEST_ASSERT_EQUAL_HEX32(flags, star_tracker.flags.word[0]);
     TEST_ASSERT_EQUAL_UINT8(star_tracker.star2.confidence, star_y.confidence);
     TEST_ASSERT_EQUAL_UINT16(star_tracker.star2.magnitude, star_y.magnitude);
     TEST_ASSERT_EQUAL_UINT16(star_tracker.star2.catalouge_num, star_y.catalouge_num);
@@ -453,13 +456,15 @@ void test_uint82int16(void) {
 }
 
 void test_get_3x3(void) {
-    int16_t mat[9] = {-132, 35, 471, 203, 14, 87, -148, -1, 1784};
+    int16_t mat[9] = {-132, 35, 471, 203, -14, 87, -148, -1, 1784};
     uint8_t frame[18];
     memcpy(&frame[0], &mat[0], 18);
     adcs_config config;
     get_3x3(&config.MTM1.sensitivity_mat[0], &frame[0], 1);
     TEST_ASSERT_FLOAT_WITHIN(0.1, config.MTM1.sensitivity_mat[0], mat[0]);
     TEST_ASSERT_FLOAT_WITHIN(0.1, config.MTM1.sensitivity_mat[3], mat[5]);
+    TEST_ASSERT_FLOAT_WITHIN(0.1, config.MTM1.sensitivity_mat[2], mat[4]);
+    TEST_ASSERT_FLOAT_WITHIN(0.1, config.MTM1.sensitivity_mat[5], mat[6]);
 }
 
 void test_ADCS_Common_configMsgs(void) {
@@ -512,9 +517,9 @@ void test_ADCS_ACP_set_configMsgs(void) {
     TEST_ASSERT_EQUAL_INT(ADCS_OK, ADCS_set_attitude_angle(angle));
 
     // Set log
-    uint8_t flags[80] = {0};
-    flags[57] = 1;
-    flags[59] = 1;
+    adcs_log_select flags = {0};
+    adcs_bitset_assign(flags.word, 57, true);
+    adcs_bitset_assign(flags.word, 59, true);
     uint16_t period = 2560;
     uint8_t dest = 1;
     uart_send_Ignore();
@@ -554,8 +559,7 @@ void test_ADCS_ACP_set_configMsgs(void) {
 
     // Set estimation
     estimation_config estimate;
-    uint8_t arr[7] = {1, 0, 0, 1, 1, 0, 1};
-    memcpy(&estimate.select_arr, &arr, 7);
+    estimate.select.word[0] = 0x59; // 1011001
     estimate.MTM_mode = 2;
     estimate.MTM_select = 3;
     uart_send_Ignore();
@@ -603,14 +607,14 @@ void test_ADCS_ACP_get_configMsgs(void) {
     reply[17] = ADCS_EOM;
     uint16_t period_f;
     uint8_t dest_f;
-    uint8_t flags_arr[80] = {0};
+    adcs_log_select select;
     uart_send_Ignore();
     uart_receive_ExpectAnyArgs();
     uart_receive_ReturnArrayThruPtr_data(reply, 18);
-    ADCS_get_log_config(flags_arr, &period_f, &dest_f, log);
+    ADCS_get_log_config(&select, &period_f, &dest_f, log);
     TEST_ASSERT_EQUAL_UINT8(dest, dest_f);
     TEST_ASSERT_EQUAL_UINT16(period, period_f);
-    TEST_ASSERT_EQUAL_UINT8(flags_arr[8] + flags_arr[14], 2);
+    TEST_ASSERT_EQUAL_HEX32(0x4100, select.word[0]);
 
     // Get SGP4
     double MA = -8956.214;
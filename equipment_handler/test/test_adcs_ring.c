@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_ring.h"
+#include "unity.h"
+
+static uint8_t storage[8];
+static adcs_ring ring;
+
+void setUp(void) { adcs_ring_init(&ring, storage, sizeof(storage)); }
+
+void tearDown(void) {}
+
+void test_ADCS_ring_fill_and_drain(void) {
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(adcs_ring_put(&ring, i));
+    }
+    TEST_ASSERT_FALSE(adcs_ring_put(&ring, 8)); // full
+    TEST_ASSERT_EQUAL_UINT32(8, adcs_ring_count(&ring));
+
+    uint8_t out[8];
+    uint8_t expected[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    TEST_ASSERT_EQUAL_UINT32(8, adcs_ring_read(&ring, out, 8));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, 8);
+    TEST_ASSERT_EQUAL_UINT32(0, adcs_ring_count(&ring));
+}
+
+void test_ADCS_ring_bulk_read_wraps(void) {
+    uint8_t out[6];
+    for (uint8_t i = 0; i < 5; i++) {
+        adcs_ring_put(&ring, i);
+    }
+    adcs_ring_read(&ring, NULL, 5); // discard, tail now at 5
+
+    uint8_t expected[6] = {10, 11, 12, 13, 14, 15};
+    for (uint8_t i = 0; i < 6; i++) {
+        adcs_ring_put(&ring, 10 + i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(6, adcs_ring_read(&ring, out, 6));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, 6);
+}
+
+void test_ADCS_ring_short_read_and_flush(void) {
+    uint8_t out[4];
+    adcs_ring_put(&ring, 0xAA);
+    adcs_ring_put(&ring, 0xBB);
+    TEST_ASSERT_EQUAL_UINT32(2, adcs_ring_read(&ring, out, 4));
+
+    adcs_ring_put(&ring, 0xCC);
+    adcs_ring_flush(&ring);
+    TEST_ASSERT_EQUAL_UINT32(0, adcs_ring_count(&ring));
+}
+
+void test_ADCS_ring_external_producer(void) {
+    // DMA writes straight into the storage and the head is published afterwards
+    storage[0] = 0x1F;
+    storage[1] = 0x7F;
+    adcs_ring_produced(&ring, 2);
+    uint8_t out[2];
+    TEST_ASSERT_EQUAL_UINT32(2, adcs_ring_read(&ring, out, 2));
+    TEST_ASSERT_EQUAL_UINT8(0x1F, out[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x7F, out[1]);
+}
+
+void test_ADCS_ring_peek_is_contiguous(void) {
+    const uint8_t *data;
+    for (uint8_t i = 0; i < 6; i++) {
+        adcs_ring_put(&ring, i);
+    }
+    adcs_ring_read(&ring, NULL, 6);
+    for (uint8_t i = 0; i < 4; i++) {
+        adcs_ring_put(&ring, 20 + i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, adcs_ring_peek(&ring, &data)); // up to the end of storage
+    TEST_ASSERT_EQUAL_UINT8(20, data[0]);
+    adcs_ring_read(&ring, NULL, 2);
+    TEST_ASSERT_EQUAL_UINT32(2, adcs_ring_peek(&ring, &data));
+    TEST_ASSERT_EQUAL_UINT8(22, data[0]);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "adcs_stats.h"
+#include "unity.h"
+
+void setUp(void) { adcs_stats_reset(); }
+
+void tearDown(void) {}
+
+void test_ADCS_stats_accumulate(void) {
+    adcs_id_stats stats;
+
+    adcs_stats_record(128, 5, 13, 3, false);
+    adcs_stats_record(128, 5, 0, 300, true);
+    adcs_stats_get(128, &stats);
+
+    TEST_ASSERT_EQUAL_UINT32(2, stats.calls);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.timeouts);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.bytes_sent);
+    TEST_ASSERT_EQUAL_UINT32(13, stats.bytes_received);
+    TEST_ASSERT_EQUAL_UINT16(1, stats.rtt_hist[2]); // 2-3 ms
+    TEST_ASSERT_EQUAL_UINT16(1, stats.rtt_hist[9]); // 256-511 ms
+
+    adcs_stats_get(129, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.calls);
+}
+
+void test_ADCS_stats_histogram_edges(void) {
+    adcs_id_stats stats;
+
+    adcs_stats_record(1, 0, 0, 0, false);
+    adcs_stats_record(1, 0, 0, 1, false);
+    adcs_stats_record(1, 0, 0, 100000, false);
+    adcs_stats_get(1, &stats);
+
+    TEST_ASSERT_EQUAL_UINT16(1, stats.rtt_hist[0]);
+    TEST_ASSERT_EQUAL_UINT16(1, stats.rtt_hist[1]);
+    TEST_ASSERT_EQUAL_UINT16(1, stats.rtt_hist[ADCS_STATS_BUCKETS - 1]);
+}
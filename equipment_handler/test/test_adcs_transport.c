@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adcs_transport.h"
+#include "unity.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_ADCS_transport_select(void) {
+    TEST_ASSERT_EQUAL_INT(ADCS_INVALID_PARAMETERS, adcs_select_transport(ADCS_TRANSPORT_COUNT));
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, adcs_select_transport(ADCS_TRANSPORT_LOOPBACK));
+    TEST_ASSERT_EQUAL_PTR(&adcs_loopback_transport, adcs_active_transport());
+}
+
+void test_ADCS_transport_loopback_echoes_last_command(void) {
+    const adcs_transport *loopback = adcs_get_transport(ADCS_TRANSPORT_LOOPBACK);
+    uint8_t command[4] = {0x11, 1, 2, 3};
+    uint8_t telemetry[5];
+    uint8_t expected[5] = {1, 2, 3, 0, 0};
+
+    memset(telemetry, 0xAA, sizeof(telemetry));
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, loopback->send_telecommand(command, 4));
+    TEST_ASSERT_EQUAL_INT(ADCS_OK, loopback->request_telemetry(0x91, telemetry, 5));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, telemetry, 5);
+}
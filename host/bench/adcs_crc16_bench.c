@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_crc16_bench.c
+ * @brief
+ *      Throughput of the CRC16 variants over download blocks.
+ *
+ *      adcs_crc16_bench [megabytes]
+ */
+
+#define _GNU_SOURCE
+
+#include "adcs_crc16.h"
+#include "adcs_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef uint16_t (*crc16_update)(uint16_t crc, const uint8_t *data, uint32_t length);
+
+// One bit at a time, what the tables replace
+static uint16_t crc16_bitwise(uint16_t crc, const uint8_t *data, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// The download feeds one burst packet at a time
+static uint16_t crc16_per_packet(uint16_t crc, const uint8_t *data, uint32_t length) {
+    for (uint32_t pos = 0; pos < length; pos += ADCS_DL_PACKET_LEN) {
+        uint32_t len = (length - pos < ADCS_DL_PACKET_LEN) ? length - pos : ADCS_DL_PACKET_LEN;
+        crc = adcs_crc16_update(crc, data + pos, len);
+    }
+    return crc;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench(const char *name, crc16_update update, const uint8_t *block, uint32_t blocks) {
+    uint16_t crc = ADCS_CRC16_INIT;
+    double start = now_s();
+
+    for (uint32_t i = 0; i < blocks; i++) {
+        crc = update(crc, block, ADCS_DL_BLOCK_LEN);
+    }
+    double elapsed = now_s() - start;
+    printf("%-12s %8.1f MB/s  (crc 0x%04X)\n", name, (double)blocks * ADCS_DL_BLOCK_LEN / elapsed / 1e6, crc);
+}
+
+int main(int argc, char **argv) {
+    uint32_t megabytes = (argc > 1) ? strtoul(argv[1], NULL, 0) : 64;
+    uint32_t blocks = megabytes * 1000000 / ADCS_DL_BLOCK_LEN + 1;
+    static uint8_t block[ADCS_DL_BLOCK_LEN];
+
+    for (uint32_t i = 0; i < sizeof(block); i++) {
+        block[i] = (uint8_t)rand();
+    }
+    bench("bitwise", crc16_bitwise, block, blocks);
+    bench("bytewise", adcs_crc16_update_bytewise, block, blocks);
+    bench("slice-by-4", adcs_crc16_update, block, blocks);
+    bench("per packet", crc16_per_packet, block, blocks);
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file FreeRTOS.h
+ * @brief
+ *      Minimal stand-in for the FreeRTOS headers used by the blocking handler API in a
+ *      native host build. Build against the FreeRTOS POSIX port instead to use adcs_async.c.
+ */
+
+#ifndef ADCS_HOST_FREERTOS_H
+#define ADCS_HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms)) // host ticks are milliseconds
+
+#define pvPortMalloc(size) malloc(size)
+#define vPortFree(ptr) free(ptr)
+
+#endif /* ADCS_HOST_FREERTOS_H */
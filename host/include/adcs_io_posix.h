@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_io_posix.h
+ */
+
+#ifndef ADCS_IO_POSIX_H
+#define ADCS_IO_POSIX_H
+
+#include "adcs_io.h"
+
+// Environment variable naming the serial device/pty init_adcs_io opens when no link is attached
+#define ADCS_HOST_PORT_ENV "ADCS_HOST_PORT"
+
+int adcs_io_posix_open(const char *path);
+void adcs_io_posix_attach(int fd);
+
+#endif /* ADCS_IO_POSIX_H */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file os_portable.h
+ * @brief
+ *      Host build stand-in, the handler needs nothing beyond FreeRTOS.h
+ */
+
+#ifndef ADCS_HOST_OS_PORTABLE_H
+#define ADCS_HOST_OS_PORTABLE_H
+
+#include "FreeRTOS.h"
+
+#endif /* ADCS_HOST_OS_PORTABLE_H */
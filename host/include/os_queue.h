@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file os_queue.h
+ * @brief
+ *      Host build stand-in: a FreeRTOS queue as a ring of fixed size items under a pthread
+ *      mutex, copied in and out by value like the real one
+ */
+
+#ifndef ADCS_HOST_OS_QUEUE_H
+#define ADCS_HOST_OS_QUEUE_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    UBaseType_t length, size, head, count;
+    uint8_t items[];
+} adcs_host_queue;
+
+typedef adcs_host_queue *QueueHandle_t;
+
+static inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t size) {
+    adcs_host_queue *queue = malloc(sizeof(*queue) + length * size);
+    if (queue == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    queue->length = length;
+    queue->size = size;
+    queue->head = queue->count = 0;
+    return queue;
+}
+
+static inline void vQueueDelete(QueueHandle_t queue) {
+    pthread_cond_destroy(&queue->changed);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue);
+}
+
+// Wait under the queue lock until ready() holds, false once wait ticks (milliseconds) have passed
+static inline bool adcs_host_queue_wait(adcs_host_queue *queue, bool (*ready)(const adcs_host_queue *),
+                                        TickType_t wait) {
+    struct timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec += wait / 1000;
+    until.tv_nsec += (long)(wait % 1000) * 1000000;
+    if (until.tv_nsec >= 1000000000) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000;
+    }
+    while (!ready(queue)) {
+        if (wait == portMAX_DELAY) {
+            pthread_cond_wait(&queue->changed, &queue->lock);
+        } else if (pthread_cond_timedwait(&queue->changed, &queue->lock, &until) == ETIMEDOUT) {
+            return ready(queue);
+        }
+    }
+    return true;
+}
+
+static inline bool adcs_host_queue_has_space(const adcs_host_queue *queue) { return queue->count < queue->length; }
+
+static inline bool adcs_host_queue_has_item(const adcs_host_queue *queue) { return queue->count > 0; }
+
+static inline BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t wait) {
+    pthread_mutex_lock(&queue->lock);
+    bool sent = adcs_host_queue_wait(queue, adcs_host_queue_has_space, wait);
+    if (sent) {
+        memcpy(&queue->items[((queue->head + queue->count) % queue->length) * queue->size], item, queue->size);
+        queue->count++;
+        pthread_cond_broadcast(&queue->changed);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return sent ? pdPASS : pdFAIL;
+}
+
+#define xQueueSend(queue, item, wait) xQueueSendToBack(queue, item, wait)
+
+static inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait) {
+    pthread_mutex_lock(&queue->lock);
+    bool received = adcs_host_queue_wait(queue, adcs_host_queue_has_item, wait);
+    if (received) {
+        memcpy(item, &queue->items[queue->head * queue->size], queue->size);
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+        pthread_cond_broadcast(&queue->changed);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return received ? pdPASS : pdFAIL;
+}
+
+#endif /* ADCS_HOST_OS_QUEUE_H */
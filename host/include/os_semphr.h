@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file os_semphr.h
+ * @brief
+ *      Host build stand-in: a FreeRTOS semaphore as a queue of one empty item, as the real
+ *      one is. Mutexes do not inherit priority here.
+ */
+
+#ifndef ADCS_HOST_OS_SEMPHR_H
+#define ADCS_HOST_OS_SEMPHR_H
+
+#include "FreeRTOS.h"
+#include "os_queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateBinary(void) { return xQueueCreate(1, 0); }
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    uint8_t none = 0;
+    return xQueueSendToBack(semaphore, &none, 0);
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait) {
+    uint8_t none = 0;
+    return xQueueReceive(semaphore, &none, wait);
+}
+
+// Created given, like the real mutex
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    SemaphoreHandle_t mutex = xSemaphoreCreateBinary();
+    if (mutex != NULL) {
+        xSemaphoreGive(mutex);
+    }
+    return mutex;
+}
+
+#define vSemaphoreDelete(semaphore) vQueueDelete(semaphore)
+
+#endif /* ADCS_HOST_OS_SEMPHR_H */
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file os_task.h
+ * @brief
+ *      Host build stand-in: critical sections map onto one process-wide pthread mutex,
+ *      delays onto usleep and tasks onto detached threads
+ */
+
+#ifndef ADCS_HOST_OS_TASK_H
+#define ADCS_HOST_OS_TASK_H
+
+#include <pthread.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+
+extern pthread_mutex_t adcs_host_critical;
+
+#define taskENTER_CRITICAL() pthread_mutex_lock(&adcs_host_critical)
+#define taskEXIT_CRITICAL() pthread_mutex_unlock(&adcs_host_critical)
+
+typedef void (*TaskFunction_t)(void *);
+typedef pthread_t *TaskHandle_t;
+
+static inline void vTaskDelay(TickType_t ticks) { usleep((useconds_t)ticks * 1000); }
+
+typedef struct {
+    TaskFunction_t task;
+    void *param;
+} adcs_host_task;
+
+static inline void *adcs_host_task_run(void *arg) {
+    adcs_host_task start = *(adcs_host_task *)arg;
+    free(arg);
+    start.task(start.param);
+    return NULL;
+}
+
+// Stack depth and priority are left to the host scheduler, and the handle is only set as a non-NULL token
+static inline BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint16_t depth, void *param,
+                                     UBaseType_t priority, TaskHandle_t *handle) {
+    static pthread_t thread;
+    adcs_host_task *start = malloc(sizeof(*start));
+    (void)name;
+    (void)depth;
+    (void)priority;
+    if (start == NULL) {
+        return pdFAIL;
+    }
+    *start = (adcs_host_task){task, param};
+    if (pthread_create(&thread, NULL, adcs_host_task_run, start) != 0) {
+        free(start);
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (handle != NULL) {
+        *handle = &thread;
+    }
+    return pdPASS;
+}
+
+#endif /* ADCS_HOST_OS_TASK_H */
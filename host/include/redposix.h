@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file redposix.h
+ * @brief
+ *      Host build stand-in for the Reliance Edge POSIX-like API, backed by the host filesystem
+ */
+
+#ifndef ADCS_HOST_REDPOSIX_H
+#define ADCS_HOST_REDPOSIX_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#define RED_O_RDONLY O_RDONLY
+#define RED_O_WRONLY O_WRONLY
+#define RED_O_RDWR O_RDWR
+#define RED_O_CREAT O_CREAT
+#define RED_O_TRUNC O_TRUNC
+#define RED_O_APPEND O_APPEND
+#define RED_SEEK_SET SEEK_SET
+#define RED_SEEK_CUR SEEK_CUR
+#define RED_SEEK_END SEEK_END
+
+#define red_errno errno
+
+static inline int32_t red_open(const char *path, uint32_t flags) { return open(path, (int)flags, 0644); }
+static inline int32_t red_close(int32_t fd) { return close(fd); }
+static inline int32_t red_read(int32_t fd, void *buf, uint32_t len) { return (int32_t)read(fd, buf, len); }
+static inline int32_t red_write(int32_t fd, const void *buf, uint32_t len) { return (int32_t)write(fd, buf, len); }
+static inline int64_t red_lseek(int32_t fd, int64_t offset, int whence) { return lseek(fd, offset, whence); }
+static inline int32_t red_fsync(int32_t fd) { return fsync(fd); }
+static inline int32_t red_unlink(const char *path) { return unlink(path); }
+static inline int32_t red_rename(const char *from, const char *to) { return rename(from, to); }
+
+#endif /* ADCS_HOST_REDPOSIX_H */
@@ -0,0 +1,644 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_sim.c
+ * @brief
+ *      Stateful model of the Common, Bootloader and ACP TC/TM tables in adcs_types.h.
+ *      Config messages read back through their GET ID and GET_FULL_CONFIG_ID, the
+ *      file list, download and upload blocks honour their hole maps.
+ */
+
+#include "adcs_sim.h"
+#include "adcs_crc16.h"
+#include "adcs_frames.h"
+#include "adcs_types.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define UNKNOWN_TC (-1)
+#define NO_GET 0
+#define NO_FULL_CONFIG 0xFFFF
+
+#define HOLE_MAP_SET_FIRST (SET_HOLE_MAP_ID + 1)
+#define HOLE_MAP_GET_FIRST (GET_HOLE_MAP_ID + 1)
+
+// Parameter bytes (after the ID) of every telecommand that takes parameters
+static const int16_t tc_length[128] = {
+    [RESET_ID] = RESET_LEN,
+    [SET_CURRENT_UNIX_TIME] = SET_CURRENT_UNIX_TIME_LEN,
+    [SET_CACHE_EN_STATE_ID] = SET_CACHE_EN_STATE_LEN,
+    [SET_SRAM_SCRUB_PARAM_ID] = SET_SRAM_SCRUB_PARAM_LEN,
+    [SET_UNIX_TIME_SAVE_ID] = SET_UNIX_TIME_SAVE_LEN,
+    [ADCS_RUN_MODE_ID] = ADCS_RUN_MODE_LEN,
+    [SET_POWER_CONTROL_ID] = SET_POWER_CONTROL_LEN,
+    [CLEAR_LATCHED_ERRS_ID] = CLEAR_LATCHED_ERRS_LEN,
+    [SET_ATT_CONTROL_MODE_ID] = SET_ATT_CONTROL_MODE_LEN,
+    [SET_ATT_ESTIMATE_MODE_ID] = SET_ATT_ESTIMATE_MODE_LEN,
+    [SET_ATT_ANGLE_ID] = SET_ATT_ANGLE_LEN,
+    [SET_MAGNETORQUER_OUTPUT_ID] = SET_MAGNETORQUER_OUTPUT_LEN,
+    [SET_WHEEL_SPEED_ID] = SET_WHEEL_SPEED_LEN,
+    [TRIGGER_ADCS_LOOP_SIM_ID] = TRIGGER_ADCS_LOOP_SIM_LEN,
+    [SET_MTQ_CONFIG_ID] = SET_MTQ_CONFIG_LEN,
+    [SET_WHEEL_CONFIG_ID] = SET_WHEEL_CONFIG_LEN,
+    [SET_RATE_GYRO_CONFIG_ID] = SET_RATE_GYRO_CONFIG_LEN,
+    [SET_CSS_CONFIG_ID] = SET_CSS_CONFIG_LEN,
+    [SET_CUBESENSE_CONFIG_ID] = SET_CUBESENSE_CONFIG_LEN,
+    [SET_MTM_CONFIG_ID] = SET_MTM_CONFIG_LEN,
+    [SET_ESTIMATE_PARAM] = SET_ESTIMATE_PARAM_LEN,
+    [SET_ASGP4_PARAM_ID] = SET_ASGP4_PARAM_LEN,
+    [SET_USERCODED_PARAM_ID] = SET_USERCODED_PARAM_LEN,
+    [SET_SYSTEM_CONFIG_ID] = SET_SYSTEM_CONFIG_LEN,
+    [ASGP4_RUN_MODE_ID] = ASGP4_RUN_MODE_LEN,
+    [FORMAT_SD_CARD_ID] = FORMAT_SD_CARD_LEN,
+    [SET_INERTIAL_POINT_ID] = SET_INERTIAL_POINT_LEN,
+    [SET_MTM2_CONFIG_ID] = SET_MTM2_CONFIG_LEN,
+    [SET_STAR_TRACK_CONFIG_ID] = SET_STAR_TRACK_CONFIG_LEN,
+    [SET_DETUMBLE_PARAM_ID] = SET_DETUMBLE_PARAM_LEN,
+    [SET_YWHEEL_CTRL_PARAM_ID] = SET_YWHEEL_CTRL_PARAM_LEN,
+    [SET_RWHEEL_CTRL_PARAM_ID] = SET_RWHEEL_CTRL_PARAM_LEN,
+    [SET_MOMENT_INERTIA_MAT_ID] = SET_MOMENT_INERTIA_MAT_LEN,
+    [SET_SGP4_ORBIT_PARAMS_ID] = SET_SGP4_ORBIT_PARAMS_LEN,
+    [SET_TRACK_CTRL_ID] = SET_TRACK_CTRL_LEN,
+    [SET_TRACK_CTRLER_TARGET_REF_ID] = SET_TRACK_CTRLER_TARGET_REF_LEN,
+    [SET_MTM_OP_MODE_ID] = SET_MTM_OP_MODE_LEN,
+    [CNV2JPG_ID] = CNV2JPG_LEN,
+    [SAVE_IMG_ID] = SAVE_IMG_LEN,
+    [SET_BOOT_INDEX_ID] = SET_BOOT_INDEX_LEN,
+    [READ_PROGRAM_INFO_ID] = READ_PROGRAM_INFO_LEN,
+    [COPY_PROGRAM_INTERNAL_FLASH_ID] = COPY_PROGRAM_INTERNAL_FLASH_LEN,
+    [SET_SD_LOG1_CONFIG_ID] = SET_SD_LOG1_CONFIG_LEN,
+    [SET_SD_LOG2_CONFIG_ID] = SET_SD_LOG2_CONFIG_LEN,
+    [SET_UART_LOG_CONFIG_ID] = SET_UART_LOG_CONFIG_LEN,
+    [ERASE_FILE_ID] = ERASE_FILE_LEN,
+    [LOAD_FILE_DOWNLOAD_BLOCK_ID] = LOAD_FILE_DOWNLOAD_BLOCK_LEN,
+    [INITIATE_FILE_UPLOAD_ID] = INITIATE_FILE_UPLOAD_LEN,
+    [FILE_UPLOAD_PACKET_ID] = 2 + ADCS_SIM_PACKET_LEN,
+    [FINALIZE_UPLOAD_BLOCK_ID] = FINALIZE_UPLOAD_BLOCK_LEN,
+    [INITIATE_DOWNLOAD_BURST_ID] = INITIATE_DOWNLOAD_BURST_LEN,
+    [120] = ADCS_SIM_HOLE_MAP_LEN, [121] = ADCS_SIM_HOLE_MAP_LEN, [122] = ADCS_SIM_HOLE_MAP_LEN,
+    [123] = ADCS_SIM_HOLE_MAP_LEN, [124] = ADCS_SIM_HOLE_MAP_LEN, [125] = ADCS_SIM_HOLE_MAP_LEN,
+    [126] = ADCS_SIM_HOLE_MAP_LEN, [127] = ADCS_SIM_HOLE_MAP_LEN,
+};
+
+// Telecommands without parameters
+static const uint8_t tc_no_params[] = {
+    RESET_LOG_POINTER_ID, ADVANCE_LOG_POINTER_ID, RESET_BOOT_REGISTERS_ID, TRIGGER_ADCS_LOOP_ID,
+    ASGP4_TRIGGER_ID, SAVE_CONFIG_ID, SAVE_ORBIT_PARAMS, RUN_SELECTED_PROGRAM_ID,
+    ADVANCE_FILE_LIST_READ_POINTER_ID, RESET_UPLOAD_BLOCK_ID, RESET_FILE_LIST_READ_POINTER_ID,
+};
+
+// Telemetry frame lengths, ACP side of the ID 233 clash (see sim_tm_length)
+static const uint16_t tm_length[256] = {
+    [NODE_IDENTIFICATION_ID] = NODE_IDENTIFICATION_LEN,
+    [BOOT_RUNNING_STAT] = BOOT_RUNNING_STAT_LEN,
+    [BOOT_IDX_STAT] = BOOT_IDX_STAT_LEN,
+    [GET_CACHE_EN_STATE_ID] = GET_CACHE_EN_STATE_LEN,
+    [GET_BOOTLOADER_STATE_ID] = GET_BOOTLOADER_STATE_LEN,
+    [JPG_CNV_PROGRESS_ID] = JPG_CNV_PROGRESS_LEN,
+    [GET_SRAM_SCRUB_PARAM_ID] = GET_SRAM_SCRUB_PARAM_LEN,
+    [CUBEACP_STATE_FLAGS_ID] = CUBEACP_STATE_FLAGS_LEN,
+    [GET_CURRENT_UNIX_TIME] = GET_CURRENT_UNIX_TIME_LEN,
+    [LAST_LOGGED_EVENT_ID] = LAST_LOGGED_EVENT_LEN,
+    [SRAM_LATCHUP_COUNT_ID] = SRAM_LATCHUP_COUNT_LEN,
+    [EDAC_ERR_COUNT_ID] = EDAC_ERR_COUNT_LEN,
+    [COMMS_STAT_ID] = COMMS_STAT_LEN,
+    [GET_UNIX_TIME_SAVE_ID] = GET_UNIX_TIME_SAVE_LEN,
+    [SATELLITE_POSITION_LLH_ID] = SATELLITE_POSITION_LLH_LEN,
+    [ADCS_STATE] = ADCS_STATE_LEN,
+    [ADCS_MEASUREMENTS_ID] = ADCS_MEASUREMENTS_LEN,
+    [ACTUATOR_ID] = ACTUATOR_LEN,
+    [ESTIMATION_ID] = ESTIMATION_LEN,
+    [RAW_SENSOR_MEASUREMENTS_ID] = RAW_SENSOR_MEASUREMENTS_LEN,
+    [POWER_TEMP_ID] = POWER_TEMP_LEN,
+    [ADCS_EXE_TIMES_ID] = ADCS_EXE_TIMES_LEN,
+    [GET_POWER_CONTROL_ID] = GET_POWER_CONTROL_LEN,
+    [GET_ATT_ANGLE_ID] = GET_ATT_ANGLE_LEN,
+    [GET_TRACK_CTRLER_TARGET_REF_ID] = GET_TRACK_CTRLER_TARGET_REF_LEN,
+    [GET_CUBESENSE_CONFIG_ID] = GET_CUBESENSE_CONFIG_LEN,
+    [GET_FULL_CONFIG_ID] = GET_FULL_CONFIG_LEN,
+    [GET_SGP4_ORBIT_PARAMS_ID] = GET_SGP4_ORBIT_PARAMS_LEN,
+    [RAW_GPS_MEASUREMENTS_ID] = RAW_GPS_MEASUREMENTS_LEN,
+    [RAW_STAR_TRACKER_ID] = RAW_STAR_TRACKER_LEN,
+    [MTM2_MEASUREMENTS_ID] = MTM2_MEASUREMENTS_LEN,
+    [ACP_EXE_STATE_ID] = ACP_EXE_STATE_LEN,
+    [GET_SYSTEM_CONFIG_ID] = GET_SYSTEM_CONFIG_LEN,
+    [ASGP4_TLEs_ID] = ASGP4_TLEs_LEN,
+    [GET_PROGRAM_INFO_ID] = GET_PROGRAM_INFO_LEN,
+    [IMG_CAPTURE_SAVE_OP_STAT] = IMG_CAPTURE_SAVE_OP_STAT_LEN,
+    [SD_FORMAT_PROGRESS] = SD_FORMAT_PROGRESS_LEN,
+    [GET_SD_LOG1_CONFIG_ID] = GET_SD_LOG1_CONFIG_LEN,
+    [GET_SD_LOG2_CONFIG_ID] = GET_SD_LOG2_CONFIG_LEN,
+    [GET_UART_LOG_CONFIG_ID] = GET_UART_LOG_CONFIG_LEN,
+    [GET_INERTIAL_POINT_ID] = GET_INERTIAL_POINT_LEN,
+    [LAST_TC_ACK_ID] = LAST_TC_ACK_LEN,
+    [FILE_DL_BUFFER_ID] = 2 + ADCS_SIM_PACKET_LEN,
+    [DL_BLOCK_STAT_ID] = DL_BLOCK_STAT_LEN,
+    [FILE_INFO_ID] = FILE_INFO_LEN,
+    [INIT_UPLOAD_STAT_ID] = INIT_UPLOAD_STAT_LEN,
+    [FINIALIZE_UPLOAD_STAT_ID] = FINIALIZE_UPLOAD_STAT_LEN,
+    [UPLOAD_CRC16_ID] = UPLOAD_CRC16_LEN,
+    [247] = ADCS_SIM_HOLE_MAP_LEN, [248] = ADCS_SIM_HOLE_MAP_LEN, [249] = ADCS_SIM_HOLE_MAP_LEN,
+    [250] = ADCS_SIM_HOLE_MAP_LEN, [251] = ADCS_SIM_HOLE_MAP_LEN, [252] = ADCS_SIM_HOLE_MAP_LEN,
+    [253] = ADCS_SIM_HOLE_MAP_LEN, [254] = ADCS_SIM_HOLE_MAP_LEN,
+};
+
+// Where each config message is kept: its own GET frame and/or a slice of GET_FULL_CONFIG_ID
+typedef struct {
+    uint8_t set_id;
+    uint8_t get_id;
+    uint16_t full_offset;
+} config_slot;
+
+static const config_slot config_slots[] = {
+    {SET_CACHE_EN_STATE_ID, GET_CACHE_EN_STATE_ID, NO_FULL_CONFIG},
+    {SET_SRAM_SCRUB_PARAM_ID, GET_SRAM_SCRUB_PARAM_ID, NO_FULL_CONFIG},
+    {SET_UNIX_TIME_SAVE_ID, GET_UNIX_TIME_SAVE_ID, NO_FULL_CONFIG},
+    {SET_CURRENT_UNIX_TIME, GET_CURRENT_UNIX_TIME, NO_FULL_CONFIG},
+    {SET_POWER_CONTROL_ID, GET_POWER_CONTROL_ID, NO_FULL_CONFIG},
+    {SET_ATT_ANGLE_ID, GET_ATT_ANGLE_ID, NO_FULL_CONFIG},
+    {SET_TRACK_CTRLER_TARGET_REF_ID, GET_TRACK_CTRLER_TARGET_REF_ID, NO_FULL_CONFIG},
+    {SET_SD_LOG1_CONFIG_ID, GET_SD_LOG1_CONFIG_ID, NO_FULL_CONFIG},
+    {SET_SD_LOG2_CONFIG_ID, GET_SD_LOG2_CONFIG_ID, NO_FULL_CONFIG},
+    {SET_UART_LOG_CONFIG_ID, GET_UART_LOG_CONFIG_ID, NO_FULL_CONFIG},
+    {SET_INERTIAL_POINT_ID, GET_INERTIAL_POINT_ID, NO_FULL_CONFIG},
+    {SET_SGP4_ORBIT_PARAMS_ID, GET_SGP4_ORBIT_PARAMS_ID, NO_FULL_CONFIG},
+    {SET_SYSTEM_CONFIG_ID, GET_SYSTEM_CONFIG_ID, NO_FULL_CONFIG},
+    {SET_MTQ_CONFIG_ID, NO_GET, 0},
+    {SET_WHEEL_CONFIG_ID, NO_GET, 3},
+    {SET_RATE_GYRO_CONFIG_ID, NO_GET, 7},
+    {SET_CSS_CONFIG_ID, NO_GET, 17},
+    {SET_CUBESENSE_CONFIG_ID, GET_CUBESENSE_CONFIG_ID, 38},
+    {SET_MTM_CONFIG_ID, NO_GET, 150},
+    {SET_MTM2_CONFIG_ID, NO_GET, 180},
+    {SET_STAR_TRACK_CONFIG_ID, NO_GET, 210},
+    {SET_DETUMBLE_PARAM_ID, NO_GET, 263},
+    {SET_YWHEEL_CTRL_PARAM_ID, NO_GET, 277},
+    {SET_RWHEEL_CTRL_PARAM_ID, NO_GET, 297},
+    {SET_TRACK_CTRL_ID, NO_GET, 310},
+    {SET_MOMENT_INERTIA_MAT_ID, NO_GET, 323},
+    {SET_ESTIMATE_PARAM, NO_GET, 347},
+    {SET_ASGP4_PARAM_ID, NO_GET, 378},
+    {SET_USERCODED_PARAM_ID, NO_GET, 408},
+};
+
+static struct timespec start_time;
+
+static void put16(uint8_t *dst, uint16_t value) {
+    dst[0] = value & 0xFF;
+    dst[1] = value >> 8;
+}
+
+static void put32(uint8_t *dst, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        dst[i] = (value >> (8 * i)) & 0xFF;
+    }
+}
+
+static uint32_t get32(const uint8_t *src) {
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static int64_t sim_now_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start_time.tv_sec) * 1000 + (now.tv_nsec - start_time.tv_nsec) / 1000000;
+}
+
+static bool hole_map_test(const uint8_t *map, uint32_t packet) { return (map[packet / 8] >> (packet % 8)) & 1; }
+
+static void hole_map_mark(uint8_t *map, uint32_t packet) { map[packet / 8] |= 1 << (packet % 8); }
+
+void adcs_sim_init(adcs_sim *sim) {
+    memset(sim, 0, sizeof(*sim));
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    // Node identification: CubeACP, interface 1, firmware 7.2
+    sim->tm[NODE_IDENTIFICATION_ID][0] = 10;
+    sim->tm[NODE_IDENTIFICATION_ID][1] = 1;
+    sim->tm[NODE_IDENTIFICATION_ID][2] = 7;
+    sim->tm[NODE_IDENTIFICATION_ID][3] = 2;
+    sim->tm[BOOT_RUNNING_STAT][4] = 7;
+    sim->tm[BOOT_RUNNING_STAT][5] = 2;
+    sim->boot_index = 1; // the ACP from internal flash
+}
+
+/**
+ * @brief
+ *      Add a file with deterministic contents to the simulated SD card
+ */
+void adcs_sim_add_file(adcs_sim *sim, uint8_t type, uint8_t counter, uint32_t size) {
+    if (sim->file_count >= ADCS_SIM_MAX_FILES) {
+        return;
+    }
+    adcs_sim_file *file = &sim->files[sim->file_count++];
+    file->type = type;
+    file->counter = counter;
+    file->size = size;
+    file->data = malloc(size ? size : 1);
+    for (uint32_t i = 0; i < size; i++) {
+        file->data[i] = (uint8_t)(i * 31 + type * 7 + counter);
+    }
+}
+
+static adcs_sim_file *sim_find_file(adcs_sim *sim, uint8_t type, uint8_t counter) {
+    for (int i = 0; i < sim->file_count; i++) {
+        if (sim->files[i].type == type && sim->files[i].counter == counter) {
+            return &sim->files[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief
+ *      Where an upload to dest is written: a program slot, or an SD user file created on demand
+ */
+static adcs_sim_file *sim_upload_target(adcs_sim *sim, uint8_t dest) {
+    if (dest < ADCS_SIM_PROGRAMS) {
+        return &sim->programs[dest];
+    }
+    adcs_sim_file *file = sim_find_file(sim, dest, 0);
+    if (file == NULL) {
+        adcs_sim_add_file(sim, dest, 0, 0);
+        file = sim_find_file(sim, dest, 0);
+    }
+    return file;
+}
+
+static void sim_erase_file(adcs_sim *sim, int index) {
+    free(sim->files[index].data);
+    memmove(&sim->files[index], &sim->files[index + 1], (sim->file_count - index - 1) * sizeof(adcs_sim_file));
+    sim->file_count--;
+}
+
+static uint16_t sim_tm_length(const adcs_sim *sim, uint8_t id) {
+    if (id == IMG_CAPTURE_SAVE_OP_STAT && sim->bootloader) {
+        return COPY_INTERNAL_FLASH_PROGRESS_LEN;
+    }
+    return tm_length[id];
+}
+
+static int16_t sim_tc_length(const adcs_sim *sim, uint8_t id) {
+    if (id == CLEAR_ERR_FLAGS_ID) {
+        return sim->bootloader ? CLEAR_ERR_FLAGS_LEN : DEPLOY_MAGNETOMETER_BOOM_LEN;
+    }
+    for (uint32_t i = 0; i < sizeof(tc_no_params); i++) {
+        if (tc_no_params[i] == id) {
+            return 0;
+        }
+    }
+    return (tc_length[id] > 0) ? tc_length[id] : UNKNOWN_TC;
+}
+
+/**
+ * @brief
+ *      Fill in telemetry that is derived from other state rather than stored
+ */
+static void sim_refresh_tm(adcs_sim *sim, uint8_t id) {
+    uint8_t *tm = sim->tm[id];
+
+    if (id == NODE_IDENTIFICATION_ID) {
+        int64_t ms = sim_now_ms();
+        put16(&tm[4], (uint16_t)(ms / 1000));
+        put16(&tm[6], (uint16_t)(ms % 1000));
+    } else if (id == DL_BLOCK_STAT_ID) {
+        if (sim->dl_ready_at_ms != 0 && sim_now_ms() >= sim->dl_ready_at_ms) {
+            tm[0] = 0x1; // ready
+            sim->dl_ready_at_ms = 0;
+        }
+    } else if (id == FINIALIZE_UPLOAD_STAT_ID) {
+        if (sim->ul_done_at_ms != 0 && sim_now_ms() >= sim->ul_done_at_ms) {
+            tm[0] &= ~0x1; // no longer busy
+            sim->ul_done_at_ms = 0;
+        }
+    } else if (id == BOOT_IDX_STAT) {
+        tm[0] = sim->bootloader ? 0 : sim->boot_index;
+    } else if ((id == GET_PROGRAM_INFO_ID || (id == COPY_INTERNAL_FLASH_PROGRESS_ID && sim->bootloader)) &&
+               sim->bl_done_at_ms != 0 && sim_now_ms() >= sim->bl_done_at_ms) {
+        sim->tm[GET_PROGRAM_INFO_ID][1] &= ~0x1;             // no longer busy
+        sim->tm[COPY_INTERNAL_FLASH_PROGRESS_ID][0] &= ~0x1; // the ACP reads this ID as IMG_CAPTURE_SAVE_OP_STAT
+        sim->bl_done_at_ms = 0;
+    } else if (id == LAST_TC_ACK_ID) {
+        memcpy(tm, sim->last_tc, 4);
+    } else if (id == FILE_INFO_ID) {
+        memset(tm, 0, 12);
+        if (sim->file_list_pos < sim->file_count) {
+            adcs_sim_file *file = &sim->files[sim->file_count - 1 - sim->file_list_pos]; // newest first
+            tm[0] = file->type & 0xF;
+            tm[1] = file->counter;
+            put32(&tm[2], file->size);
+            put16(&tm[10], adcs_crc16(file->data, file->size));
+        }
+    } else if (id >= HOLE_MAP_GET_FIRST && id < HOLE_MAP_GET_FIRST + ADCS_SIM_HOLE_MAPS) {
+        memcpy(tm, &sim->ul_hole_map[(id - HOLE_MAP_GET_FIRST) * ADCS_SIM_HOLE_MAP_LEN], ADCS_SIM_HOLE_MAP_LEN);
+    }
+}
+
+static void sim_send_packet(adcs_sim *sim, uint16_t packet, adcs_sim_reply reply, void *link) {
+    uint8_t body[1 + 2 + ADCS_SIM_PACKET_LEN] = {FILE_DL_BUFFER_ID};
+    put16(&body[1], packet);
+    memcpy(&body[3], &sim->dl_block[packet * ADCS_SIM_PACKET_LEN], ADCS_SIM_PACKET_LEN);
+    memcpy(sim->tm[FILE_DL_BUFFER_ID], &body[1], sizeof(body) - 1);
+    reply(link, body, sizeof(body));
+}
+
+static adcs_sim_tcError sim_load_download_block(adcs_sim *sim, const uint8_t *p) {
+    adcs_sim_file *file = sim_find_file(sim, p[0], p[1]);
+    uint32_t offset = get32(&p[2]);
+    uint32_t length = p[6] | (p[7] << 8);
+    uint8_t *stat = sim->tm[DL_BLOCK_STAT_ID];
+
+    memset(stat, 0, 5);
+    if (file == NULL || offset > file->size || length > ADCS_SIM_BLOCK_SIZE) {
+        stat[0] = 0x2; // parameter error
+        return SIM_TC_INVALID_PARAMETERS;
+    }
+    if (length > file->size - offset) {
+        length = file->size - offset;
+    }
+    memset(sim->dl_block, 0, sizeof(sim->dl_block));
+    memcpy(sim->dl_block, file->data + offset, length);
+    sim->dl_length = length;
+    if (sim->sd_delay_ms == 0) {
+        stat[0] = 0x1; // ready
+    } else {
+        sim->dl_ready_at_ms = sim_now_ms() + sim->sd_delay_ms;
+    }
+    put16(&stat[1], adcs_crc16(sim->dl_block, length));
+    put16(&stat[3], length);
+    return SIM_TC_OK;
+}
+
+static adcs_sim_tcError sim_finalize_upload(adcs_sim *sim, const uint8_t *p) {
+    uint8_t dest = p[0];
+    uint32_t offset = get32(&p[1]);
+    uint32_t length = p[5] | (p[6] << 8);
+    uint32_t packets = (length + ADCS_SIM_PACKET_LEN - 1) / ADCS_SIM_PACKET_LEN;
+
+    sim->tm[FINIALIZE_UPLOAD_STAT_ID][0] = 0;
+    if (length > ADCS_SIM_BLOCK_SIZE || dest != sim->ul_dest) {
+        sim->tm[FINIALIZE_UPLOAD_STAT_ID][0] = 0x2;
+        return SIM_TC_INVALID_PARAMETERS;
+    }
+    for (uint32_t i = 0; i < packets; i++) {
+        if (!hole_map_test(sim->ul_hole_map, i)) {
+            sim->tm[FINIALIZE_UPLOAD_STAT_ID][0] = 0x2; // block incomplete
+            return SIM_TC_OK;
+        }
+    }
+
+    adcs_sim_file *file = sim_upload_target(sim, dest);
+    if (file == NULL) {
+        sim->tm[FINIALIZE_UPLOAD_STAT_ID][0] = 0x2;
+        return SIM_TC_OK;
+    }
+    if (offset + length > file->size) {
+        file->data = realloc(file->data, offset + length);
+        memset(file->data + file->size, 0, offset + length - file->size);
+        file->size = offset + length;
+    }
+    memcpy(file->data + offset, sim->ul_block, length);
+    put16(sim->tm[UPLOAD_CRC16_ID], adcs_crc16(sim->ul_block, length));
+    if (sim->sd_delay_ms != 0) {
+        sim->tm[FINIALIZE_UPLOAD_STAT_ID][0] = 0x1; // busy
+        sim->ul_done_at_ms = sim_now_ms() + sim->sd_delay_ms;
+    }
+    return SIM_TC_OK;
+}
+
+/**
+ * @brief
+ *      Capture and save: a BMP file with the next counter appears straight away, complete
+ */
+static adcs_sim_tcError sim_save_image(adcs_sim *sim, const uint8_t *p) {
+    uint8_t counter = 0;
+
+    if (sim->bootloader || p[1] > 4) {
+        return SIM_TC_INVALID_PARAMETERS;
+    }
+    while (sim_find_file(sim, 4, counter) != NULL) {
+        counter++;
+    }
+    uint32_t side = 1024 >> p[1];
+    adcs_sim_add_file(sim, 4, counter, side * side);
+    sim->tm[IMG_CAPTURE_SAVE_OP_STAT][0] = 100; // percent
+    sim->tm[IMG_CAPTURE_SAVE_OP_STAT][1] = 0;   // no error
+    return SIM_TC_OK;
+}
+
+static void sim_bootloader_busy(adcs_sim *sim) {
+    if (sim->sd_delay_ms != 0) {
+        sim->bl_done_at_ms = sim_now_ms() + sim->sd_delay_ms;
+    }
+}
+
+static adcs_sim_tcError sim_read_program_info(adcs_sim *sim, const uint8_t *p) {
+    uint8_t *tm = sim->tm[GET_PROGRAM_INFO_ID];
+    // SD user files 1-8 are program indexes 10-17 but upload destinations 11-17
+    const adcs_sim_file *program =
+        (p[0] < ADCS_SIM_PROGRAMS) ? &sim->programs[p[0]] : sim_find_file(sim, p[0] + 1, 0);
+
+    memset(tm, 0, 8);
+    tm[0] = p[0];
+    tm[1] = (sim->sd_delay_ms != 0) ? 0x1 : 0; // busy
+    if (program != NULL) {
+        put32(&tm[2], program->size);
+        put16(&tm[6], adcs_crc16(program->data, program->size));
+    }
+    sim_bootloader_busy(sim);
+    return SIM_TC_OK;
+}
+
+static adcs_sim_tcError sim_copy_program(adcs_sim *sim, const uint8_t *p) {
+    adcs_sim_file *internal = &sim->programs[1];
+    uint8_t *progress = sim->tm[COPY_INTERNAL_FLASH_PROGRESS_ID];
+
+    if (p[0] < 2 || p[0] >= ADCS_SIM_PROGRAMS) {
+        return SIM_TC_INVALID_PARAMETERS;
+    }
+    const adcs_sim_file *src = &sim->programs[p[0]];
+    if (src->size == 0) {
+        progress[0] = 0x2; // error
+        return SIM_TC_OK;
+    }
+    internal->data = realloc(internal->data, src->size);
+    memcpy(internal->data, src->data, src->size);
+    internal->size = src->size;
+    progress[0] = (sim->sd_delay_ms != 0) ? 0x1 : 0; // busy
+    sim_bootloader_busy(sim);
+    return SIM_TC_OK;
+}
+
+static adcs_sim_tcError sim_telecommand(adcs_sim *sim, uint8_t id, const uint8_t *p, bool *burst) {
+    for (uint32_t i = 0; i < sizeof(config_slots) / sizeof(config_slots[0]); i++) {
+        const config_slot *slot = &config_slots[i];
+        if (slot->set_id != id) {
+            continue;
+        }
+        uint32_t length = tc_length[id];
+        if (slot->get_id != NO_GET) {
+            memcpy(sim->tm[slot->get_id], p, length);
+        }
+        if (slot->full_offset != NO_FULL_CONFIG) {
+            memcpy(&sim->tm[GET_FULL_CONFIG_ID][slot->full_offset], p, length);
+        }
+        return SIM_TC_OK;
+    }
+
+    if (id >= HOLE_MAP_SET_FIRST && id < HOLE_MAP_SET_FIRST + ADCS_SIM_HOLE_MAPS) {
+        memcpy(&sim->dl_hole_map[(id - HOLE_MAP_SET_FIRST) * ADCS_SIM_HOLE_MAP_LEN], p, ADCS_SIM_HOLE_MAP_LEN);
+        return SIM_TC_OK;
+    }
+
+    switch (id) {
+    case RESET_ID:
+        if (p[0] != ADCS_MAGIC_NUMBER) {
+            return SIM_TC_INVALID_PARAMETERS;
+        }
+        put16(&sim->tm[BOOT_RUNNING_STAT][1], (sim->tm[BOOT_RUNNING_STAT][1] | sim->tm[BOOT_RUNNING_STAT][2] << 8) + 1);
+        // Comes back up in the bootloader, with no upload or download in progress
+        sim->bootloader = true;
+        sim->ul_dest = 0;
+        sim->dl_ready_at_ms = 0;
+        sim->bl_done_at_ms = 0;
+        return SIM_TC_OK;
+    case SET_BOOT_INDEX_ID:
+    case RUN_SELECTED_PROGRAM_ID:
+    case READ_PROGRAM_INFO_ID:
+    case COPY_PROGRAM_INTERNAL_FLASH_ID:
+        if (!sim->bootloader) {
+            return SIM_TC_INVALID_ID;
+        }
+        if (id == SET_BOOT_INDEX_ID) {
+            sim->boot_index = p[0];
+        } else if (id == RUN_SELECTED_PROGRAM_ID) {
+            sim->bootloader = false;
+        } else if (id == READ_PROGRAM_INFO_ID) {
+            return sim_read_program_info(sim, p);
+        } else {
+            return sim_copy_program(sim, p);
+        }
+        return SIM_TC_OK;
+    case FORMAT_SD_CARD_ID:
+        while (sim->file_count > 0) {
+            sim_erase_file(sim, sim->file_count - 1);
+        }
+        sim->file_list_pos = 0;
+        return SIM_TC_OK;
+    case ERASE_FILE_ID:
+        for (int i = sim->file_count - 1; i >= 0; i--) {
+            if (p[2] || (sim->files[i].type == p[0] && sim->files[i].counter == p[1])) {
+                sim_erase_file(sim, i);
+            }
+        }
+        return SIM_TC_OK;
+    case ADVANCE_FILE_LIST_READ_POINTER_ID:
+        if (sim->file_list_pos < sim->file_count) {
+            sim->file_list_pos++;
+        }
+        return SIM_TC_OK;
+    case RESET_FILE_LIST_READ_POINTER_ID:
+        sim->file_list_pos = 0;
+        return SIM_TC_OK;
+    case LOAD_FILE_DOWNLOAD_BLOCK_ID:
+        return sim_load_download_block(sim, p);
+    case SAVE_IMG_ID:
+        return sim_save_image(sim, p);
+    case INITIATE_DOWNLOAD_BURST_ID:
+        *burst = true;
+        return SIM_TC_OK;
+    case INITIATE_FILE_UPLOAD_ID:
+        if (p[0] < ADCS_SIM_PROGRAMS) {
+            sim->programs[p[0]].size = 0; // a program slot is erased for the new one
+        }
+        sim->ul_dest = p[0];
+        memset(sim->ul_hole_map, 0, sizeof(sim->ul_hole_map));
+        sim->tm[INIT_UPLOAD_STAT_ID][0] = 0; // not busy
+        return SIM_TC_OK;
+    case FILE_UPLOAD_PACKET_ID: {
+        uint16_t packet = p[0] | (p[1] << 8);
+        if (packet >= ADCS_SIM_BLOCK_PACKETS) {
+            return SIM_TC_INVALID_PARAMETERS;
+        }
+        memcpy(&sim->ul_block[packet * ADCS_SIM_PACKET_LEN], &p[2], ADCS_SIM_PACKET_LEN);
+        hole_map_mark(sim->ul_hole_map, packet);
+        return SIM_TC_OK;
+    }
+    case FINALIZE_UPLOAD_BLOCK_ID:
+        return sim_finalize_upload(sim, p);
+    case RESET_UPLOAD_BLOCK_ID:
+        memset(sim->ul_hole_map, 0, sizeof(sim->ul_hole_map));
+        return SIM_TC_OK;
+    default:
+        return SIM_TC_OK; // accepted, no modelled side effects
+    }
+}
+
+/**
+ * @brief
+ *      Process one received frame and send the reply (and any download burst) through reply
+ * @param id
+ *      TC/TM ID of the frame
+ * @param params
+ *      De-stuffed bytes after the ID
+ * @param length
+ *      Number of bytes in params
+ */
+void adcs_sim_handle(adcs_sim *sim, uint8_t id, const uint8_t *params, uint32_t length, adcs_sim_reply reply,
+                     void *link) {
+    uint8_t body[1 + ADCS_MAX_TM_LEN];
+    body[0] = id;
+
+    if (id & 0x80) {
+        uint16_t tm_len = sim_tm_length(sim, id);
+        if (tm_len == 0) {
+            return; // unknown telemetry is not answered, the OBC times out
+        }
+        sim_refresh_tm(sim, id);
+        memcpy(&body[1], sim->tm[id], tm_len);
+        reply(link, body, 1 + tm_len);
+        return;
+    }
+
+    bool burst = false;
+    adcs_sim_tcError err;
+    int16_t expected = sim_tc_length(sim, id);
+    if (expected == UNKNOWN_TC) {
+        err = SIM_TC_INVALID_ID;
+    } else if ((uint32_t)expected != length) {
+        err = SIM_TC_INCORRECT_LENGTH;
+    } else {
+        err = sim_telecommand(sim, id, params, &burst);
+    }
+
+    sim->last_tc[0] = id;
+    sim->last_tc[1] = 1; // processed
+    sim->last_tc[2] = err;
+    sim->last_tc[3] = 0;
+
+    body[1] = err;
+    reply(link, body, 2);
+
+    if (burst) {
+        bool ignore_hole_map = params[1];
+        uint32_t packets = (sim->dl_length + ADCS_SIM_PACKET_LEN - 1) / ADCS_SIM_PACKET_LEN;
+        for (uint32_t i = 0; i < packets; i++) {
+            if (ignore_hole_map || !hole_map_test(sim->dl_hole_map, i)) {
+                sim_send_packet(sim, i, reply, link);
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_sim.h
+ * @brief
+ *      Protocol model of a CubeADCS, independent of the link it is reached over
+ */
+
+#ifndef ADCS_SIM_H
+#define ADCS_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "adcs_io.h"
+
+#define ADCS_SIM_PACKET_LEN 20
+#define ADCS_SIM_HOLE_MAPS 8
+#define ADCS_SIM_HOLE_MAP_LEN 16
+#define ADCS_SIM_BLOCK_PACKETS (ADCS_SIM_HOLE_MAPS * ADCS_SIM_HOLE_MAP_LEN * 8)
+#define ADCS_SIM_BLOCK_SIZE (ADCS_SIM_BLOCK_PACKETS * ADCS_SIM_PACKET_LEN)
+#define ADCS_SIM_MAX_FILES 64
+#define ADCS_SIM_PROGRAMS 10 // Table 66 program indexes up to external flash program 7
+
+// TC error flags reported in TC replies and LAST_TC_ACK
+typedef enum {
+    SIM_TC_OK = 0,
+    SIM_TC_INVALID_ID = 1,
+    SIM_TC_INCORRECT_LENGTH = 2,
+    SIM_TC_INVALID_PARAMETERS = 3
+} adcs_sim_tcError;
+
+typedef struct {
+    uint8_t type;
+    uint8_t counter;
+    uint32_t size;
+    uint8_t *data;
+} adcs_sim_file;
+
+typedef struct adcs_sim {
+    bool bootloader;    // running the bootloader rather than the ACP
+    uint8_t boot_index; // program the bootloader runs, see SET_BOOT_INDEX_ID
+
+    // Internal flash, EEPROM and external flash programs by Table 66 index, uploads to 2-9 land here
+    adcs_sim_file programs[ADCS_SIM_PROGRAMS];
+    int64_t bl_done_at_ms; // when the bootloader finishes reading or copying a program, 0 if idle
+
+    // Last value of every telemetry frame, written by config messages and TCs
+    uint8_t tm[256][ADCS_MAX_TM_LEN];
+
+    uint8_t last_tc[4];
+
+    adcs_sim_file files[ADCS_SIM_MAX_FILES];
+    uint8_t file_count;
+    uint8_t file_list_pos;
+
+    uint8_t dl_block[ADCS_SIM_BLOCK_SIZE];
+    uint16_t dl_length;
+    uint32_t sd_delay_ms;   // time a block load, upload finalize or program read/copy takes
+    int64_t dl_ready_at_ms; // when the block being loaded becomes ready, 0 if none is loading
+    uint8_t dl_hole_map[ADCS_SIM_HOLE_MAPS * ADCS_SIM_HOLE_MAP_LEN];
+
+    uint8_t ul_block[ADCS_SIM_BLOCK_SIZE];
+    int64_t ul_done_at_ms; // when the block being finalized is written, 0 if none is
+    uint8_t ul_dest;
+    uint8_t ul_hole_map[ADCS_SIM_HOLE_MAPS * ADCS_SIM_HOLE_MAP_LEN];
+} adcs_sim;
+
+// Called for every frame the simulator sends back; body is the TC/TM ID followed by the payload
+typedef void (*adcs_sim_reply)(void *link, const uint8_t *body, uint32_t length);
+
+void adcs_sim_init(adcs_sim *sim);
+void adcs_sim_add_file(adcs_sim *sim, uint8_t type, uint8_t counter, uint32_t size);
+void adcs_sim_handle(adcs_sim *sim, uint8_t id, const uint8_t *params, uint32_t length, adcs_sim_reply reply,
+                     void *link);
+
+#endif /* ADCS_SIM_H */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_sim_main.c
+ * @brief
+ *      Stand-in CubeADCS reachable over a pseudo-terminal or serial device.
+ *
+ *      adcs_sim [-p device] [-b baud] [-l latency_ms] [-d drop_percent] [-L sd_ms] [-B]
+ *
+ *      Without -p a pty is created and its slave path printed; point ADCS_HOST_PORT at it.
+ *      -b paces both directions to the given baud rate (8N1, 0 = unpaced), -l delays each reply,
+ *      -d loses that share of download burst and upload packets, -L makes loading a download block,
+ *      finalizing an upload block and reading or copying a program take that long, -B starts in the
+ *      bootloader instead of the ACP.
+ */
+
+#define _GNU_SOURCE
+
+#include "adcs_frame.h"
+#include "adcs_sim.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    int fd;
+    uint32_t baud;
+    uint32_t latency_ms;
+    uint32_t drop_percent;
+} sim_link;
+
+static adcs_sim sim;
+
+static void sleep_us(uint64_t us) {
+    struct timespec ts = {.tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint64_t wire_us(const sim_link *link, uint32_t bytes) {
+    return (link->baud != 0) ? (uint64_t)bytes * 10 * 1000000 / link->baud : 0; // start + 8 data + stop bits
+}
+
+static void link_reply(void *context, const uint8_t *body, uint32_t length) {
+    sim_link *link = context;
+    if (body[0] == FILE_DL_BUFFER_ID && (uint32_t)(rand() % 100) < link->drop_percent) {
+        return;
+    }
+    uint8_t frame[ADCS_FRAME_ENCODED_MAX(1 + ADCS_MAX_TM_LEN)];
+    uint32_t len = adcs_frame_encode(frame, body, length);
+    uint32_t sent = 0;
+
+    while (sent < len) {
+        ssize_t n = write(link->fd, frame + sent, len - sent);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return;
+        }
+        sent += (uint32_t)n;
+    }
+    sleep_us(wire_us(link, len));
+}
+
+static int open_link(const char *path) {
+    int fd;
+
+    if (path != NULL) {
+        fd = open(path, O_RDWR | O_NOCTTY);
+    } else {
+        fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (fd >= 0 && (grantpt(fd) != 0 || unlockpt(fd) != 0)) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    if (path == NULL) {
+        printf("ADCS simulator on %s\n", ptsname(fd));
+        fflush(stdout);
+    }
+    return fd;
+}
+
+int main(int argc, char **argv) {
+    sim_link link = {.fd = -1, .baud = 115200, .latency_ms = 0, .drop_percent = 0};
+    const char *path = NULL;
+    int opt;
+
+    adcs_sim_init(&sim);
+    while ((opt = getopt(argc, argv, "p:b:l:d:L:B")) != -1) {
+        switch (opt) {
+        case 'p':
+            path = optarg;
+            break;
+        case 'b':
+            link.baud = strtoul(optarg, NULL, 0);
+            break;
+        case 'l':
+            link.latency_ms = strtoul(optarg, NULL, 0);
+            break;
+        case 'd':
+            link.drop_percent = strtoul(optarg, NULL, 0);
+            break;
+        case 'L':
+            sim.sd_delay_ms = strtoul(optarg, NULL, 0);
+            break;
+        case 'B':
+            sim.bootloader = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-p device] [-b baud] [-l latency_ms] [-d drop_percent] [-L sd_ms] [-B]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    // Files the OBC can list and download: event log, telemetry log and two images, one spanning several blocks
+    adcs_sim_add_file(&sim, 2, 0, 4096);
+    adcs_sim_add_file(&sim, 3, 0, 8192);
+    adcs_sim_add_file(&sim, 4, 1, 20000);
+    adcs_sim_add_file(&sim, 4, 2, 102400);
+
+    link.fd = open_link(path);
+    if (link.fd < 0) {
+        perror("adcs_sim: open");
+        return 1;
+    }
+
+    uint8_t params[ADCS_MAX_TC_LEN];
+    uint8_t rx[256];
+    adcs_frame_parser parser;
+    adcs_frame_parser_init(&parser, params, sizeof(params));
+    uint32_t frame_bytes = 0;
+    uint64_t rx_line_us = 0; // when the last frame from the OBC finished arriving at the line rate
+
+    for (;;) {
+        ssize_t n = read(link.fd, rx, sizeof(rx));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            sleep_us(100000); // pty slave not open (yet), keep waiting for a client
+            continue;
+        }
+
+        uint64_t read_us = now_us();
+        uint32_t pos = 0;
+        while (pos < (uint32_t)n) {
+            uint32_t consumed;
+            ADCS_frameState state = adcs_frame_parse(&parser, rx + pos, n - pos, &consumed);
+            pos += consumed;
+            frame_bytes += consumed;
+            if (state == ADCS_FRAME_INCOMPLETE) {
+                continue;
+            }
+
+            // The line is full duplex: frames arrive back to back while replies go out
+            rx_line_us = ((read_us > rx_line_us) ? read_us : rx_line_us) + wire_us(&link, frame_bytes);
+            frame_bytes = 0;
+            uint64_t now = now_us();
+            if (rx_line_us > now) {
+                sleep_us(rx_line_us - now);
+            }
+
+            // Upload packets lost on the way in are neither stored nor acknowledged
+            bool lost = parser.id == FILE_UPLOAD_PACKET_ID && (uint32_t)(rand() % 100) < link.drop_percent;
+            if (state == ADCS_FRAME_COMPLETE && !lost) {
+                if (link.latency_ms != 0) {
+                    sleep_us((uint64_t)link.latency_ms * 1000);
+                }
+                adcs_sim_handle(&sim, parser.id, params, parser.length, link_reply, &link);
+            }
+            adcs_frame_parser_init(&parser, params, sizeof(params));
+        }
+    }
+}
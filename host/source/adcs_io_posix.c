@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+/**
+ * @file adcs_io_posix.c
+ * @brief
+ *      Native replacement for adcs_io.c. Speaks the same UART framing over a file
+ *      descriptor (serial port, pty or socketpair) so the handler can run on Linux.
+ */
+
+#include "adcs_io_posix.h"
+#include "adcs_cursor.h"
+#include "adcs_deadline.h"
+#include "adcs_frame.h"
+#include "adcs_stats.h"
+#include "adcs_types.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+static int adcs_fd = -1;
+static pthread_mutex_t link_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_mutex_t adcs_host_critical = PTHREAD_MUTEX_INITIALIZER; // taskENTER_CRITICAL in host/include/os_task.h
+
+// Wire bytes, start time and deadline budget of the transaction in progress
+static uint32_t xfer_sent;
+static uint32_t xfer_received;
+static struct timespec xfer_start;
+static uint32_t xfer_budget_ms;
+
+static uint8_t tx_frame[ADCS_FRAME_ENCODED_MAX(ADCS_MAX_TC_LEN)];
+
+// Bytes read from the link but not yet parsed, kept across frames for back-to-back packets
+static uint8_t rx_stage[256];
+static uint32_t rx_pos;
+static uint32_t rx_len;
+
+/**
+ * @brief
+ *      Open a serial device or pty as the ADCS link, in raw mode
+ * @return
+ *      0 on success, -1 with errno set otherwise
+ */
+int adcs_io_posix_open(const char *path) {
+    int fd = open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, B115200);
+        cfsetospeed(&tio, B115200);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    adcs_io_posix_attach(fd);
+    return 0;
+}
+
+/**
+ * @brief
+ *      Use an already open descriptor (e.g. one end of a socketpair) as the ADCS link
+ */
+void adcs_io_posix_attach(int fd) {
+    pthread_mutex_lock(&link_mutex);
+    adcs_fd = fd;
+    rx_pos = 0;
+    rx_len = 0;
+    pthread_mutex_unlock(&link_mutex);
+}
+
+void init_adcs_io() {
+    const char *port = getenv(ADCS_HOST_PORT_ENV);
+    if (adcs_fd < 0 && port != NULL) {
+        adcs_io_posix_open(port);
+    }
+
+    adcs_register_transport(ADCS_TRANSPORT_UART, &adcs_uart_transport);
+    adcs_register_transport(ADCS_TRANSPORT_I2C, &adcs_i2c_transport);
+    adcs_register_transport(ADCS_TRANSPORT_LOOPBACK, &adcs_loopback_transport);
+    adcs_select_transport(ADCS_DEFAULT_TRANSPORT);
+}
+
+/**
+ * @brief
+ *      Wait for and read more bytes into rx_stage
+ * @param timeout_ms
+ *      How long to wait for the first byte
+ */
+static ADCS_returnState posix_rx_fill(int timeout_ms) {
+    struct pollfd pfd = {.fd = adcs_fd, .events = POLLIN};
+    int ready;
+
+    do {
+        ready = poll(&pfd, 1, timeout_ms);
+    } while (ready < 0 && errno == EINTR);
+    if (ready <= 0) {
+        return ADCS_UART_FAILED;
+    }
+
+    ssize_t n = read(adcs_fd, rx_stage, sizeof(rx_stage));
+    if (n <= 0) {
+        return ADCS_UART_FAILED;
+    }
+    rx_pos = 0;
+    rx_len = (uint32_t)n;
+    return ADCS_OK;
+}
+
+static uint32_t posix_xfer_elapsed_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - xfer_start.tv_sec) * 1000 + (now.tv_nsec - xfer_start.tv_nsec) / 1000000;
+}
+
+/**
+ * @brief
+ *      Milliseconds left of the transaction deadline, 0 once it has passed
+ */
+static int posix_xfer_left_ms(void) {
+    uint32_t elapsed = posix_xfer_elapsed_ms();
+    return (elapsed < xfer_budget_ms) ? (int)(xfer_budget_ms - elapsed) : 0;
+}
+
+static void posix_xfer_begin(uint8_t id, uint32_t wire_bytes) {
+    xfer_sent = 0;
+    xfer_received = 0;
+    xfer_budget_ms = adcs_deadline_budget_ms(id, wire_bytes);
+    clock_gettime(CLOCK_MONOTONIC, &xfer_start);
+}
+
+static void posix_xfer_end(uint8_t id, ADCS_returnState state) {
+    uint32_t rtt_ms = posix_xfer_elapsed_ms();
+    adcs_stats_record(id, xfer_sent, xfer_received, rtt_ms, state == ADCS_UART_FAILED);
+    if (state == ADCS_UART_FAILED) {
+        adcs_deadline_expired(id);
+    } else {
+        adcs_deadline_observe(id, rtt_ms);
+    }
+}
+
+static void posix_rx_flush(void) {
+    rx_pos = 0;
+    rx_len = 0;
+    while (posix_rx_fill(0) == ADCS_OK) {
+    }
+    rx_pos = 0;
+    rx_len = 0;
+}
+
+static ADCS_returnState posix_tx_frame(const uint8_t *body, uint32_t length) {
+    uint32_t len = adcs_frame_encode(tx_frame, body, length);
+    uint32_t sent = 0;
+
+    while (sent < len) {
+        ssize_t n = write(adcs_fd, tx_frame + sent, len - sent);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return ADCS_UART_FAILED;
+        }
+        sent += (uint32_t)n;
+    }
+    xfer_sent += sent;
+    return ADCS_OK;
+}
+
+/**
+ * @brief
+ *      Receive one frame, same contract as uart_rx_frame in adcs_io.c
+ */
+static ADCS_returnState posix_rx_frame(uint8_t id, uint8_t *payload, uint32_t length) {
+    adcs_frame_parser parser;
+    adcs_frame_parser_init(&parser, payload, length);
+
+    for (;;) {
+        uint32_t consumed;
+
+        if (rx_pos == rx_len) {
+            ADCS_returnState state = posix_rx_fill(posix_xfer_left_ms());
+            if (state != ADCS_OK) {
+                return state;
+            }
+        }
+
+        ADCS_frameState frame = adcs_frame_parse(&parser, rx_stage + rx_pos, rx_len - rx_pos, &consumed);
+        rx_pos += consumed;
+        xfer_received += consumed;
+
+        if (frame == ADCS_FRAME_OVERFLOW && parser.id != id) {
+            adcs_frame_parser_skip(&parser); // drained to its own end, see adcs_io.c
+            continue;
+        }
+        if (frame != ADCS_FRAME_INCOMPLETE && parser.id != id) {
+            adcs_frame_parser_init(&parser, payload, length); // stray packet or late reply, see adcs_io.c
+            continue;
+        }
+        if (frame == ADCS_FRAME_OVERFLOW) {
+            return ADCS_INCORRECT_LENGTH;
+        } else if (frame == ADCS_FRAME_COMPLETE) {
+            return (parser.length == length) ? ADCS_OK : ADCS_INCORRECT_LENGTH;
+        }
+    }
+}
+
+/**
+ * @brief
+ *      Receive one download packet into place, same contract as uart_rx_packet in adcs_io.c
+ */
+static ADCS_returnState posix_rx_packet(uint8_t *hole_map, uint8_t *image, uint32_t length, bool *added) {
+    adcs_frame_parser parser;
+    uint8_t counter[2];
+    uint16_t packet = 0;
+    bool placed = false;
+
+    *added = false;
+    adcs_frame_parser_init(&parser, counter, sizeof(counter));
+    adcs_frame_parser_split(&parser);
+
+    for (;;) {
+        uint32_t consumed;
+
+        if (rx_pos == rx_len) {
+            ADCS_returnState state = posix_rx_fill(posix_xfer_left_ms());
+            if (state != ADCS_OK) {
+                return state;
+            }
+        }
+
+        ADCS_frameState frame = adcs_frame_parse(&parser, rx_stage + rx_pos, rx_len - rx_pos, &consumed);
+        rx_pos += consumed;
+        xfer_received += consumed;
+
+        if (frame == ADCS_FRAME_SPLIT) {
+            adcs_reader tm = adcs_reader_init(counter, sizeof(counter));
+            packet = adcs_get_u16(&tm);
+            uint32_t offset = (uint32_t)packet * ADCS_DL_PACKET_LEN;
+            placed = (parser.id == FILE_DL_BUFFER_ID && offset < length &&
+                      !((hole_map[packet / 8] >> (packet % 8)) & 1));
+            if (placed) {
+                uint32_t room = length - offset;
+                adcs_frame_parser_set_tail(&parser, image + offset,
+                                           (room < ADCS_DL_PACKET_LEN) ? room : ADCS_DL_PACKET_LEN);
+            }
+        } else if (frame == ADCS_FRAME_COMPLETE) {
+            if (parser.id != FILE_DL_BUFFER_ID) {
+                return ADCS_INVALID_ID;
+            }
+            if (parser.length != 2 + ADCS_DL_PACKET_LEN) {
+                return ADCS_INCORRECT_LENGTH;
+            }
+            if (placed) {
+                hole_map[packet / 8] |= 1 << (packet % 8);
+            }
+            *added = placed;
+            return ADCS_OK;
+        }
+    }
+}
+
+ADCS_returnState send_uart_telecommand(uint8_t *command, uint32_t length) {
+    if (length == 0 || length > ADCS_MAX_TC_LEN) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    pthread_mutex_lock(&link_mutex);
+    if (adcs_fd < 0) {
+        pthread_mutex_unlock(&link_mutex);
+        return ADCS_UART_FAILED;
+    }
+
+    posix_rx_flush();
+    posix_xfer_begin(command[0], (length + 4) + 6);
+    ADCS_returnState state = posix_tx_frame(command, length);
+    uint8_t reply = 1;
+    if (state == ADCS_OK) {
+        state = posix_rx_frame(command[0], &reply, 1);
+    }
+    posix_xfer_end(command[0], state);
+    pthread_mutex_unlock(&link_mutex);
+
+    if (state != ADCS_OK) {
+        return state;
+    }
+    return (ADCS_returnState)reply;
+}
+
+ADCS_returnState send_uart_telecommands(uint8_t *commands, uint32_t length, uint32_t count) {
+    if (length == 0 || length > ADCS_MAX_TC_LEN || count == 0 || count > ADCS_TC_WINDOW) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    pthread_mutex_lock(&link_mutex);
+    if (adcs_fd < 0) {
+        pthread_mutex_unlock(&link_mutex);
+        return ADCS_UART_FAILED;
+    }
+
+    // Per telecommand deadlines and timing as in adcs_io.c
+    posix_rx_flush();
+    posix_xfer_begin(commands[0], (length + 4) + 6);
+    struct timespec started[ADCS_TC_WINDOW];
+    ADCS_returnState state = ADCS_OK;
+    uint32_t sent = 0;
+    while (state == ADCS_OK && sent < count) {
+        clock_gettime(CLOCK_MONOTONIC, &started[sent]);
+        state = posix_tx_frame(&commands[sent * length], length);
+        sent += (state == ADCS_OK);
+    }
+
+    ADCS_returnState result = state;
+    uint32_t acked = 0;
+    while (acked < sent) {
+        uint8_t reply = 1;
+        xfer_start = started[acked];
+        state = posix_rx_frame(commands[acked * length], &reply, 1);
+        if (state != ADCS_OK) {
+            break;
+        }
+        if (result == ADCS_OK) {
+            result = (ADCS_returnState)reply;
+        }
+        acked++;
+    }
+
+    xfer_start = started[(sent > 0) ? sent - 1 : 0];
+    if (acked > 0 && acked < sent) {
+        adcs_stats_record(commands[0], xfer_sent, xfer_received, posix_xfer_elapsed_ms(), false);
+    } else {
+        posix_xfer_end(commands[0], state);
+    }
+    pthread_mutex_unlock(&link_mutex);
+
+    return (state != ADCS_OK) ? state : result;
+}
+
+ADCS_returnState request_uart_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length) {
+    if (length > ADCS_MAX_TM_LEN) {
+        return ADCS_INCORRECT_LENGTH;
+    }
+    pthread_mutex_lock(&link_mutex);
+    if (adcs_fd < 0) {
+        pthread_mutex_unlock(&link_mutex);
+        return ADCS_UART_FAILED;
+    }
+
+    posix_rx_flush();
+    posix_xfer_begin(TM_ID, 5 + (length + 5));
+    ADCS_returnState state = posix_tx_frame(&TM_ID, 1);
+    if (state == ADCS_OK) {
+        state = posix_rx_frame(TM_ID, telemetry, length);
+    }
+    posix_xfer_end(TM_ID, state);
+    pthread_mutex_unlock(&link_mutex);
+    return state;
+}
+
+ADCS_returnState receive_uart_packet(uint8_t *hole_map, uint8_t *image_bytes, uint32_t length_bytes, bool *added) {
+    *added = false;
+    if (length_bytes > ADCS_DL_BLOCK_LEN) {
+        return ADCS_INVALID_PARAMETERS;
+    }
+    pthread_mutex_lock(&link_mutex);
+    posix_xfer_begin(FILE_DL_BUFFER_ID, 2 + ADCS_DL_PACKET_LEN + 5);
+    ADCS_returnState state =
+        (adcs_fd < 0) ? ADCS_UART_FAILED : posix_rx_packet(hole_map, image_bytes, length_bytes, added);
+    posix_xfer_end(FILE_DL_BUFFER_ID, state);
+    pthread_mutex_unlock(&link_mutex);
+    return state;
+}
+
+// There is no I2C bus on the host
+ADCS_returnState send_i2c_telecommand(uint8_t *command, uint32_t length) {
+    (void)command;
+    (void)length;
+    return ADCS_INVALID_PARAMETERS;
+}
+
+ADCS_returnState request_i2c_telemetry(uint8_t TM_ID, uint8_t *telemetry, uint32_t length) {
+    (void)TM_ID;
+    (void)telemetry;
+    (void)length;
+    return ADCS_INVALID_PARAMETERS;
+}
+
+const adcs_transport adcs_uart_transport = {
+    .name = "uart",
+    .send_telecommand = send_uart_telecommand,
+    .send_telecommands = send_uart_telecommands,
+    .request_telemetry = request_uart_telemetry,
+    .receive_packet = receive_uart_packet,
+};
+
+const adcs_transport adcs_i2c_transport = {
+    .name = "i2c",
+    .send_telecommand = NULL,
+    .send_telecommands = NULL,
+    .request_telemetry = NULL,
+    .receive_packet = NULL,
+};
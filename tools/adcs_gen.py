@@ -0,0 +1,665 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020  University of Alberta
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+"""Generates the frame tables, their round-trip tests and the HAL pass-through wrappers.
+
+    tools/adcs_gen.py          regenerate everything from tools/adcs_frames.json
+    tools/adcs_gen.py --check  fail if a generated file is stale or the schema disagrees with the sources
+
+Inputs are tools/adcs_frames.json, the ID enums in adcs_types.h, the literal frame lengths in
+adcs_handler.c (cross-checked only) and the handler prototypes in adcs_handler.h. Outputs are
+adcs_frames.h/.c, test/test_adcs_frames.c and the marked regions of hardware_interface adcs.h/adcs.c.
+"""
+
+import json
+import os
+import re
+import sys
+import textwrap
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SCHEMA = os.path.join(ROOT, "tools", "adcs_frames.json")
+TYPES_H = os.path.join(ROOT, "equipment_handler", "inc", "adcs_types.h")
+HANDLER_H = os.path.join(ROOT, "equipment_handler", "inc", "adcs_handler.h")
+HANDLER_C = os.path.join(ROOT, "equipment_handler", "src", "adcs_handler.c")
+FRAMES_H = os.path.join(ROOT, "equipment_handler", "inc", "adcs_frames.h")
+FRAMES_C = os.path.join(ROOT, "equipment_handler", "src", "adcs_frames.c")
+FRAMES_TEST = os.path.join(ROOT, "equipment_handler", "test", "test_adcs_frames.c")
+HAL_H = os.path.join(ROOT, "hardware_interface", "include", "adcs.h")
+HAL_C = os.path.join(ROOT, "hardware_interface", "source", "adcs.c")
+
+BEGIN_MARK = "// BEGIN GENERATED by tools/adcs_gen.py, do not edit"
+END_MARK = "// END GENERATED"
+
+LICENSE = """/*
+ * Copyright (C) 2020  University of Alberta
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+"""
+
+LINE_MAX = 115
+
+# schema type -> (wire bytes, C field type, storage bytes, scaled C field type)
+TYPES = {
+    "u8": (1, "ADCS_FIELD_U8", 1, "ADCS_FIELD_U8_F"),
+    "u16": (2, "ADCS_FIELD_U16", 2, "ADCS_FIELD_U16_F"),
+    "i16": (2, "ADCS_FIELD_I16", 2, "ADCS_FIELD_I16_F"),
+    "u32": (4, "ADCS_FIELD_U32", 4, None),
+    "i32": (4, "ADCS_FIELD_I32", 4, "ADCS_FIELD_I32_F"),
+    "f32": (4, "ADCS_FIELD_F32", 4, None),
+    "f64": (8, "ADCS_FIELD_F64", 8, None),
+    "bits": (0, "ADCS_FIELD_BITS", 1, None),
+    "flags": (0, "ADCS_FIELD_FLAGS", 1, None),
+}
+
+
+class SchemaError(Exception):
+    pass
+
+
+def len_name(frame_id):
+    return (frame_id[:-3] if frame_id.endswith("_ID") else frame_id) + "_LEN"
+
+
+def table_name(block):
+    return "adcs_%s_fields" % block
+
+
+def count_name(block):
+    return "ADCS_%s_FIELD_COUNT" % block.upper()
+
+
+def scale_name(block, member):
+    return "ADCS_%s_%s_SCALE" % (block.upper(), ident(member).upper())
+
+
+def ident(text):
+    return re.sub(r"[^A-Za-z0-9]+", "_", text).strip("_")
+
+
+def c_float(value):
+    text = repr(float(value))
+    return text + "f"
+
+
+# ---------------------------------------------------------------- inputs
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def parse_ids(text):
+    """Returns {name: (value, program)} for the TC/TM/config ID enums of adcs_types.h."""
+    ids = {}
+    for m in re.finditer(r"typedef enum (\w+) \{(.*?)\}", text, re.S):
+        enum, body = m.groups()
+        if enum.startswith("Common"):
+            program = "common"
+        elif enum.startswith("BootLoader"):
+            program = "bootloader"
+        elif enum.startswith("ACP"):
+            program = "acp"
+        else:
+            continue
+        for name, value in re.findall(r"^\s*(\w+)\s*=\s*(\d+)", body, re.M):
+            ids[name] = (int(value), program)
+    return ids
+
+
+def field_extent(field):
+    """Bytes [start, end) a field occupies on the wire."""
+    if field["type"] in ("bits", "flags"):
+        first = field.get("bit", 0)
+        return field["at"], field["at"] + (first + field.get("count", 1) + 7) // 8
+    return field["at"], field["at"] + TYPES[field["type"]][0] * field.get("count", 1)
+
+
+def check_field(block, field):
+    where = "block %s member %s" % (block, field.get("member"))
+    if field.get("type") not in TYPES or "at" not in field or "member" not in field:
+        raise SchemaError("%s: needs at, member and a known type" % where)
+    count = field.get("count", 1)
+    if not 1 <= count <= 255:
+        raise SchemaError("%s: count out of range" % where)
+    if field["type"] in ("bits", "flags"):
+        if field["type"] == "bits" and count > 8:
+            raise SchemaError("%s: more than 8 bits in one member" % where)
+        if "scale" in field:
+            raise SchemaError("%s: bit fields are not scaled" % where)
+        if not 0 <= field.get("bit", 0) <= 7:
+            raise SchemaError("%s: bit must be 0-7, move at instead" % where)
+        if field["type"] == "bits" and "first" in field:
+            raise SchemaError("%s: first is for flags only" % where)
+        if not 0 <= field.get("first", 0) <= 255:
+            raise SchemaError("%s: first out of range" % where)
+    elif "scale" in field and TYPES[field["type"]][3] is None:
+        raise SchemaError("%s: %s cannot be scaled" % (where, field["type"]))
+
+
+def wire_bits(field):
+    """Set of (byte, bit) positions a field occupies."""
+    start, end = field_extent(field)
+    if field["type"] in ("bits", "flags"):
+        first = field["at"] * 8 + field.get("bit", 0)
+        return {divmod(first + k, 8) for k in range(field.get("count", 1))}
+    return {(byte, bit) for byte in range(start, end) for bit in range(8)}
+
+
+def flatten(schema, name, at=0, prefix="", depth=0):
+    """All fields of a block with parts expanded, as (field, owner block) sorted by offset."""
+    if depth > 4:
+        raise SchemaError("block %s: parts nest too deep" % name)
+    block = schema["blocks"][name]
+    out = []
+    for field in block.get("fields", []):
+        check_field(name, field)
+        f = dict(field)
+        f["at"] = field["at"] + at
+        f["member"] = prefix + field["member"]
+        out.append((f, name))
+    for part in block.get("parts", []):
+        if part["block"] not in schema["blocks"]:
+            raise SchemaError("block %s: unknown part %s" % (name, part["block"]))
+        out += flatten(schema, part["block"], at + part["at"], prefix + part["member"] + ".", depth + 1)
+    out.sort(key=lambda item: (item[0]["at"], item[0].get("bit", 0)))
+    return out
+
+
+def check_schema(schema, ids):
+    blocks = schema["blocks"]
+    extents = {}
+    for name in blocks:
+        if "struct" not in blocks[name]:
+            raise SchemaError("block %s: no struct" % name)
+        used = {}
+        next_flag = {}
+        end = 0
+        for field, _ in flatten(schema, name):
+            for pos in wire_bits(field):
+                if pos in used:
+                    raise SchemaError("block %s: %s overlaps %s at byte %d" % (name, field["member"], used[pos], pos[0]))
+                used[pos] = field["member"]
+            if field["type"] == "flags":
+                # Reading a flag run clears the rest of its last word, so runs must follow on from flag 0
+                first = field.get("first", 0)
+                expected = next_flag.get(field["member"], 0)
+                if first != expected:
+                    raise SchemaError("block %s: flags of %s start at %d, expected %d" % (name, field["member"], first, expected))
+                next_flag[field["member"]] = first + field.get("count", 1)
+            end = max(end, field_extent(field)[1])
+        extents[name] = end
+
+    seen = {}
+    names = set()
+    for frame in schema["frames"]:
+        fid = frame["id"]
+        if fid in names:
+            raise SchemaError("frame %s listed twice" % fid)
+        names.add(fid)
+        if fid not in ids:
+            raise SchemaError("frame %s is not an ID in adcs_types.h" % fid)
+        value, program = ids[fid]
+        if frame["dir"] not in ("tc", "tm") or (value < 128) != (frame["dir"] == "tc"):
+            raise SchemaError("frame %s: direction does not match ID %d" % (fid, value))
+        block = frame.get("block")
+        if block is not None:
+            if block not in blocks:
+                raise SchemaError("frame %s: unknown block %s" % (fid, block))
+            if extents[block] > frame["length"]:
+                raise SchemaError("frame %s: block %s needs %d bytes" % (fid, block, extents[block]))
+        span = range(value + 1, value + 1 + frame["ids"]) if "ids" in frame else [value]
+        for v in span:
+            # The bootloader and the ACP never run at the same time, so only they may reuse an ID
+            for other_program, other in seen.get(v, []):
+                if "common" in (program, other_program) or program == other_program:
+                    raise SchemaError("frame %s: ID %d already used by %s" % (fid, v, other))
+            seen.setdefault(v, []).append((program, fid))
+
+    missing = sorted(set(ids) - names)
+    if missing:
+        raise SchemaError("IDs in adcs_types.h without a frame: " + ", ".join(missing))
+
+
+def expand_raw(schema):
+    """Adds a <block>_raw twin after every block that names a raw struct: the same layout with the
+    scaling left out, so the counts land in the struct's integer members untouched."""
+    blocks = {}
+    for name, block in schema["blocks"].items():
+        blocks[name] = block
+        if "raw" not in block:
+            continue
+        if block.get("parts"):
+            raise SchemaError("block %s: raw twins of blocks with parts are not supported" % name)
+        fields = []
+        for field in block["fields"]:
+            raw = {k: v for k, v in field.items() if k not in ("scale", "unit")}
+            if "scale" in field:
+                raw["unit"] = ("%g %s" % (field["scale"], field.get("unit", ""))).strip()
+            fields.append(raw)
+        blocks[name + "_raw"] = {"struct": block["raw"], "doc": block.get("doc", block["struct"]) + ", unscaled",
+                                 "raw_of": name, "fields": fields}
+    schema["blocks"] = blocks
+
+
+def check_handler(schema, text):
+    """Literal frame lengths in adcs_handler.c must match the schema."""
+    lengths = {f["id"]: f["length"] for f in schema["frames"]}
+    errors = []
+    for body in re.split(r"\n\}\n", text):
+        tc = re.search(r"command(?:\[0\])? = (\w+);", body)
+        for m in re.finditer(r"adcs_telecommand\(&?command, (\d+)\)", body):
+            if tc and tc.group(1) in lengths and int(m.group(1)) != 1 + lengths[tc.group(1)]:
+                errors.append("%s sent with %s bytes, schema says 1 + %d" % (tc.group(1), m.group(1), lengths[tc.group(1)]))
+        for m in re.finditer(r"adcs_telemetry\((\w+), &?\w+, (\d+)\)", body):
+            if m.group(1) in lengths and int(m.group(2)) != lengths[m.group(1)]:
+                errors.append("%s read as %s bytes, schema says %d" % (m.group(1), m.group(2), lengths[m.group(1)]))
+    if errors:
+        raise SchemaError("adcs_handler.c: " + "; ".join(errors))
+
+
+# ---------------------------------------------------------------- field tables
+
+
+def member_ref(struct, member):
+    return "((%s *)0)->%s" % (struct, member)
+
+
+def storage(field):
+    """Bytes one value of a field takes in the struct."""
+    if "scale" in field:
+        return 4  # float
+    return TYPES[field["type"]][2]
+
+
+def size_asserts(block, struct, field):
+    member = field["member"]
+    count = field.get("count", 1)
+    if field["type"] == "flags":
+        # A flag set: whole words, holding flags first.. of this field
+        name = "%s_%s_%d" % (block, ident(member), field.get("first", 0))
+        return [
+            "ADCS_STATIC_ASSERT(sizeof(%s.word[0]) == 4, %s);" % (member_ref(struct, member), name),
+            "ADCS_STATIC_ASSERT(sizeof(%s) * 8 >= %d, %s_bounds);"
+            % (member_ref(struct, member), field.get("first", 0) + count, name),
+        ]
+    elem = storage(field)
+    per_member = 1 if field["type"] == "bits" else count
+    name = "%s_%s" % (block, ident(member))
+    m = re.match(r"(.*)\[(\d+)\]$", member)
+    if m and field["type"] != "bits":
+        base, index = m.group(1), int(m.group(2))
+        return [
+            "ADCS_STATIC_ASSERT(sizeof(%s) == %d, %s);" % (member_ref(struct, member), elem, name),
+            "ADCS_STATIC_ASSERT(sizeof(%s) >= %d, %s_bounds);"
+            % (member_ref(struct, base), (index + per_member) * elem, name),
+        ]
+    return ["ADCS_STATIC_ASSERT(sizeof(%s) == %d, %s);" % (member_ref(struct, member), per_member * elem, name)]
+
+
+def struct_neighbours(prev, field):
+    """Whether field is stored right after prev: siblings in the same struct, or the next elements of one array."""
+    a = re.match(r"(.*?)(?:\[(\d+)\])?$", prev["member"])
+    b = re.match(r"(.*?)(?:\[(\d+)\])?$", field["member"])
+    if a.group(2) is not None or b.group(2) is not None:
+        return (a.group(1) == b.group(1) and a.group(2) is not None and b.group(2) is not None
+                and int(b.group(2)) == int(a.group(2)) + prev.get("count", 1))
+    return a.group(1).rpartition(".")[0] == b.group(1).rpartition(".")[0]
+
+
+def mergeable(prev, field):
+    if prev is None or prev["type"] in ("bits", "flags") or prev.get("manual") or field.get("manual"):
+        return False
+    return (
+        prev["type"] == field["type"]
+        and prev.get("scale") == field.get("scale")
+        and field_extent(prev)[1] == field["at"]
+        and prev.get("count", 1) + field.get("count", 1) <= 255
+        and struct_neighbours(prev, field)
+    )
+
+
+def block_entries(schema, name):
+    """Table entries of a block: runs of contiguous same-type members are merged into one entry,
+    each merge backed by a static assertion that the members are contiguous in the struct too."""
+    struct = schema["blocks"][name]["struct"]
+    asserts = []
+    entries = []
+    for field, owner in flatten(schema, name):
+        if owner == name:
+            asserts += size_asserts(name, struct, field)
+        last = entries[-1] if entries else None
+        if last is not None and last["owner"] == owner and mergeable(last["tail"], field):
+            if owner == name:
+                asserts.append(
+                    "ADCS_STATIC_ASSERT(offsetof(%s, %s) == offsetof(%s, %s) + %d, %s_follows);"
+                    % (struct, field["member"], struct, last["tail"]["member"],
+                       last["tail"].get("count", 1) * storage(field), "%s_%s" % (name, ident(field["member"])))
+                )
+            last["count"] += field.get("count", 1)
+            last["tail"] = field
+            last["units"] += [field["unit"]] if "unit" in field and field["unit"] not in last["units"] else []
+            continue
+        entries.append({"field": field, "tail": field, "owner": owner, "count": field.get("count", 1),
+                        "units": [field["unit"]] if "unit" in field else []})
+    return asserts, entries
+
+
+def entry_line(struct, entry):
+    field = entry["field"]
+    if field.get("manual"):
+        text = "// %d: %s, packed by hand" % (field["at"], field["member"])
+        if "note" in field:
+            text += " (%s)" % field["note"]
+        return ["    " + text]
+    if field["type"] == "bits":
+        code = "ADCS_BITS(%d, %d, %d, %s, %s)," % (field["at"], field.get("bit", 0), entry["count"], struct,
+                                                   field["member"])
+    elif field["type"] == "flags":
+        code = "ADCS_FLAGS(%d, %d, %d, %s, %s, %d)," % (field["at"], field.get("bit", 0), entry["count"], struct,
+                                                        field["member"], field.get("first", 0))
+    elif "scale" in field:
+        code = "ADCS_FIELD(%d, %s, %d, %s, %s, %s)," % (field["at"], TYPES[field["type"]][3], entry["count"],
+                                                       c_float(field["scale"]), struct, field["member"])
+    else:
+        code = "ADCS_FIELD(%d, %s, %d, 0, %s, %s)," % (field["at"], TYPES[field["type"]][1], entry["count"], struct,
+                                                      field["member"])
+    notes = []
+    if entry["units"]:
+        notes.append("[%s]" % ", ".join(entry["units"]))
+    if "note" in field:
+        notes.append(field["note"])
+    if entry["tail"] is not field:
+        notes.append("up to %s" % entry["tail"]["member"])
+    comment = ", ".join(notes)
+    if not comment:
+        return ["    " + code]
+    if len("    %s // %s" % (code, comment)) <= LINE_MAX:
+        return ["    %s // %s" % (code, comment)]
+    return ["    // " + comment, "    " + code]
+
+
+def wrap_assert(line):
+    """Breaks an assertion before its name, then after ==, the way clang-format would."""
+    if len(line) <= LINE_MAX:
+        return [line]
+    indent = " " * len("ADCS_STATIC_ASSERT(")
+    cond, name = line.rsplit(", ", 1)
+    if len(cond) + 1 <= LINE_MAX:
+        return [cond + ",", indent + name]
+    left, right = cond.split(" == ", 1)
+    return [left + " ==", indent + right + ",", indent + name]
+
+
+def align_comments(lines):
+    """Lines up the trailing comments of consecutive lines."""
+    out = []
+    run = []
+    for line in lines + [None]:
+        code = line.split(" // ", 1) if line is not None and not line.lstrip().startswith("//") else None
+        if code is not None and len(code) == 2:
+            run.append(code)
+            continue
+        width = max([len(c) for c, _ in run] or [0])
+        for c, comment in run:
+            padded = "%s %s// %s" % (c, " " * (width - len(c)), comment)
+            out.append(padded if len(padded) <= LINE_MAX else "%s // %s" % (c, comment))
+        run = []
+        if line is not None:
+            out.append(line)
+    return out
+
+
+def doc_lines(text):
+    return ["// " + line for line in textwrap.wrap(text, LINE_MAX - 3)]
+
+
+def frames_h(schema):
+    out = [LICENSE + "/**\n * @file adcs_frames.h\n * @brief\n *      Generated by tools/adcs_gen.py from "
+           "tools/adcs_frames.json, do not edit.\n */\n", "#ifndef ADCS_FRAMES_H", "#define ADCS_FRAMES_H", "",
+           '#include "adcs_fields.h"', "", "// Bytes after the ID of each frame"]
+    for direction, title in (("tc", "Telecommands"), ("tm", "Telemetry")):
+        out.append("")
+        out.append("// " + title)
+        for frame in schema["frames"]:
+            if frame["dir"] == direction:
+                out.append("#define %s %d" % (len_name(frame["id"]), frame["length"]))
+    out += ["", "// Field tables of the structured frames, for adcs_fields_decode and adcs_fields_encode"]
+    for name in schema["blocks"]:
+        _, entries = block_entries(schema, name)
+        count = sum(1 for e in entries if not e["field"].get("manual"))
+        out.append("extern const adcs_field %s[];" % table_name(name))
+        out.append("#define %s %d" % (count_name(name), count))
+    for name, block in schema["blocks"].items():
+        if "raw" not in block:
+            continue
+        out += ["", "// Scales of the counts in %s: engineering value = count * scale" % block["raw"]]
+        scales = []
+        for field, _ in flatten(schema, name):
+            if "scale" in field:
+                line = "#define %s %s" % (scale_name(name, field["member"]), c_float(field["scale"]))
+                scales.append(line + (" // " + field["unit"] if "unit" in field else ""))
+        out += align_comments(scales)
+    out += ["", "#endif /* ADCS_FRAMES_H */", ""]
+    return "\n".join(out)
+
+
+def frames_c(schema):
+    out = [LICENSE + "/**\n * @file adcs_frames.c\n * @brief\n *      Generated by tools/adcs_gen.py from "
+           "tools/adcs_frames.json, do not edit.\n */\n", '#include "adcs_frames.h"', '#include "adcs_handler.h"',
+           '#include "adcs_io.h"', "", "// Laid out by the generator, keep the pre-commit formatting off it",
+           "// clang-format off", ""]
+    tc = max((f for f in schema["frames"] if f["dir"] == "tc"), key=lambda f: f["length"])
+    tm = max((f for f in schema["frames"] if f["dir"] == "tm"), key=lambda f: f["length"])
+    out.append("// The I/O buffers hold the largest frames")
+    out.append("ADCS_STATIC_ASSERT(1 + %s <= ADCS_MAX_TC_LEN, largest_tc);" % len_name(tc["id"]))
+    out.append("ADCS_STATIC_ASSERT(%s <= ADCS_MAX_TM_LEN, largest_tm);" % len_name(tm["id"]))
+    for name, block in schema["blocks"].items():
+        struct = block["struct"]
+        asserts, entries = block_entries(schema, name)
+        out.append("")
+        out += doc_lines(block.get("doc", struct))
+        for line in asserts:
+            out += wrap_assert(line)
+        out.append("const adcs_field %s[] = {" % table_name(name))
+        table = []
+        for entry in entries:
+            table += entry_line(struct, entry)
+        out += align_comments(table)
+        out.append("};")
+    out += ["", "// clang-format on", ""]
+    return "\n".join(out)
+
+
+def frames_test(schema):
+    structs = []
+    for block in schema["blocks"].values():
+        if block["struct"] not in structs:
+            structs.append(block["struct"])
+    first = {}
+    for frame in schema["frames"]:
+        if "block" in frame and frame["block"] not in first:
+            first[frame["block"]] = frame["id"]
+    for name, block in schema["blocks"].items():
+        if "raw_of" in block and block["raw_of"] in first:
+            first[name] = first[block["raw_of"]]
+    out = [LICENSE.rstrip(), "// Generated by tools/adcs_gen.py from tools/adcs_frames.json, do not edit.", "",
+           "#include <stdint.h>", "#include <string.h>", "", '#include "adcs_fields.h"', '#include "adcs_frames.h"',
+           '#include "adcs_handler.h"', '#include "unity.h"', "", "typedef union {"]
+    out += ["    %s %s;" % (s, ident(s)) for s in structs]
+    largest = len_name(max(schema["frames"], key=lambda f: f["length"])["id"])
+    out += ["} any_block;", "", "static uint8_t frame[%s];" % largest, "static uint8_t encoded[%s];" % largest,
+            "static any_block decoded;", "static any_block redecoded;", "",
+            "void setUp(void) {", "    memset(&decoded, 0, sizeof(decoded));",
+            "    memset(&redecoded, 0, sizeof(redecoded));", "    memset(encoded, 0, sizeof(encoded));", "}", "",
+            "void tearDown(void) {}", "",
+            "/*",
+            " * Decodes a pseudo-random frame, encodes the result and decodes that again: both decodes must agree.",
+            " * Scaled 32 bit values are kept within float precision so the round trip is exact.",
+            " */",
+            "static void roundtrip(const adcs_field *fields, uint32_t count, uint32_t length) {",
+            "    uint32_t seed = length;",
+            "    for (uint32_t i = 0; i < length; i++) {",
+            "        seed = seed * 1103515245 + 12345;",
+            "        frame[i] = seed >> 16;",
+            "    }",
+            "    for (uint32_t i = 0; i < count; i++) {",
+            "        for (uint32_t k = 0; fields[i].type == ADCS_FIELD_I32_F && k < fields[i].count; k++) {",
+            "            frame[fields[i].wire + 4 * k + 3] = 0;",
+            "            frame[fields[i].wire + 4 * k + 2] &= 0x7F;",
+            "        }",
+            "    }",
+            "",
+            "    TEST_ASSERT_EQUAL(ADCS_OK, adcs_fields_decode(fields, count, frame, length, &decoded));",
+            "    TEST_ASSERT_EQUAL(ADCS_OK, adcs_fields_encode(fields, count, &decoded, encoded, length));",
+            "    TEST_ASSERT_EQUAL(ADCS_OK, adcs_fields_decode(fields, count, encoded, length, &redecoded));",
+            "    TEST_ASSERT_EQUAL_MEMORY(&decoded, &redecoded, sizeof(decoded));",
+            "}"]
+    for name in schema["blocks"]:
+        if name not in first:
+            continue
+        out += ["", "void test_ADCS_frames_%s_roundtrip(void) {" % name,
+                "    roundtrip(%s, %s, %s);" % (table_name(name), count_name(name), len_name(first[name])), "}"]
+    out.append("")
+    return "\n".join(out)
+
+
+# ---------------------------------------------------------------- HAL wrappers
+
+
+def handler_prototypes(text):
+    """(section, name, params) of every ADCS_returnState ADCS_* prototype, in header order."""
+    out = []
+    section = None
+    for m in re.finditer(r"^// (.+)$|^ADCS_returnState ADCS_(\w+)\(([^)]*)\);", text, re.M):
+        if m.group(1):
+            section = m.group(1).strip()
+            continue
+        params = re.sub(r"\s+", " ", m.group(3)).strip()
+        params = re.sub(r"\s*\*\s*", " *", params).replace("* *", "**")
+        out.append((section, m.group(2), params))
+    return out
+
+
+def outside_region(text):
+    if BEGIN_MARK not in text:
+        return text
+    return text[: text.index(BEGIN_MARK)] + text[text.index(END_MARK) :]
+
+
+def call_args(params):
+    if params in ("", "void"):
+        return ""
+    names = []
+    for param in params.split(","):
+        m = re.search(r"(\w+)\s*(\[[^]]*\])?$", param.strip())
+        names.append(m.group(1))
+    return ", ".join(names)
+
+
+def wrap_call(head, params, tail):
+    """head(params)tail, continuing arguments under the opening parenthesis when too long."""
+    line = "%s(%s)%s" % (head, params, tail)
+    if len(line) <= LINE_MAX:
+        return [line]
+    lines, current = [], head + "("
+    for i, param in enumerate(params.split(", ")):
+        piece = param + (", " if i < params.count(", ") else ")" + tail)
+        if len(current + piece.rstrip()) > LINE_MAX and current.strip() != head + "(":
+            lines.append(current.rstrip())
+            current = " " * (len(head) + 1)
+        current += piece
+    return lines + [current]
+
+
+def hal_regions(protos, hal_h, hal_c):
+    """Prototypes and definitions of the wrappers not written by hand."""
+    manual = set(re.findall(r"^ADCS_returnState HAL_ADCS_(\w+)\(", outside_region(hal_c), re.M))
+    header, source = [BEGIN_MARK], [BEGIN_MARK]
+    section = None
+    for sect, name, params in protos:
+        if name in manual:
+            continue
+        if sect != section:
+            section = sect
+            header += ["", "// " + sect]
+        params = params or "void"
+        header += wrap_call("ADCS_returnState HAL_ADCS_" + name, params, ";")
+        source += [""] + wrap_call("ADCS_returnState HAL_ADCS_" + name, params, " {") + ["#ifdef ADCS_IS_STUBBED",
+                   "    return IS_STUBBED_A;", "#else",
+                   "    return ADCS_%s(%s);" % (name, call_args(params)), "#endif", "}"]
+    header += ["", END_MARK]
+    source += ["", END_MARK]
+    return "\n".join(header), "\n".join(source)
+
+
+def splice(text, region, path):
+    if BEGIN_MARK not in text or END_MARK not in text:
+        raise SchemaError("%s: generated region markers missing" % path)
+    start = text.index(BEGIN_MARK)
+    end = text.index(END_MARK) + len(END_MARK)
+    return text[:start] + region + text[end:]
+
+
+# ---------------------------------------------------------------- main
+
+
+def generate():
+    schema = json.loads(read(SCHEMA))
+    check_schema(schema, parse_ids(read(TYPES_H)))
+    expand_raw(schema)
+    check_handler(schema, read(HANDLER_C))
+    hal_h, hal_c = read(HAL_H), read(HAL_C)
+    region_h, region_c = hal_regions(handler_prototypes(read(HANDLER_H)), hal_h, hal_c)
+    return {
+        FRAMES_H: frames_h(schema),
+        FRAMES_C: frames_c(schema),
+        FRAMES_TEST: frames_test(schema),
+        HAL_H: splice(hal_h, region_h, HAL_H),
+        HAL_C: splice(hal_c, region_c, HAL_C),
+    }
+
+
+def main(argv):
+    check = "--check" in argv[1:]
+    try:
+        outputs = generate()
+    except (SchemaError, KeyError, ValueError) as e:
+        sys.stderr.write("adcs_gen: %s\n" % e)
+        return 1
+    stale = []
+    for path, text in outputs.items():
+        if os.path.exists(path) and read(path) == text:
+            continue
+        stale.append(os.path.relpath(path, ROOT))
+        if not check:
+            with open(path, "w") as f:
+                f.write(text)
+    if check and stale:
+        sys.stderr.write("adcs_gen: out of date, run tools/adcs_gen.py: %s\n" % ", ".join(stale))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))